@@ -0,0 +1,875 @@
+// ForgeBench.cpp
+// ---------------------------------------------------------------------------
+// forge2d_bench — headless benchmark for the gameplay systems.
+//
+// Loads levels into an entt::registry with the same component layout
+// GameScene::Spawn() builds (via LevelSpawn.hpp), minus textures, then runs
+// the fixed-step system pipeline in GameScene::Update() order for N ticks of
+// scripted (or recorded) input and reports the cost of each system in ns/tick.
+//
+// No window, renderer or assets are touched: Renderable::sheet is null and
+// animation frame lists are placeholders of the right length. Enemies always
+// get the generic slime components (profile sprites are render-only data).
+// Chunked levels bench their always-resident tiles only.
+//
+// Usage (from the project root, like the game):
+//   forge2d_bench [options] [level.json ...]
+//     --ticks N      measured ticks per scenario      (default 3000)
+//     --warmup N     unmeasured ticks before that     (default 240)
+//     --seed N       srand() seed for float bob phases (default 1)
+//     --only NAME    run only scenarios whose name contains NAME
+//     --no-synthetic skip the generated stress scenarios
+//     --csv FILE     also write scenario,stage,mean_ns,p99_ns,allocs_per_tick,
+//                    bytes_per_tick rows to FILE (allocation columns are
+//                    empty unless built with -DFORGE2D_ALLOC_TRACKING=ON)
+//     --replay FILE  bench the replay's level driven by its recorded input
+//                    (repeatable; one scenario per replay, every tick measured)
+//     --runs N       run each scenario N times, report the fastest (default 1)
+//     --tick-hz N    physics tick rate of level and synthetic scenarios
+//                    (default 120, like forge2d); replays tick at their
+//                    recorded rate
+//     --baseline FILE
+//                    compare ns/tick, load time and allocations against FILE;
+//                    exit 1 on a regression, 77 if FILE or a scenario is missing
+//     --write-baseline FILE
+//                    record this run's results into FILE (merged, tolerances kept)
+// With no level or replay arguments every levels/*.json is benched, then the
+// synthetic scenarios (10k tiles, 1k enemies, 500 moving-platform groups and
+// all three combined).
+//
+// With allocation tracking on, every system also reports the heap
+// allocations and bytes it makes per tick; the target is zero for all of
+// them once the warmup ticks have run.
+//
+// --baseline is what the CTest perf suite runs (-DFORGE2D_PERF_TESTS=ON);
+// the file format and the tolerance rule are described under Baselines.
+//
+// Replay scenarios measure real play sessions, but in this texture-less world
+// (default character, slime enemies), so they are a cost profile rather than
+// a re-run: `forge2d --replay FILE --headless` reproduces a session exactly.
+// ---------------------------------------------------------------------------
+
+#include "AllocTracker.hpp"
+#include "Components.hpp"
+#include "GameConfig.hpp"
+#include "LevelData.hpp"
+#include "LevelSerializer.hpp"
+#include "LevelSpawn.hpp"
+#include "Replay.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <entt/entt.hpp>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <print>
+#include <string>
+#include <string_view>
+#include <systems/AnimationSystem.hpp>
+#include <systems/BoundsSystem.hpp>
+#include <systems/CollisionSystem.hpp>
+#include <systems/FloatingSystem.hpp>
+#include <systems/InputSystem.hpp>
+#include <systems/JumpSystem.hpp>
+#include <systems/LadderSystem.hpp>
+#include <systems/MovementSystem.hpp>
+#include <systems/MovingPlatformSystem.hpp>
+#include <systems/PlayerStateSystem.hpp>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+constexpr int WINDOW_W  = 1280; // systems clamp / cull against the window size
+constexpr int WINDOW_H  = 720;
+constexpr int TILE      = 48; // synthetic level grid
+constexpr int SKIP_EXIT = 77; // CTest SKIP_RETURN_CODE: nothing to compare
+
+// ── Options ──────────────────────────────────────────────────────────────────
+struct Options {
+    int                      ticks     = 3000;
+    int                      warmup    = 240;
+    unsigned                 seed      = 1;
+    bool                     synthetic = true;
+    std::string              only;
+    std::string              csvPath;
+    std::string              baselinePath;      // --baseline
+    std::string              writeBaselinePath; // --write-baseline
+    int                      runs   = 1;
+    float                    tickHz = 120.0f; // --tick-hz, main.cpp's default
+    std::vector<std::string> levels;
+    std::vector<std::string> replays;
+};
+
+bool ParseArgs(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string_view a    = argv[i];
+        auto             next = [&]() -> const char* {
+            return i + 1 < argc ? argv[++i] : nullptr;
+        };
+        if (a == "--ticks" || a == "--warmup" || a == "--seed" || a == "--only" ||
+            a == "--csv" || a == "--replay" || a == "--runs" || a == "--baseline" ||
+            a == "--write-baseline" || a == "--tick-hz") {
+            const char* v = next();
+            if (!v) {
+                std::print("forge2d_bench: {} needs a value\n", a);
+                return false;
+            }
+            if (a == "--ticks")
+                opt.ticks = std::max(1, std::atoi(v));
+            else if (a == "--warmup")
+                opt.warmup = std::max(0, std::atoi(v));
+            else if (a == "--seed")
+                opt.seed = (unsigned)std::strtoul(v, nullptr, 10);
+            else if (a == "--only")
+                opt.only = v;
+            else if (a == "--replay")
+                opt.replays.emplace_back(v);
+            else if (a == "--runs")
+                opt.runs = std::max(1, std::atoi(v));
+            else if (a == "--tick-hz")
+                opt.tickHz = std::max((float)std::atof(v), 1.0f);
+            else if (a == "--baseline")
+                opt.baselinePath = v;
+            else if (a == "--write-baseline")
+                opt.writeBaselinePath = v;
+            else
+                opt.csvPath = v;
+        } else if (a == "--no-synthetic") {
+            opt.synthetic = false;
+        } else if (a.starts_with("--")) {
+            std::print("forge2d_bench: unknown option {}\n", a);
+            return false;
+        } else {
+            opt.levels.emplace_back(a);
+        }
+    }
+    return true;
+}
+
+// ── Timing ───────────────────────────────────────────────────────────────────
+double NsPerTick() {
+    static const double ns = 1e9 / (double)SDL_GetPerformanceFrequency();
+    return ns;
+}
+
+// One pipeline stage: its cost on every measured tick, in counter ticks,
+// plus the heap allocations it made over all of them.
+struct Stage {
+    const char*         name;
+    std::vector<Uint64> samples;
+    AllocCounts         allocs;
+
+    double AllocsPerTick() const {
+        return samples.empty() ? 0.0 : (double)allocs.count / samples.size();
+    }
+    double BytesPerTick() const {
+        return samples.empty() ? 0.0 : (double)allocs.bytes / samples.size();
+    }
+
+    double MeanNs() const {
+        if (samples.empty())
+            return 0.0;
+        double sum = 0.0;
+        for (Uint64 s : samples)
+            sum += (double)s;
+        return sum / samples.size() * NsPerTick();
+    }
+    double P99Ns() const {
+        if (samples.empty())
+            return 0.0;
+        std::vector<Uint64> v = samples;
+        size_t              k = std::min(v.size() - 1, (size_t)(v.size() * 0.99));
+        std::nth_element(v.begin(), v.begin() + k, v.end());
+        return (double)v[k] * NsPerTick();
+    }
+};
+
+// ── World ────────────────────────────────────────────────────────────────────
+struct World {
+    entt::registry reg;
+    GravityMode    gravityMode = GravityMode::Platformer;
+    int            viewW = WINDOW_W, viewH = WINDOW_H;
+    float          levelW = 0.0f, levelH = 0.0f;
+    size_t         tiles = 0, enemies = 0, coins = 0;
+};
+
+// Placeholder frame list: systems only look at its length.
+std::vector<SDL_Rect> Frames(int n, int w, int h) {
+    return std::vector<SDL_Rect>(n, SDL_Rect{0, 0, w, h});
+}
+
+// The gameplay side of GameScene::Spawn() for the default character.
+void SpawnPlayer(World& w, const Level& level) {
+    const int colW = PLAYER_SPRITE_WIDTH - PLAYER_BODY_INSET_X * 2;
+    const int colH = PLAYER_SPRITE_HEIGHT - PLAYER_BODY_INSET_TOP - PLAYER_BODY_INSET_BOTTOM;
+    const auto frames = Frames(8, PLAYER_SPRITE_WIDTH, PLAYER_SPRITE_HEIGHT);
+
+    auto& reg    = w.reg;
+    auto  player = reg.create();
+    reg.emplace<Transform>(player, level.player.x, level.player.y);
+    reg.emplace<PrevTransform>(player, level.player.x, level.player.y);
+    reg.emplace<Velocity>(player);
+    AnimationState as;
+    as.totalFrames = (int)frames.size();
+    as.fps         = 10.0f;
+    as.currentAnim = AnimationID::IDLE;
+    reg.emplace<AnimationState>(player, as);
+    reg.emplace<Renderable>(player, nullptr, frames, false, PLAYER_SPRITE_WIDTH,
+                            PLAYER_SPRITE_HEIGHT);
+    reg.emplace<PlayerTag>(player);
+    reg.emplace<Health>(player);
+    reg.emplace<Collider>(player, colW, colH);
+    reg.emplace<RenderOffset>(player, -PLAYER_BODY_INSET_X, -PLAYER_BODY_INSET_TOP);
+    PlayerBaseCollider base;
+    base.standW     = colW;
+    base.standH     = colH;
+    base.standRoffX = -PLAYER_BODY_INSET_X;
+    base.standRoffY = -PLAYER_BODY_INSET_TOP;
+    base.duckW      = colW;
+    base.duckH      = colH / 2;
+    base.duckRoffX  = -PLAYER_BODY_INSET_X;
+    base.duckRoffY  = -(PLAYER_SPRITE_HEIGHT - base.duckH);
+    reg.emplace<PlayerBaseCollider>(player, base);
+    reg.emplace<InvincibilityTimer>(player);
+    GravityState gs;
+    if (level.gravityMode == GravityMode::OpenWorld) {
+        gs.active     = false;
+        gs.isGrounded = true;
+        reg.emplace<OpenWorldTag>(player);
+    }
+    reg.emplace<GravityState>(player, gs);
+    reg.emplace<ClimbState>(player);
+    reg.emplace<HazardState>(player);
+    reg.emplace<AttackState>(player);
+    AnimationSet set;
+    set.idle = set.walk = set.jump = set.hurt = set.duck = set.front = set.slash = frames;
+    reg.emplace<AnimationSet>(player, std::move(set));
+}
+
+void Spawn(World& w, const Level& level) {
+    auto& reg     = w.reg;
+    w.gravityMode = level.gravityMode;
+
+    const auto coinFrames = Frames(30, COIN_SIZE, COIN_SIZE);
+    for (const auto& c : level.coins) {
+        auto coin = reg.create();
+        reg.emplace<Transform>(coin, c.x, c.y);
+        reg.emplace<PrevTransform>(coin, c.x, c.y);
+        reg.emplace<Renderable>(coin, nullptr, coinFrames, false);
+        reg.emplace<AnimationState>(coin, 0, (int)coinFrames.size(), 0.0f, 15.0f, true);
+        reg.emplace<Collider>(coin, COIN_SIZE, COIN_SIZE);
+        reg.emplace<CoinTag>(coin);
+    }
+
+    // Level bounds, as GameScene::Spawn() computes them.
+    w.levelW = (float)w.viewW;
+    w.levelH = (float)w.viewH;
+    for (const auto& ts : level.tiles) {
+        float right = ts.x + ts.w, bottom = ts.y + ts.h;
+        if (ts.HasMoving()) {
+            if (ts.moving->horiz)
+                right = std::max(right, ts.x + ts.moving->range + ts.w);
+            else
+                bottom = std::max(bottom, ts.y + ts.moving->range + ts.h);
+        }
+        w.levelW = std::max(w.levelW, right);
+        w.levelH = std::max(w.levelH, bottom);
+    }
+    w.levelW += w.viewW * 0.25f;
+    w.levelH += w.viewH * 0.25f;
+
+    SpawnPlayer(w, level);
+
+    for (const auto& ts : level.tiles) {
+        auto tile = SpawnTileEntity(reg, ts);
+        reg.emplace<Renderable>(tile, nullptr, Frames(1, ts.w, ts.h), false, ts.w, ts.h);
+        reg.emplace<AnimationState>(tile, 0, 1, 0.0f, 1.0f, false);
+    }
+
+    const auto slimeFrames = Frames(8, SLIME_SPRITE_WIDTH, SLIME_SPRITE_HEIGHT);
+    for (const auto& es : level.enemies) {
+        auto enemy = SpawnEnemyEntity(reg, es);
+        reg.emplace<AnimationState>(enemy, 0, (int)slimeFrames.size(), 0.0f, 7.0f, true);
+        reg.emplace<Renderable>(enemy, nullptr, slimeFrames, false);
+        reg.emplace<Collider>(enemy, SLIME_SPRITE_WIDTH, SLIME_SPRITE_HEIGHT);
+        Health eh;
+        eh.current = SLIME_MAX_HEALTH;
+        eh.max     = SLIME_MAX_HEALTH;
+        reg.emplace<Health>(enemy, eh);
+    }
+
+    w.tiles   = level.tiles.size();
+    w.enemies = level.enemies.size();
+    w.coins   = level.coins.size();
+}
+
+// ── Scripted input ───────────────────────────────────────────────────────────
+// A fixed 4-second loop: run right, run left, hop every half second, slash
+// every second, crouch once. Deterministic, so runs are comparable.
+Uint16 ScriptedKeys(int tick) {
+    const int t    = ((tick % 480) + 480) % 480;
+    Uint16    held = 0;
+    auto      hold = [&](InputKey k, bool on) {
+        if (on)
+            held |= InputFrame::Bit(k);
+    };
+    hold(InputKey::D, t < 200);
+    hold(InputKey::A, t >= 200 && t < 440);
+    hold(InputKey::Space, t % 60 >= 30 && t % 60 < 36);
+    hold(InputKey::F, t % 120 == 90);
+    hold(InputKey::LCtrl, t >= 300 && t < 330);
+    return held;
+}
+
+InputFrame ScriptedInput(int tick) {
+    const Uint16 now = ScriptedKeys(tick), before = ScriptedKeys(tick - 1);
+    return {now, (Uint16)(now & ~before), (Uint16)(before & ~now)};
+}
+
+// ── Pipeline ─────────────────────────────────────────────────────────────────
+// GameScene::Update() order. Scene-local bookkeeping (enemy anim recovery,
+// power-ups, hazards, camera) is not part of the system set and is skipped;
+// a dead player keeps being simulated rather than ending the run.
+struct Pipeline {
+    std::vector<Stage> stages;
+
+    Pipeline() {
+        for (const char* n : {"PrevTransform", "InputSystem", "MovingPlatformTick",
+                              "FloatingSystem", "LadderSystem", "PlayerStateSystem",
+                              "MovementSystem", "BoundsSystem", "AnimationSystem",
+                              "CollisionSystem", "MovingPlatformCarry", "JumpSystem"})
+            stages.push_back({n, {}});
+    }
+
+    void Tick(World& w, const InputFrame& input, float dt, bool measure) {
+        auto& reg = w.reg;
+        int   i   = 0;
+        auto  run = [&](auto&& fn) {
+            const AllocCounts a0 = AllocTracker::Thread();
+            const Uint64      t0 = SDL_GetPerformanceCounter();
+            fn();
+            const Uint64 t1 = SDL_GetPerformanceCounter();
+            if (measure) {
+                const AllocCounts spent = AllocTracker::Thread() - a0;
+                stages[i].samples.push_back(t1 - t0);
+                stages[i].allocs.count += spent.count;
+                stages[i].allocs.bytes += spent.bytes;
+            }
+            ++i;
+        };
+
+        // SceneManager::Update() snapshots PrevTransform before each tick.
+        run([&] {
+            auto view = reg.view<Transform, PrevTransform>();
+            view.each([](const Transform& t, PrevTransform& p) {
+                p.x = t.x;
+                p.y = t.y;
+            });
+        });
+        run([&] { InputSystem(reg, input); });
+
+        FloatingResult floatResult;
+        run([&] { MovingPlatformTick(reg, dt); });
+        run([&] { floatResult = FloatingSystem(reg, dt); });
+        run([&] { LadderSystem(reg, dt, input); });
+        run([&] { PlayerStateSystem(reg); });
+        run([&] { MovementSystem(reg, dt, w.viewW, input); });
+        run([&] {
+            BoundsSystem(reg, dt, w.viewW, w.viewH,
+                         w.gravityMode == GravityMode::WallRun, w.levelW, w.levelH);
+        });
+        run([&] { AnimationSystem(reg, dt); });
+        run([&] { CollisionSystem(reg, dt, w.viewW, w.viewH); });
+        run([&] { MovingPlatformCarry(reg); });
+        run([&] {
+            if (w.gravityMode != GravityMode::OpenWorld)
+                JumpSystem(reg);
+        });
+    }
+};
+
+// ── Synthetic scenarios ──────────────────────────────────────────────────────
+// Deterministic LCG so generated levels are identical on every platform
+// (rand() sequences differ between C runtimes).
+struct Lcg {
+    Uint32 state;
+    Uint32 Next() { return state = state * 1664525u + 1013904223u; }
+    int    Range(int lo, int hi) { return lo + (int)(Next() >> 8) % (hi - lo + 1); }
+};
+
+TileSpawn Tile(int cx, int cy) {
+    TileSpawn t;
+    t.x         = (float)(cx * TILE);
+    t.y         = (float)(cy * TILE);
+    t.w         = TILE;
+    t.h         = TILE;
+    t.imagePath = "synthetic.png";
+    return t;
+}
+
+// A solid floor `cols` tiles wide along row `row`, player standing on it.
+void Floor(Level& l, int cols, int row) {
+    for (int c = 0; c < cols; ++c)
+        l.tiles.push_back(Tile(c, row));
+    l.player = {(float)(TILE * 2), (float)(row * TILE - PLAYER_SPRITE_HEIGHT)};
+}
+
+// ~`count` tiles of floating platforms over a 250 x 60 cell area, with a
+// sprinkling of hazards, ladders, slopes, props and coins.
+void AddTiles(Level& l, int count, Lcg& rng) {
+    Floor(l, 250, 60);
+    while ((int)l.tiles.size() < count) {
+        const int len = rng.Range(3, 10);
+        const int c0 = rng.Range(0, 240), row = rng.Range(2, 58);
+        const int kind = rng.Range(0, 99);
+        for (int c = c0; c < c0 + len && (int)l.tiles.size() < count; ++c) {
+            TileSpawn t = Tile(c, row);
+            if (kind < 5)
+                t.hazard = true;
+            else if (kind < 7)
+                t.ladder = true;
+            else if (kind < 9)
+                t.slope = SlopeData{};
+            else if (kind < 14)
+                t.prop = true;
+            l.tiles.push_back(std::move(t));
+        }
+        if (kind % 4 == 0)
+            l.coins.push_back({(float)(c0 * TILE), (float)((row - 1) * TILE)});
+    }
+}
+
+// `count` enemies patrolling a long floor, 10% of them floating.
+void AddEnemies(Level& l, int count, Lcg& rng) {
+    if (l.tiles.empty())
+        Floor(l, 400, 60);
+    for (int i = 0; i < count; ++i) {
+        EnemySpawn e{};
+        e.x           = (float)rng.Range(4 * TILE, 240 * TILE);
+        e.y           = (float)(60 * TILE - SLIME_SPRITE_HEIGHT);
+        e.speed       = (float)rng.Range(40, 120);
+        e.startLeft   = (i % 2) != 0;
+        e.antiGravity = (i % 10) == 0;
+        l.enemies.push_back(e);
+    }
+}
+
+// `groups` moving platforms of 4 tiles each: a mix of sine / ping-pong,
+// horizontal / vertical, and player-triggered.
+void AddPlatformGroups(Level& l, int groups, Lcg& rng) {
+    if (l.tiles.empty())
+        Floor(l, 250, 60);
+    for (int g = 0; g < groups; ++g) {
+        MovingPlatformData mp;
+        mp.horiz   = (g % 2) == 0;
+        mp.loop    = (g % 3) == 0;
+        mp.trigger = (g % 10) == 0;
+        mp.range   = (float)rng.Range(48, 240);
+        mp.speed   = (float)rng.Range(30, 150);
+        mp.phase   = (float)rng.Range(0, 100) / 100.0f;
+        mp.groupId = g + 1;
+        const int c0 = rng.Range(0, 240), row = rng.Range(2, 58);
+        for (int k = 0; k < 4; ++k) {
+            TileSpawn t = Tile(c0 + k, row);
+            t.moving    = mp;
+            l.tiles.push_back(std::move(t));
+        }
+    }
+}
+
+struct Scenario {
+    std::string                 name;
+    std::string                 path; // level file, or empty for generated
+    std::function<void(Level&)> build;
+    std::shared_ptr<Replay>     replay; // recorded input instead of the script
+};
+
+std::vector<Scenario> SyntheticScenarios() {
+    return {
+        {"synthetic/tiles-10k", "", [](Level& l) { Lcg r{1}; AddTiles(l, 10000, r); }},
+        {"synthetic/enemies-1k", "", [](Level& l) { Lcg r{2}; AddEnemies(l, 1000, r); }},
+        {"synthetic/platforms-500", "",
+         [](Level& l) { Lcg r{3}; AddPlatformGroups(l, 500, r); }},
+        {"synthetic/stress", "",
+         [](Level& l) {
+             Lcg r{4};
+             AddTiles(l, 10000, r);
+             AddEnemies(l, 1000, r);
+             AddPlatformGroups(l, 500, r);
+         }},
+    };
+}
+
+// ── Run ──────────────────────────────────────────────────────────────────────
+struct StageResult {
+    const char* name;
+    double      meanNs, p99Ns, allocs, bytes; // per tick
+};
+
+struct Result {
+    std::string              name;
+    bool                     generated = false, chunked = false;
+    size_t                   entities = 0, tiles = 0, enemies = 0, coins = 0;
+    int                      ticks = 0, warmup = 0;
+    float                    dt      = 0.0f; // seconds per tick
+    double                   parseMs = 0.0, spawnMs = 0.0;
+    std::vector<StageResult> stages;
+    double                   totalNs = 0.0, allocs = 0.0, bytes = 0.0; // per tick
+
+    double LoadMs() const { return parseMs + spawnMs; }
+};
+
+bool Run(const Scenario& sc, const Options& opt, Result& out) {
+    Level        level;
+    const Uint64 p0 = SDL_GetPerformanceCounter();
+    if (!sc.path.empty()) {
+        if (!LoadLevel(sc.path, level))
+            return false;
+    } else {
+        sc.build(level);
+    }
+    const Uint64 p1 = SDL_GetPerformanceCounter();
+
+    // A replay runs once, start to finish, from the seed, window size and
+    // tick rate it was recorded with.
+    World w;
+    int   warmup = opt.warmup, ticks = opt.ticks;
+    float dt     = 1.0f / opt.tickHz;
+    if (sc.replay) {
+        warmup = 0;
+        ticks  = (int)sc.replay->frames.size();
+        if (sc.replay->tickDt > 0.0f)
+            dt = sc.replay->tickDt;
+        if (sc.replay->viewW > 0 && sc.replay->viewH > 0) {
+            w.viewW = sc.replay->viewW;
+            w.viewH = sc.replay->viewH;
+        }
+    }
+    srand(sc.replay ? sc.replay->seed : opt.seed);
+    Spawn(w, level);
+    const Uint64 p2 = SDL_GetPerformanceCounter();
+
+    auto input = [&](int t) {
+        return sc.replay ? sc.replay->frames[t] : ScriptedInput(t);
+    };
+    Pipeline pipe;
+    for (auto& s : pipe.stages)
+        s.samples.reserve(ticks);
+    for (int t = 0; t < warmup; ++t)
+        pipe.Tick(w, input(t), dt, false);
+    for (int t = 0; t < ticks; ++t)
+        pipe.Tick(w, input(warmup + t), dt, true);
+
+    out           = Result{};
+    out.name      = sc.name;
+    out.generated = sc.path.empty();
+    out.chunked   = level.IsChunked();
+    out.entities  = w.reg.view<Transform>().size();
+    out.tiles     = w.tiles;
+    out.enemies   = w.enemies;
+    out.coins     = w.coins;
+    out.ticks     = ticks;
+    out.warmup    = warmup;
+    out.dt        = dt;
+    out.parseMs   = (p1 - p0) * NsPerTick() / 1e6;
+    out.spawnMs   = (p2 - p1) * NsPerTick() / 1e6;
+    for (const auto& s : pipe.stages) {
+        out.stages.push_back(
+            {s.name, s.MeanNs(), s.P99Ns(), s.AllocsPerTick(), s.BytesPerTick()});
+        out.totalNs += s.MeanNs();
+        out.allocs += s.AllocsPerTick();
+        out.bytes += s.BytesPerTick();
+    }
+    return true;
+}
+
+// Best of opt.runs: the fastest tick total, and the fastest parse and spawn
+// separately (they are noisy on their own). Allocations don't vary by run.
+bool RunBest(const Scenario& sc, const Options& opt, Result& best) {
+    for (int r = 0; r < opt.runs; ++r) {
+        Result res;
+        if (!Run(sc, opt, res))
+            return false;
+        if (r == 0) {
+            best = std::move(res);
+            continue;
+        }
+        const double parseMs = std::min(best.parseMs, res.parseMs);
+        const double spawnMs = std::min(best.spawnMs, res.spawnMs);
+        if (res.totalNs < best.totalNs)
+            best = std::move(res);
+        best.parseMs = parseMs;
+        best.spawnMs = spawnMs;
+    }
+    return true;
+}
+
+// ── Report ───────────────────────────────────────────────────────────────────
+void Report(const Result& res, std::FILE* csv) {
+    const bool allocs = AllocTracker::Enabled();
+    // Allocation columns as text: empty in the CSV when not tracked.
+    auto allocCsv = [&](double a, double b) {
+        char buf[64] = "";
+        if (allocs)
+            std::snprintf(buf, sizeof(buf), "%.3f,%.1f", a, b);
+        else
+            std::snprintf(buf, sizeof(buf), ",");
+        return std::string(buf);
+    };
+
+    std::print("\n== {}{}\n", res.name,
+               res.chunked ? "  (chunked: resident tiles only)" : "");
+    std::print("   {} entities: {} tiles, {} enemies, {} coins | {} ({} warmup) ticks\n",
+               res.entities, res.tiles, res.enemies, res.coins, res.ticks, res.warmup);
+    std::print("   load {:.2f} ms parse{} + {:.2f} ms spawn\n", res.parseMs,
+               res.generated ? " (generated)" : "", res.spawnMs);
+    std::print("   {:<22}{:>12}{:>12}{:>8}", "system", "ns/tick", "p99 ns", "share");
+    if (allocs)
+        std::print("{:>13}{:>11}", "allocs/tick", "B/tick");
+    std::print("\n");
+    for (const auto& s : res.stages) {
+        std::print("   {:<22}{:>12.0f}{:>12.0f}{:>7.1f}%", s.name, s.meanNs, s.p99Ns,
+                   res.totalNs > 0.0 ? 100.0 * s.meanNs / res.totalNs : 0.0);
+        if (allocs)
+            std::print("{:>13.2f}{:>11.0f}", s.allocs, s.bytes);
+        std::print("\n");
+        if (csv)
+            std::fprintf(csv, "%s,%s,%.0f,%.0f,%s\n", res.name.c_str(), s.name, s.meanNs,
+                         s.p99Ns, allocCsv(s.allocs, s.bytes).c_str());
+    }
+    std::print("   {:<22}{:>12.0f}   ({:.1f}% of a {:.2f} ms tick)\n", "total", res.totalNs,
+               100.0 * res.totalNs / (res.dt * 1e9), res.dt * 1e3);
+    if (allocs)
+        std::print("   {:<22}{:>12.2f}   ({:.0f} bytes/tick{})\n", "allocations",
+                   res.allocs, res.bytes,
+                   res.allocs > 0.0 ? "; steady state should be 0" : "");
+    if (csv) {
+        std::fprintf(csv, "%s,_total,%.0f,0,%s\n", res.name.c_str(), res.totalNs,
+                     allocCsv(res.allocs, res.bytes).c_str());
+        std::fprintf(csv, "%s,_parse,%.0f,0,,\n", res.name.c_str(), res.parseMs * 1e6);
+        std::fprintf(csv, "%s,_spawn,%.0f,0,,\n", res.name.c_str(), res.spawnMs * 1e6);
+    }
+}
+
+// ── Baselines ────────────────────────────────────────────────────────────────
+// perf/baseline.json (see --baseline / --write-baseline):
+//
+//   { "tolerance": { "tick_pct": 15, "tick_ns": 300, "load_pct": 35,
+//                    "load_ms": 2, "allocs_per_tick": 0.01 },
+//     "scenarios": { "levels/Magical.json": { "ns_per_tick": 41230,
+//                    "load_ms": 6.1, "allocs_per_tick": 0, "stages": {...} },
+//                    ... } }
+//
+// A metric regresses when it exceeds baseline * (1 + pct / 100) + the
+// absolute slack; the slack keeps near-zero stages and tiny levels from
+// failing on timer noise. allocs_per_tick is only stored and compared when
+// both sides were built with allocation tracking. Timings are specific to
+// the machine and build type that recorded them.
+struct Tolerance {
+    double tickPct = 15.0, tickNs = 300.0;
+    double loadPct = 35.0, loadMs = 2.0;
+    double allocs  = 0.01;
+};
+
+Tolerance ToleranceFromJson(const json& j) {
+    Tolerance t;
+    t.tickPct = j.value("tick_pct", t.tickPct);
+    t.tickNs  = j.value("tick_ns", t.tickNs);
+    t.loadPct = j.value("load_pct", t.loadPct);
+    t.loadMs  = j.value("load_ms", t.loadMs);
+    t.allocs  = j.value("allocs_per_tick", t.allocs);
+    return t;
+}
+
+json ToleranceToJson(const Tolerance& t) {
+    return {{"tick_pct", t.tickPct}, {"tick_ns", t.tickNs}, {"load_pct", t.loadPct},
+            {"load_ms", t.loadMs},   {"allocs_per_tick", t.allocs}};
+}
+
+bool ReadJson(const std::string& path, json& out) {
+    std::ifstream file(path);
+    if (!file.is_open())
+        return false;
+    try {
+        file >> out;
+    } catch (const json::parse_error& e) {
+        std::print("forge2d_bench: {}: {}\n", path, e.what());
+        return false;
+    }
+    return out.is_object();
+}
+
+// Merge `results` into the baseline file, keeping its tolerances and any
+// scenarios not re-run.
+bool WriteBaseline(const std::string& path, const std::vector<Result>& results) {
+    json j;
+    if (!ReadJson(path, j))
+        j = json::object();
+    if (!j.contains("tolerance"))
+        j["tolerance"] = ToleranceToJson(Tolerance{});
+
+    for (const auto& res : results) {
+        json stages = json::object();
+        for (const auto& s : res.stages)
+            stages[s.name] = std::round(s.meanNs);
+        json& e          = j["scenarios"][res.name];
+        e                = json::object();
+        e["ns_per_tick"] = std::round(res.totalNs);
+        e["load_ms"]     = std::round(res.LoadMs() * 100.0) / 100.0;
+        if (AllocTracker::Enabled())
+            e["allocs_per_tick"] = res.allocs;
+        e["stages"] = std::move(stages);
+    }
+
+    std::error_code ec;
+    if (fs::path(path).has_parent_path())
+        fs::create_directories(fs::path(path).parent_path(), ec);
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::print("forge2d_bench: cannot write {}\n", path);
+        return false;
+    }
+    file << j.dump(4) << '\n';
+    std::print("\nBaseline: {} scenario(s) written to {}\n", results.size(), path);
+    return true;
+}
+
+// Print the comparison; false when any metric is over its limit.
+bool Check(const Result& res, const json& entry, const Tolerance& tol) {
+    bool ok = true;
+    auto compare = [&](const char* what, double now, double base, double pct,
+                       double slack, const char* unit) {
+        const double limit = base * (1.0 + pct / 100.0) + slack;
+        const bool   pass  = now <= limit;
+        std::print("   {:<5} {:<16}{:>12.2f}{:>12.2f}{:>12.2f} {:<6}{:>+8.1f}%\n",
+                   pass ? "ok" : "FAIL", what, now, base, limit, unit,
+                   base > 0.0 ? 100.0 * (now - base) / base : 0.0);
+        ok = ok && pass;
+    };
+
+    std::print("\n   {:<5} {:<16}{:>12}{:>12}{:>12}\n", "check", "metric", "now",
+               "baseline", "limit");
+    compare("ns/tick", res.totalNs, entry.value("ns_per_tick", 0.0), tol.tickPct,
+            tol.tickNs, "ns");
+    compare("load", res.LoadMs(), entry.value("load_ms", 0.0), tol.loadPct, tol.loadMs,
+            "ms");
+    if (AllocTracker::Enabled() && entry.contains("allocs_per_tick"))
+        compare("allocs/tick", res.allocs, entry.value("allocs_per_tick", 0.0), 0.0,
+                tol.allocs, "");
+    else
+        std::print("   {:<5} {:<16}(needs a tracked build and baseline)\n", "-",
+                   "allocs/tick");
+
+    // Not a gate, a pointer: which system grew the most.
+    if (!ok && entry.contains("stages")) {
+        const StageResult* worst = nullptr;
+        double             grew  = 0.0;
+        for (const auto& s : res.stages) {
+            const double d = s.meanNs - entry["stages"].value(s.name, s.meanNs);
+            if (d > grew) {
+                grew  = d;
+                worst = &s;
+            }
+        }
+        if (worst)
+            std::print("   largest growth: {} +{:.0f} ns/tick\n", worst->name, grew);
+    }
+    return ok;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!ParseArgs(argc, argv, opt))
+        return 2;
+
+    std::vector<Scenario> scenarios;
+    for (const auto& p : opt.replays) {
+        auto replay = std::make_shared<Replay>();
+        if (!LoadReplay(p, *replay))
+            return 2;
+        const std::string name = "replay/" + fs::path(p).stem().string();
+        scenarios.push_back({name, replay->levelPath, {}, replay});
+    }
+    if (opt.levels.empty() && opt.replays.empty()) {
+        std::error_code ec;
+        for (const auto& e : fs::directory_iterator("levels", ec))
+            if (e.path().extension() == ".json")
+                opt.levels.push_back(e.path().generic_string());
+        std::sort(opt.levels.begin(), opt.levels.end());
+    }
+    for (const auto& p : opt.levels)
+        scenarios.push_back({p, p, {}});
+    if (opt.synthetic)
+        for (auto& s : SyntheticScenarios())
+            scenarios.push_back(std::move(s));
+
+    json      baseline;
+    Tolerance tol;
+    if (!opt.baselinePath.empty()) {
+        if (!ReadJson(opt.baselinePath, baseline)) {
+            std::print("forge2d_bench: no baseline at {}; record one with "
+                       "--write-baseline {}\n",
+                       opt.baselinePath, opt.baselinePath);
+            return SKIP_EXIT;
+        }
+        tol = ToleranceFromJson(baseline.value("tolerance", json::object()));
+    }
+
+    std::FILE* csv = nullptr;
+    if (!opt.csvPath.empty()) {
+        csv = std::fopen(opt.csvPath.c_str(), "w");
+        if (!csv) {
+            std::print("forge2d_bench: cannot write {}\n", opt.csvPath);
+            return 2;
+        }
+        std::fprintf(csv, "scenario,stage,mean_ns,p99_ns,allocs_per_tick,bytes_per_tick\n");
+    }
+
+    std::vector<Result> results;
+    int                 ran = 0, regressed = 0, missing = 0;
+    for (const auto& sc : scenarios) {
+        if (!opt.only.empty() && sc.name.find(opt.only) == std::string::npos)
+            continue;
+        ++ran;
+        Result res;
+        if (!RunBest(sc, opt, res)) {
+            ++regressed; // a level that no longer loads is a failure too
+            continue;
+        }
+        Report(res, csv);
+        if (!opt.baselinePath.empty()) {
+            const json& all = baseline.value("scenarios", json::object());
+            if (!all.contains(res.name)) {
+                std::print("   not in baseline {}\n", opt.baselinePath);
+                ++missing;
+            } else if (!Check(res, all[res.name], tol)) {
+                ++regressed;
+            }
+        }
+        results.push_back(std::move(res));
+    }
+    if (csv)
+        std::fclose(csv);
+    if (ran == 0) {
+        std::print("forge2d_bench: no scenarios to run\n");
+        return 1;
+    }
+    if (!opt.writeBaselinePath.empty() && !WriteBaseline(opt.writeBaselinePath, results))
+        return 2;
+
+    if (!opt.baselinePath.empty()) {
+        std::print("\n{} scenario(s): {} regressed, {} without a baseline\n", ran,
+                   regressed, missing);
+        if (regressed > 0)
+            return 1;
+        if (missing > 0)
+            return SKIP_EXIT;
+    }
+    return 0;
+}
@@ -8,9 +8,10 @@
 //   - An ordered list of PNG frame paths
 //   - A frames-per-second playback rate
 //
-// At runtime every placed tile that references an animated tile manifest
-// (.json inside animated_tiles/) gets a runtime AnimatedTileState — a simple
-// frame counter that the GameScene and LevelEditorScene tick each Update().
+// AnimatedTileState is a simple per-instance frame counter (see
+// TickAnimatedTile). In-game tiles that reference an animated tile manifest
+// (.json inside animated_tiles/) don't use it: GameScene shares one atlas per
+// manifest through AnimatedTileLibrary and derives frames from a single clock.
 //
 // Storage layout on disk:
 //   game_assets/tiles/animated_tiles/<Name>.json
@@ -19,6 +20,7 @@
 // The editor and game detect it via the IsAnimatedTile() helper below.
 // ────────────────────────────────────────────────────────────────────────────
 
+#include "TraceRecorder.hpp"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
 #include <algorithm>
@@ -166,6 +168,7 @@ inline std::vector<SDL_Surface*> LoadAnimatedTileFrames(const AnimatedTileDef& d
     std::vector<SDL_Surface*> result;
     result.reserve(def.framePaths.size());
     for (const auto& p : def.framePaths) {
+        TRACE_SCOPE("asset", "AnimatedTile frame", p);
         SDL_Surface* raw = IMG_Load(p.c_str());
         if (!raw) { result.push_back(nullptr); continue; }
         SDL_Surface* conv = SDL_ConvertSurface(raw, SDL_PIXELFORMAT_ARGB8888);
@@ -0,0 +1,92 @@
+#pragma once
+// AnimatedTileLibrary.hpp
+//
+// Level-scoped store of animated tile manifests, one GPU atlas per
+// (manifest, rotation). Every placed tile that uses the same animation
+// shares the entry and only carries an AnimatedTileRef (id + phase), so
+// there are no per-entity texture vectors and no per-entity frame ticking:
+// the current frame is a pure function of the library clock, which the
+// scene advances once per tick.
+//
+// Frames are laid out in a grid of equal cells (the largest frame's size)
+// with a transparent gutter so the PIXELART sampler never bleeds one frame
+// into its neighbour.
+//
+// Building an atlas is split in two so the expensive half can run off the
+// render thread: Stitch() parses the manifest and decodes and packs the
+// frames into a surface (any thread; the chunk streamer's worker does it
+// ahead of spawning), Adopt() uploads that surface and registers the entry.
+// Acquire() does both on the spot for anything not stitched in advance.
+#include "Components.hpp"
+#include <SDL3/SDL.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class AnimatedTileLibrary {
+  public:
+    struct Anim {
+        std::string           path;
+        int                   rotation = 0;
+        SDL_Texture*          atlas    = nullptr; // owned
+        std::vector<SDL_Rect> frames;             // src rect of each frame in atlas
+        float                 fps      = 8.0f;
+    };
+
+    // CPU side of an entry: the packed atlas surface, not yet uploaded.
+    struct Stitched {
+        std::string           path;
+        int                   rotation = 0;
+        SDL_Surface*          atlas    = nullptr; // owned until Adopt(); null = failed
+        std::vector<SDL_Rect> frames;
+        float                 fps      = 8.0f;
+    };
+
+    AnimatedTileLibrary() = default;
+    ~AnimatedTileLibrary() { Clear(); }
+
+    AnimatedTileLibrary(const AnimatedTileLibrary&)            = delete;
+    AnimatedTileLibrary& operator=(const AnimatedTileLibrary&) = delete;
+
+    // Returns the id for a manifest, loading + packing it on first request.
+    // Returns -1 if the manifest or all of its frames failed to load; the
+    // failure is cached so it is reported once and never retried.
+    int Acquire(SDL_Renderer* ren, const std::string& manifestPath, int rotation = 0);
+
+    // Loads and packs a manifest into `out`. Touches neither the renderer nor
+    // the library, so it is safe on a worker thread. False on failure.
+    static bool Stitch(const std::string& manifestPath, int rotation, Stitched& out);
+
+    // Uploads a stitched atlas and returns its id like Acquire(); a failed
+    // Stitch() is cached as a failure. Frees the surface either way, and is a
+    // lookup if the manifest was acquired meanwhile.
+    int Adopt(SDL_Renderer* ren, Stitched& stitched);
+
+    // Library key of a manifest + rotation.
+    static std::string Key(const std::string& manifestPath, int rotation);
+
+    const Anim* Get(int id) const {
+        return (id >= 0 && id < (int)mAnims.size()) ? &mAnims[id] : nullptr;
+    }
+
+    // ── Global clock ────────────────────────────────────────────────────────
+    void   Advance(float dt) { mClock += dt; }
+    double Clock() const { return mClock; }
+
+    // Frame index for a ref at the current clock. Looping refs cycle offset
+    // by their phase; one-shot refs hold the last frame once they reach it.
+    int FrameIndex(const AnimatedTileRef& ref) const;
+    // True once a one-shot ref has shown its last frame for a full frame time.
+    bool Finished(const AnimatedTileRef& ref) const;
+
+    // Atlas + src rect for a ref at the current clock (nullptr if unknown id).
+    SDL_Texture* Resolve(const AnimatedTileRef& ref, SDL_Rect& src) const;
+
+    int  Count() const { return (int)mAnims.size(); }
+    void Clear();
+
+  private:
+    std::vector<Anim>                    mAnims; // index = id
+    std::unordered_map<std::string, int> mIds;   // "path|rROT" -> id (-1 = failed)
+    double                               mClock = 0.0;
+};
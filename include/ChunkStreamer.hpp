@@ -0,0 +1,159 @@
+#pragma once
+#include "AnimatedTileLibrary.hpp"
+#include "LevelData.hpp"
+#include <SDL3/SDL.h>
+#include <condition_variable>
+#include <deque>
+#include <entt/entt.hpp>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ChunkStreamer
+//
+// Keeps the tiles of a chunked level (see ChunkedLevel.hpp) resident only
+// around the camera.
+//
+//   prefetch ring  (view + PREFETCH_RING chunks) — chunk JSON parsed, tile
+//                  images decoded to surfaces and animated tile atlases
+//                  (live and destroy animations) stitched on a background
+//                  thread; the atlases are uploaded into the scene's
+//                  AnimatedTileLibrary as soon as they arrive
+//   spawn ring     (view + SPAWN_RING chunks)    — surfaces uploaded, tile
+//                  entities + colliders created via the SpawnFn
+//
+// Chunks that leave the prefetch ring are despawned and dropped entirely; the
+// gap between the two rings is hysteresis so walking back and forth across a
+// chunk edge doesn't thrash. Textures are ref-counted across chunks by image
+// path + rotation and destroyed once no spawned chunk uses them, so memory is
+// bounded by the rings rather than by the world size.
+//
+// Action tiles broken while their chunk was spawned stay broken when it
+// streams back in. All public methods run on the main (render) thread; the
+// worker only parses files and decodes surfaces, never touches SDL_Renderer,
+// the registry or the AnimatedTileLibrary. Each animated manifest is
+// stitched once per streamer, by whichever chunk meets it first.
+// ─────────────────────────────────────────────────────────────────────────────
+class ChunkStreamer {
+  public:
+    // Returns a texture for a tile image; the streamer owns it.
+    using TextureFn = std::function<SDL_Texture*(const std::string& path, int rot)>;
+    // Creates the entity for one tile (entt::null if it could not be spawned).
+    using SpawnFn = std::function<entt::entity(const TileSpawn&, const TextureFn&)>;
+    // Destroys one tile entity created by SpawnFn (plus any scene-side bookkeeping).
+    using DespawnFn = std::function<void(entt::entity)>;
+
+    ChunkStreamer(SDL_Renderer* ren, entt::registry& reg, AnimatedTileLibrary& anims,
+                  const std::string& levelPath, const LevelChunking& chunking,
+                  SpawnFn spawn, DespawnFn despawn);
+    ~ChunkStreamer();
+
+    ChunkStreamer(const ChunkStreamer&)            = delete;
+    ChunkStreamer& operator=(const ChunkStreamer&) = delete;
+
+    // Streams chunks in/out for the given world-space view. Spawns at most
+    // MAX_SPAWNS_PER_UPDATE chunks per call. Returns true if any tile entity
+    // was created or destroyed (callers rebuild render lists).
+    bool Update(const SDL_FRect& view);
+
+    // Synchronously loads and spawns the spawn ring (level start / respawn),
+    // so the player never drops through a floor that hasn't streamed in yet.
+    // Calling it every tick instead of Update() makes streaming independent
+    // of worker timing (replays). Returns true like Update().
+    bool Prime(const SDL_FRect& view);
+
+    // The registry was cleared behind our back (GameScene::Respawn). Forget all
+    // spawned entities and broken action tiles; textures stay resident until
+    // the next Prime()/Update() has had a chance to reuse them.
+    void ResetSpawned();
+
+    // True if world point (x, y) lies in a chunk of this level whose tiles
+    // are not spawned right now. GameScene keeps enemies there dormant, so
+    // they neither fall nor walk through the missing ground.
+    bool Unspawned(float x, float y) const;
+
+    int SpawnedChunks() const;
+    int ResidentChunks() const { return (int)mChunks.size(); }
+    int TextureCount() const { return (int)mTextures.size(); }
+
+    static constexpr int SPAWN_RING            = 1;
+    static constexpr int PREFETCH_RING         = 2;
+    static constexpr int MAX_SPAWNS_PER_UPDATE = 1;
+
+  private:
+    struct CoordHash {
+        size_t operator()(ChunkCoord c) const {
+            return std::hash<long long>{}(((long long)c.cx << 32) ^ (unsigned)c.cy);
+        }
+    };
+
+    // Output of the worker thread for one chunk.
+    struct Prepared {
+        ChunkCoord                                    coord;
+        std::vector<TileSpawn>                        tiles;
+        std::unordered_map<std::string, SDL_Surface*> surfaces; // key = TexKey()
+        std::vector<AnimatedTileLibrary::Stitched>    anims;    // first seen here
+    };
+
+    enum class State { Queued, Ready, Spawned };
+
+    struct Chunk {
+        State                                         state = State::Queued;
+        std::vector<TileSpawn>                        tiles;
+        std::unordered_map<std::string, SDL_Surface*> surfaces; // not yet uploaded
+        std::vector<entt::entity>                     entities; // parallel to tiles
+        std::vector<std::string>                      texRefs;  // keys acquired on spawn
+    };
+
+    struct TexEntry {
+        SDL_Texture* tex  = nullptr;
+        int          refs = 0;
+    };
+
+    static std::string TexKey(const std::string& path, int rot);
+    static void        FreeSurfaces(std::unordered_map<std::string, SDL_Surface*>& s);
+    static void        FreeAnims(std::vector<AnimatedTileLibrary::Stitched>& anims);
+
+    Prepared PrepareChunk(const std::string& file, ChunkCoord coord);
+    bool     ClaimAnim(const std::string& key);
+    void     AdoptAnims(std::vector<AnimatedTileLibrary::Stitched>& anims);
+
+    void WorkerLoop();
+    void Request(ChunkCoord c);
+    void DrainReady();
+    void SpawnChunk(Chunk& ch, ChunkCoord coord);
+    void DespawnChunk(Chunk& ch, ChunkCoord coord);
+    void ReleaseTexture(const std::string& key);
+    void CollectTextures();
+    bool InRing(ChunkCoord c, const SDL_FRect& view, int ring) const;
+
+    SDL_Renderer*        mRen;
+    entt::registry&      mReg;
+    AnimatedTileLibrary& mAnims;
+    std::string          mLevelPath;
+    LevelChunking        mChunking;
+    SpawnFn              mSpawn;
+    DespawnFn            mDespawn;
+
+    std::unordered_set<ChunkCoord, CoordHash>        mOnDisk; // manifest chunk list
+    std::unordered_map<ChunkCoord, Chunk, CoordHash> mChunks; // main thread only
+    std::unordered_map<std::string, TexEntry>        mTextures;
+    // Broken action tiles per chunk (tile index within the chunk file). Lives
+    // outside Chunk so it survives the chunk being dropped and re-streamed.
+    std::unordered_map<ChunkCoord, std::vector<bool>, CoordHash> mBroken;
+
+    // ── Worker thread state (guarded by mMutex) ─────────────────────────────
+    std::thread             mWorker;
+    std::mutex              mMutex;
+    std::condition_variable mCv;
+    std::deque<ChunkCoord>  mRequests;
+    std::vector<Prepared>   mReady;
+    bool                    mQuit = false;
+    // Animated manifests (library keys) some PrepareChunk() already stitched.
+    std::unordered_set<std::string> mAnimsClaimed;
+};
@@ -0,0 +1,125 @@
+#pragma once
+// ChunkedLevel.hpp
+//
+// On-disk format for chunked (streamed) levels.
+//
+//   levels/Foo.json                 normal level file + "chunks" block
+//   levels/Foo.chunks/c_<cx>_<cy>.json   {"tiles": [ ...same keys as Foo.json... ]}
+//
+// A tile belongs to the chunk containing its top-left corner:
+//   cx = floor(x / size), cy = floor(y / size)
+// Tiles larger than a chunk or moving platforms whose travel crosses a chunk
+// edge still work because ChunkStreamer keeps a ring of neighbouring chunks
+// spawned around the view.
+//
+// SaveLevelChunked() splits an ordinary level into this layout (used by the
+// `--chunk-level` command line mode in main.cpp). LoadChunkTiles() is safe to
+// call from a worker thread — it only touches the file it is given.
+#include "LevelData.hpp"
+#include "LevelSerializer.hpp"
+#include "LevelStreamLoader.hpp"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <print>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+inline ChunkCoord ChunkOf(float x, float y, int size) {
+    return {(int)std::floor(x / (float)size), (int)std::floor(y / (float)size)};
+}
+
+inline std::string ChunkFileName(ChunkCoord c) {
+    return "c_" + std::to_string(c.cx) + "_" + std::to_string(c.cy) + ".json";
+}
+
+// Absolute-ish path of a chunk file: the chunk dir is relative to the level file.
+inline std::string ChunkFilePath(const std::string& levelPath, const LevelChunking& ck,
+                                 ChunkCoord c) {
+    return (fs::path(levelPath).parent_path() / ck.dir / ChunkFileName(c)).string();
+}
+
+// Reads one chunk file's tiles (appended to `out`). No logging on success —
+// this runs once per chunk while the player moves.
+inline bool LoadChunkTiles(const std::string& path, std::vector<TileSpawn>& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        std::print("Failed to load chunk: {}\n", path);
+        return false;
+    }
+    Level           tmp;
+    LevelSaxHandler handler(tmp, {});
+    if (!json::sax_parse(file, &handler)) {
+        std::print("JSON parse error in {}: {}\n", path, handler.Error());
+        return false;
+    }
+    out.insert(out.end(), std::make_move_iterator(tmp.tiles.begin()),
+               std::make_move_iterator(tmp.tiles.end()));
+    return true;
+}
+
+// Splits `src` into a chunked level at `levelPath` (the manifest) plus a
+// sibling "<stem>.chunks" directory. Player, coins and enemies stay in the
+// manifest; every tile moves into its chunk file.
+inline bool SaveLevelChunked(const Level& src, const std::string& levelPath, int chunkSize) {
+    if (chunkSize <= 0) {
+        std::print("Invalid chunk size: {}\n", chunkSize);
+        return false;
+    }
+
+    const fs::path manifest = levelPath;
+    const fs::path chunkDir = manifest.parent_path() / (manifest.stem().string() + ".chunks");
+    std::error_code ec;
+    fs::create_directories(chunkDir, ec);
+    if (ec) {
+        std::print("Failed to create chunk dir {}: {}\n", chunkDir.string(), ec.message());
+        return false;
+    }
+
+    // Bucket by chunk; std::map keeps the manifest list in a stable order.
+    auto key = [](ChunkCoord c) { return std::pair{c.cy, c.cx}; };
+    std::map<std::pair<int, int>, std::vector<const TileSpawn*>> buckets;
+    LevelChunking ck;
+    ck.dir  = chunkDir.filename().string();
+    ck.size = chunkSize;
+    for (const auto& t : src.tiles) {
+        buckets[key(ChunkOf(t.x, t.y, chunkSize))].push_back(&t);
+        float right = t.x + t.w, bottom = t.y + t.h;
+        if (t.HasMoving()) {
+            if (t.moving->horiz)
+                right = std::max(right, t.x + t.moving->range + t.w);
+            else
+                bottom = std::max(bottom, t.y + t.moving->range + t.h);
+        }
+        ck.boundsW = std::max(ck.boundsW, right);
+        ck.boundsH = std::max(ck.boundsH, bottom);
+    }
+
+    for (const auto& [k, tiles] : buckets) {
+        ChunkCoord c{k.second, k.first};
+        json       j;
+        j["tiles"] = json::array();
+        for (const auto* t : tiles)
+            j["tiles"].push_back(TileSpawnToJson(*t));
+        std::ofstream file(chunkDir / ChunkFileName(c));
+        if (!file.is_open()) {
+            std::print("Failed to save chunk: {}\n", ChunkFileName(c));
+            return false;
+        }
+        file << j.dump();
+        ck.chunks.push_back(c);
+    }
+
+    Level out    = src;
+    out.tiles.clear();
+    out.chunking = std::move(ck);
+    if (!SaveLevel(out, levelPath))
+        return false;
+    std::print("Chunked {} tiles into {} chunks ({}px) under {}\n",
+               src.tiles.size(), out.chunking->chunks.size(), chunkSize, chunkDir.string());
+    return true;
+}
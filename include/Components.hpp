@@ -168,6 +168,7 @@ struct PlayerTag {};      // marks the player entity
 struct EnemyTag {};       // marks a live enemy entity
 struct CoinTag {};        // marks a collectible coin
 struct DeadTag {};        // marks a stomped enemy
+struct DormantTag {};     // enemy whose streamed chunk is not spawned: no gravity or AI
 struct FaceRightTag {};   // sprite art faces right by default (flip when moving left)
 
 // Tracks whether an enemy is currently playing its attack animation.
@@ -308,15 +309,30 @@ struct ActionTag {   // marks an action tile — rendered + collidable until the
 
 // Attached to an action tile the frame it is destroyed (hitsRemaining hits 0).
 // Signals that the tile is mid-death-animation: no longer solid/visible as a tile,
-// but the anim frames are being played. GameScene::Update() owns the frame counter
-// via tileAnimFrameMap (same mechanism as live animated tiles).
-// When the animation finishes the entity is fully destroyed (reg.destroy).
-struct DestroyAnimTag {
-    int   totalFrames  = 0;     // total frame count for the anim
-    float fps          = 8.0f;
-    bool  reachedEnd   = false; // true once currentFrame has hit totalFrames-1 for the first time
-    // Destruction is deferred one full tick after reachedEnd becomes true so
-    // the last frame is actually rendered at least once before the entity dies.
+// but its one-shot AnimatedTileRef is playing. GameScene::Update() destroys the
+// entity (reg.destroy) once AnimatedTileLibrary::Finished() reports the last
+// frame has been on screen for a full frame time.
+struct DestroyAnimTag {};
+
+// ── Shared animated tile reference ──────────────────────────────────────────
+// Points an entity at an AnimatedTileLibrary entry (one atlas per manifest).
+// The frame shown is computed from the library's global clock, so nothing
+// ticks per entity:
+//   looping:  frame = floor(clock * fps + phase * frameCount) % frameCount
+//   one-shot: frame = min(floor((clock - start) * fps), frameCount - 1)
+// RenderSystem substitutes the atlas + frame rect for Renderable's sheet/frame.
+struct AnimatedTileRef {
+    int    id    = -1;    // AnimatedTileLibrary id
+    float  phase = 0.0f;  // [0,1) cycle offset; 0 keeps identical tiles in sync
+    bool   loop  = true;  // false = one-shot (destroy anim), holds the last frame
+    double start = 0.0;   // library clock when a one-shot started
+};
+
+// Attached at spawn to action tiles with a destroy animation. The manifest is
+// resolved into the AnimatedTileLibrary then, so triggering the tile only swaps
+// components — no JSON parse, PNG decode or GPU upload inside the fixed-step tick.
+struct DestroyAnimRef {
+    int animId = -1; // AnimatedTileLibrary id
 };
 
 // ── Slope collision data ──────────────────────────────────────────────────────
@@ -353,9 +369,9 @@ struct MovingPlatformState {
     bool  triggered   = false; // becomes true once player has landed on it
 };
 
-// Marks a tile as an animated tile driven by tileAnimFrameMap in GameScene.
-// AnimationSystem skips entities with this tag so only GameScene::Update
-// advances the frame counter and swaps the sheet pointer.
+// Marks a tile as an animated tile driven by its AnimatedTileRef.
+// AnimationSystem skips entities with this tag: their frame comes from the
+// AnimatedTileLibrary clock, and AnimationState stays a static 1-frame stub.
 struct TileAnimTag {};
 
 // ── Hit flash ───────────────────────────────────────────────────────────────
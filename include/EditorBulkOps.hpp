@@ -0,0 +1,81 @@
+#pragma once
+// EditorBulkOps.hpp
+// ---------------------------------------------------------------------------
+// Multi-tile edits for the level editor: copy / cut / paste, stamping the
+// clipboard, flood fill, and deleting a selection.
+//
+// Each operation mutates Level::tiles in one pass (reserve + append, or a
+// single compaction) and records ONE batched undo op through
+// EditorHistory::AppendedRange / ErasingMany. Pasting a 100x20 block is one
+// vector growth, one history entry, and — because the scene marks the
+// spatial index and minimap dirty once per edited input event — one index
+// rebuild, instead of 2,000 single-tile insertions.
+//
+// EditorBulkOps is a pure-static helper, like EditorFileOps. Callers own the
+// undo transaction (the scene opens one per input event).
+// ---------------------------------------------------------------------------
+
+#include "EditorHistory.hpp"
+#include "EditorSpatialIndex.hpp"
+#include "LevelData.hpp"
+#include <SDL3/SDL.h>
+#include <vector>
+
+class EditorBulkOps {
+  public:
+    // Flood fill stops after this many tiles, so a click on open space at
+    // low zoom cannot create an unbounded number of them.
+    static constexpr int MAX_FILL_TILES = 8192;
+
+    // Copied tiles, positioned relative to the copy's top-left corner.
+    struct Clipboard {
+        std::vector<TileSpawn> tiles;
+        int                    w = 0, h = 0; // bounding box of `tiles`
+
+        [[nodiscard]] bool Empty() const { return tiles.empty(); }
+    };
+
+    // Copy tiles `indices` (any order) into a clipboard.
+    static Clipboard Copy(const Level& level, const std::vector<int>& indices);
+
+    // Append the clipboard with its top-left at world (x, y). Returns the
+    // index of the first pasted tile; they occupy [first, tiles.size()).
+    // Each distinct non-zero moving-platform and action group in the
+    // clipboard gets a fresh id unused in the level, so every copy moves and
+    // triggers on its own instead of joining the source's group. Action ids
+    // stay within 1..ActionData::MAX_GROUP; when no free one is left those
+    // tiles paste standalone and `ungrouped` is set to how many did.
+    static int Paste(Level& level, EditorHistory& history, const Clipboard& clip, float x,
+                     float y, int* ungrouped = nullptr);
+
+    // Erase tiles `indices` (any order, duplicates and out-of-range ignored).
+    // Returns how many were erased.
+    static int EraseTiles(Level& level, EditorHistory& history, std::vector<int> indices);
+
+    // Flood fill on the lattice of `proto`-sized cells through world point
+    // (wx, wy), limited to the world rect `bounds` (normally the visible
+    // canvas):
+    //   - on empty space, fills the 4-connected empty cells with copies of
+    //     `proto`; a cell is empty if no tile overlaps it.
+    //   - on a tile, re-skins the 4-connected run of tiles that share its
+    //     image and size with proto.imagePath.
+    // Returns the number of tiles added or changed; `truncated` is set when
+    // MAX_FILL_TILES cut the fill short.
+    static int FloodFill(Level& level, EditorHistory& history, EditorSpatialIndex& spatial,
+                         int grid, SDL_Rect bounds, int wx, int wy, const TileSpawn& proto,
+                         bool* truncated = nullptr);
+
+    // Floor division (lattice coordinates go negative left of / above the
+    // origin cell).
+    static constexpr int FloorDiv(int a, int b) {
+        return a / b - ((a % b != 0) && ((a < 0) != (b < 0)));
+    }
+
+  private:
+    static int FillEmpty(Level& level, EditorHistory& history, EditorSpatialIndex& spatial,
+                         int grid, SDL_Rect bounds, int ox, int oy, const TileSpawn& proto,
+                         bool* truncated);
+    static int Reskin(Level& level, EditorHistory& history, EditorSpatialIndex& spatial,
+                      int grid, SDL_Rect bounds, int seed, const TileSpawn& proto,
+                      bool* truncated);
+};
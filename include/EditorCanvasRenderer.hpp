@@ -12,14 +12,25 @@
 //
 // Receives non-owning references to every shared object it needs so it
 // remains dependency-free from LevelEditorScene directly.
+//
+// Two layers:
+//   world   — background, grid, tiles, badges, entities, ghost. Drawn straight
+//             to the SDL_Renderer (clipped to the canvas) with textures from a
+//             TileTextureCache, so nothing is rasterised on the CPU per frame.
+//   overlay — screen-space widgets (moving-platform param bar + popup, tool
+//             overlays). Drawn into the caller's overlay surface, which the
+//             scene composites on top together with the UI pass.
 
 #include "EditorCamera.hpp"
+#include "EditorEnemyTypes.hpp"
 #include "EditorPalette.hpp"
+#include "EditorSpatialIndex.hpp"
 #include "EditorSurfaceCache.hpp"
 #include "Image.hpp"
 #include "LevelData.hpp"
 #include "SpriteSheet.hpp"
 #include "Text.hpp"
+#include "TileTextureCache.hpp"
 #include "Window.hpp"
 #include "tools/EditorTool.hpp"
 #include "tools/EditorToolContext.hpp"
@@ -50,13 +61,16 @@ class EditorCanvasRenderer {
 
     // ── Call once per frame from LevelEditorScene::Render ───────────────────
     void Render(Window&              window,
-                SDL_Surface*         screen,
+                SDL_Surface*         overlay,
+                TileTextureCache&    textures,
                 int                  canvasW,
                 int                  toolbarH,
                 int                  grid,
                 const Level&         level,
+                EditorSpatialIndex&  spatial,
                 const EditorCamera&  camera,
                 EditorSurfaceCache&  cache,
+                EditorEnemyTypes&    enemyTypes,
                 const EditorPalette& palette,
                 Image*               background,
                 SpriteSheet*         coinSheet,
@@ -71,42 +85,57 @@ class EditorCanvasRenderer {
     [[nodiscard]] SDL_Rect MovPlatPopupRect() const { return mMovPlatPopupRect; }
 
   private:
-    // ── Internal helpers ─────────────────────────────────────────────────────
+    // ── Overlay (surface) helpers ────────────────────────────────────────────
     static void DrawRect(SDL_Surface* s, SDL_Rect r, SDL_Color c);
-    static void DrawRectAlpha(SDL_Surface* s, SDL_Rect r, SDL_Color c);
     static void DrawOutline(SDL_Surface* s, SDL_Rect r, SDL_Color c, int t = 1);
 
     void BlitBadge(SDL_Surface* screen, SDL_Surface* badge, int bx, int by);
     SDL_Surface* Badge(EditorSurfaceCache& cache, const std::string& text, SDL_Color col);
 
-    void RenderGrid(SDL_Surface* screen, int canvasW, int toolbarH, int winH,
-                    const EditorCamera& cam, int grid);
+    // ── World (GPU) helpers — valid during Render() only ─────────────────────
+    void FillRect(SDL_Rect r, SDL_Color c) const;
+    void Outline(SDL_Rect r, SDL_Color c, int t = 1) const;
+    // Draws a cached text badge with its top-left at (x, y). Returns its size
+    // ({0, 0} if it could not be rendered).
+    SDL_Point    DrawBadge(const std::string& text, SDL_Color col, int x, int y);
+    SDL_Point    DrawBadge(SDL_Surface* badge, int x, int y);
+    SDL_Point    BadgeSize(const std::string& text, SDL_Color col);
+    SDL_Texture* SurfaceTexture(SDL_Surface* surf);
+    // Texture for a tile drawn into a dstW x dstH screen rect; picks the
+    // nearest mip level so zoomed-out tiles sample small textures.
+    SDL_Texture* TileTexture(const std::string& path, int rotation, int dstW, int dstH);
+    SDL_Texture* SheetTexture(SpriteSheet* sheet);
+    // LINEAR when minifying, PIXELART at or above source size.
+    static void  SetScaleFor(SDL_Texture* tex, const SDL_Rect& dst, float srcW, float srcH);
+
+    void RenderGrid(int canvasW, int toolbarH, int winH, const EditorCamera& cam, int grid);
 
-    void RenderTiles(SDL_Surface* screen, int canvasW, int toolbarH, int winH,
-                     const Level& level, const EditorCamera& cam,
-                     EditorSurfaceCache& cache, ToolId activeToolId,
+    // Draws the tiles in mVisible.
+    void RenderTiles(int canvasW, int toolbarH, int winH, const Level& level,
+                     const EditorCamera& cam, ToolId activeToolId,
                      int actionAnimDropHover);
 
-    void RenderMovingPlatOverlay(SDL_Surface* screen, int canvasW, int toolbarH,
+    void RenderMovingPlatOverlay(SDL_Surface* overlay, int canvasW, int toolbarH,
                                  const Level& level, const EditorCamera& cam,
-                                 EditorSurfaceCache& cache, int grid,
-                                 const MovPlatState& mp);
+                                 int grid, const MovPlatState& mp);
 
-    void RenderMovPlatPopup(SDL_Surface* screen, int canvasW, int toolbarH,
+    void RenderMovPlatPopup(SDL_Surface* overlay, int canvasW, int toolbarH,
                             EditorSurfaceCache& cache, const MovPlatState& mp);
 
-    void RenderEntities(SDL_Surface* screen, int canvasW, int toolbarH, int winH,
-                        const Level& level, const EditorCamera& cam,
-                        EditorSurfaceCache& cache,
-                        SpriteSheet* coins, SpriteSheet* enemies, int grid);
+    void RenderEntities(int canvasW, int toolbarH, int winH, const Level& level,
+                        const EditorCamera& cam, EditorEnemyTypes& enemyTypes,
+                        SpriteSheet* coins, SpriteSheet* enemies);
 
-    void RenderPlayerMarker(SDL_Surface* screen, const Level& level,
-                            const EditorCamera& cam);
+    void RenderPlayerMarker(const Level& level, const EditorCamera& cam);
 
-    void RenderGhost(SDL_Surface* screen, int canvasW, int toolbarH,
-                     const EditorCamera& cam, const EditorPalette& palette,
-                     EditorSurfaceCache& cache, ToolId activeToolId,
+    void RenderGhost(int canvasW, int toolbarH, const EditorCamera& cam,
+                     const EditorPalette& palette, ToolId activeToolId,
                      EditorTool* activeTool, int grid);
 
-    SDL_Rect mMovPlatPopupRect{};
+    SDL_Renderer*       mRen      = nullptr;
+    TileTextureCache*   mTextures = nullptr;
+    EditorSurfaceCache* mCache    = nullptr;
+
+    std::vector<int> mVisible; // tile indices overlapping the canvas, ascending
+    SDL_Rect         mMovPlatPopupRect{};
 };
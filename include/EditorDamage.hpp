@@ -0,0 +1,45 @@
+#pragma once
+// EditorDamage.hpp
+// ---------------------------------------------------------------------------
+// Screen-space damage tracking for LevelEditorScene::Render.
+//
+// The editor only changes in response to input, window events, and the odd
+// background refresh (enemy profiles edited on disk). Everything that can
+// change a pixel reports a screen rect here; Render then
+//   - skips the frame entirely (no clear, no draw, no present) when nothing
+//     is damaged, so an idle editor costs almost nothing, and
+//   - re-rasterises and re-uploads only the damaged part of the CPU overlay
+//     (toolbar, palette, status bar, popups, tool overlays) otherwise.
+//
+// Damage is kept as one bounding rect: editor updates are local (the region
+// under the mouse, the toolbar label) or global (camera move, level edit), so
+// a rect list would rarely beat the union. The GPU-drawn world layer is always
+// redrawn in full on a damaged frame — the back buffer holds no usable copy
+// of the previous frame after present.
+// ---------------------------------------------------------------------------
+
+#include "EditorCamera.hpp"
+#include <SDL3/SDL.h>
+
+class EditorDamage {
+  public:
+    void Add(SDL_Rect r);
+    void AddAll() { mFull = true; }
+
+    // Screen size and camera feed every pixel of the canvas; a change in
+    // either (from any source) damages the whole screen.
+    void Track(int screenW, int screenH, const EditorCamera& camera);
+
+    [[nodiscard]] bool Any() const { return mFull || mHasRect; }
+
+    // Rect to redraw this frame, clipped to the screen; resets the tracker.
+    [[nodiscard]] SDL_Rect Take();
+
+  private:
+    SDL_Rect mRect{};
+    bool     mHasRect = false;
+    bool     mFull    = true; // first frame draws everything
+
+    int   mW = 0, mH = 0;
+    float mCamX = 0.0f, mCamY = 0.0f, mZoom = 0.0f;
+};
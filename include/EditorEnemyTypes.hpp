@@ -0,0 +1,59 @@
+#pragma once
+// EditorEnemyTypes.hpp
+// ---------------------------------------------------------------------------
+// Editor-wide cache of the per-type enemy metadata the canvas needs: sprite
+// size (hit boxes, canvas rect), default speed (placement) and the preview
+// image path (canvas sprite). Shared by the spatial index, the canvas
+// renderer and the tools so none of them touch enemies/*.json or scan sprite
+// folders while hit-testing or drawing.
+//
+// A type is read once, on first lookup (or up front via Warm()). Files are
+// then only re-checked by Refresh(), which LevelEditorScene runs on a slow
+// timer and when the window regains focus; it stats each known profile and
+// re-reads the ones whose mtime/size changed (or that appeared/vanished).
+// ---------------------------------------------------------------------------
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+
+class EditorEnemyTypes {
+  public:
+    struct Info {
+        int         spriteW = 0; // profile render size; <= 0 = unset
+        int         spriteH = 0;
+        float       speed   = 120.0f;
+        std::string previewPath; // empty = no sprite assigned
+    };
+
+    // nullptr when the type is empty or its profile is missing / unreadable.
+    const Info* Find(const std::string& type);
+
+    // Loads the given type if it isn't cached yet.
+    void Warm(const std::string& type) { (void)Find(type); }
+
+    // Re-stats every known profile and reloads changed ones. Returns true if
+    // anything changed, so callers can drop data derived from the sizes.
+    bool Refresh();
+
+    void Clear() { mEntries.clear(); }
+
+  private:
+    struct Stamp {
+        std::filesystem::file_time_type mtime{};
+        std::uintmax_t                  size   = 0;
+        bool                            exists = false;
+        bool operator==(const Stamp&) const = default;
+    };
+    struct Entry {
+        Stamp stamp;
+        bool  ok = false;
+        Info  info;
+    };
+
+    static Stamp StampOf(const std::string& path);
+    static Entry Load(const std::string& type);
+
+    std::unordered_map<std::string, Entry> mEntries;
+};
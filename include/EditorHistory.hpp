@@ -0,0 +1,158 @@
+#pragma once
+// EditorHistory.hpp
+// ---------------------------------------------------------------------------
+// Multi-level undo/redo for the level editor, stored as per-entity deltas
+// rather than Level snapshots.
+//
+// Recording — call on the live Level, around the mutation:
+//   Touch(level, kind, i)    BEFORE editing entity i in place
+//   Erasing(level, kind, i)  BEFORE erasing entity i
+//   Appended(level, kind)    AFTER push_back
+// Bulk edits (paste, fill, multi-delete) record one op for the whole batch:
+//   AppendedRange(level, kind, first)  AFTER appending [first, end)
+//   ErasingMany(level, kind, indices)  BEFORE erasing them (ascending, unique)
+// Undo/redo then applies such a batch as a single range erase / insert or
+// one compaction / merge pass, instead of one vector shift per entity.
+// The "after" side of a touched / appended entity is read when the
+// transaction commits, so a drag that rewrites the same tile on every mouse
+// move stores one delta. A delta that only changed x/y is kept as a 16-byte
+// Move instead of two entity copies; one that changed nothing is dropped.
+//
+// Transactions: LevelEditorScene opens one per input event and keeps it open
+// from mouse-down to mouse-up, so every drag is a single undo step. Recording
+// with no open transaction opens one implicitly. Commits flagged `coalesce`
+// (scroll-wheel edits) merge into the previous step when it has the same
+// label, only edited entities in place, and is less than a second old.
+//
+// Edits(): a counter bumped by every recording call and by Undo() / Redo().
+// Caches over the level (hit-test index, minimap) compare it with the value
+// they last synced at, so only events that actually edited the level make
+// them rebuild.
+//
+// Memory: each step's size is estimated (ops + entity copies + strings) and
+// the oldest steps are dropped once undo + redo exceed the byte budget.
+// ---------------------------------------------------------------------------
+
+#include "LevelData.hpp"
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+class EditorHistory {
+  public:
+    enum class Kind : std::uint8_t { Tile, Coin, Enemy, Player };
+
+    static constexpr std::size_t DEFAULT_BUDGET = 4u << 20; // 4 MiB
+
+    explicit EditorHistory(std::size_t byteBudget = DEFAULT_BUDGET)
+        : mBudget(byteBudget) {}
+
+    // ── Transactions ─────────────────────────────────────────────────────────
+    // Begin() is a no-op while a transaction is already open.
+    void Begin(const std::string& label, bool coalesce = false);
+    void Commit(const Level& level);
+    [[nodiscard]] bool IsOpen() const { return mOpen.has_value(); }
+
+    // ── Recording ────────────────────────────────────────────────────────────
+    void Touch(const Level& level, Kind kind, int index);
+    void Erasing(const Level& level, Kind kind, int index);
+    void Appended(const Level& level, Kind kind);
+    void AppendedRange(const Level& level, Kind kind, int first);
+    void ErasingMany(const Level& level, Kind kind, const std::vector<int>& indices);
+
+    // ── Undo / redo ──────────────────────────────────────────────────────────
+    // Both commit any open transaction first. Return false when there is
+    // nothing to apply.
+    bool Undo(Level& level);
+    bool Redo(Level& level);
+
+    [[nodiscard]] bool CanUndo() const { return !mUndo.empty(); }
+    [[nodiscard]] bool CanRedo() const { return !mRedo.empty(); }
+    // Label of the step the next Undo()/Redo() would apply ("" if none).
+    [[nodiscard]] const std::string& UndoLabel() const;
+    [[nodiscard]] const std::string& RedoLabel() const;
+
+    void Clear();
+
+    // Moves whenever the level may have changed (see Edits() above).
+    [[nodiscard]] std::uint64_t Edits() const { return mEdits; }
+
+    [[nodiscard]] std::size_t Bytes() const { return mBytes; }
+    [[nodiscard]] std::size_t Budget() const { return mBudget; }
+    [[nodiscard]] int         UndoDepth() const { return (int)mUndo.size(); }
+    [[nodiscard]] int         RedoDepth() const { return (int)mRedo.size(); }
+
+  private:
+    using Entity = std::variant<TileSpawn, CoinSpawn, EnemySpawn, PlayerSpawn>;
+
+    enum class OpType : std::uint8_t { Modify, Move, Insert, Erase, InsertRange, EraseSet };
+
+    // Payload of the batched ops. InsertRange: entities appended at `index`
+    // onward. EraseSet: erased entities and their (ascending) indices.
+    struct Batch {
+        std::vector<int>    indices;
+        std::vector<Entity> entities;
+    };
+
+    struct Op {
+        OpType     type    = OpType::Modify;
+        Kind       kind    = Kind::Tile;
+        bool       pending = false; // "after" side not captured yet
+        bool       dead    = false; // finalized as a no-op
+        int        index   = 0;
+        SDL_FPoint from{}, to{};        // Move
+        std::unique_ptr<Entity> before; // Modify, Erase
+        std::unique_ptr<Entity> after;  // Modify, Insert
+        std::unique_ptr<Batch>  batch;  // InsertRange, EraseSet
+    };
+
+    struct Command {
+        std::string     label;
+        std::vector<Op> ops;
+        std::size_t     bytes    = 0;
+        bool            coalesce = false;
+        Uint64          timeMs   = 0;
+    };
+
+    // Open transaction plus the (kind, index) -> op lookup for pending ops.
+    struct Open {
+        Command                                cmd;
+        std::unordered_map<std::uint64_t, int> pending;
+    };
+
+    static std::uint64_t PendingKey(Kind kind, int index);
+    static Entity        Read(const Level& level, Kind kind, int index);
+    static void          Write(Level& level, Kind kind, int index, const Entity& e);
+    static void          InsertAt(Level& level, Kind kind, int index, const Entity& e);
+    static void          EraseAt(Level& level, Kind kind, int index);
+    static void          InsertRange(Level& level, Kind kind, int index, const Batch& b);
+    static void          EraseRange(Level& level, Kind kind, int index, int count);
+    static void          InsertSet(Level& level, Kind kind, const Batch& b);
+    static void          EraseSet(Level& level, Kind kind, const std::vector<int>& indices);
+    static void          SetPos(Level& level, Kind kind, int index, SDL_FPoint p);
+    static SDL_FPoint    PosOf(const Entity& e);
+    static std::size_t   EntityBytes(const Entity& e);
+    static std::size_t   CommandBytes(const Command& c);
+    static bool          InPlaceOnly(const Command& c);
+
+    Open& Ensure();
+    void  Finalize(const Level& level, Op& op);
+    void  FinalizeKind(const Level& level, Kind kind);
+    bool  MergeIntoTop(Command& cmd);
+    void  Push(Command&& cmd);
+    void  Trim();
+
+    std::optional<Open>  mOpen;
+    std::deque<Command>  mUndo;
+    std::vector<Command> mRedo;
+    std::size_t          mBudget;
+    std::size_t          mBytes = 0;
+    std::uint64_t        mEdits = 0;
+};
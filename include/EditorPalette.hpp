@@ -2,9 +2,13 @@
 // EditorPalette.hpp
 // ---------------------------------------------------------------------------
 // Owns the tile palette and background palette subsystems for the level
-// editor: directory traversal, PNG/JSON loading, thumbnail creation, scroll
-// state, selection indices, and the surface-cache seeding needed so tiles
-// already placed in a level are always renderable.
+// editor: directory traversal, thumbnail requests, scroll state and selection
+// indices.
+//
+// Listing a folder is cheap — entries appear at once with a placeholder and
+// their thumbnails fill in as the EditorThumbLoader worker produces them
+// (PumpThumbnails, once per frame). Full-resolution tile images are never
+// loaded here; EditorSurfaceCache decodes them on first use.
 //
 // Extracted from LevelEditorScene as part of the modular refactor (Prompt #3).
 // The orchestrator (LevelEditorScene) owns an EditorPalette instance and
@@ -19,12 +23,13 @@
 #include <vector>
 
 // Forward declarations — avoid pulling heavy headers into every TU
-class EditorSurfaceCache;
 class Image;
 struct Level;
 
-// Text must be fully defined here because unique_ptr<Text> members are
-// destroyed inline (via vector::clear / destructor), which requires sizeof(Text).
+// Text and EditorThumbLoader must be fully defined here because their
+// unique_ptr members are destroyed inline (via vector::clear / the defaulted
+// constructor), which requires sizeof(T).
+#include "EditorThumbLoader.hpp"
 #include "Text.hpp"
 
 class EditorPalette {
@@ -44,17 +49,18 @@ class EditorPalette {
     struct PaletteItem {
         std::string  path;
         std::string  label;
-        SDL_Surface* thumb    = nullptr;
-        SDL_Surface* full     = nullptr;
-        bool         isFolder = false;
-        SDL_Rect     delBtn   = {-1, -1, 0, 0}; // computed each frame in Render
+        SDL_Surface* thumb        = nullptr;
+        bool         isFolder     = false;
+        SDL_Rect     delBtn       = {-1, -1, 0, 0}; // computed each frame in Render
+        bool         thumbPending = false;          // queued on the thumbnail loader
     };
 
     struct BgItem {
         std::string  path;
         std::string  label;
-        SDL_Surface* thumb  = nullptr;
-        SDL_Rect     delBtn = {-1, -1, 0, 0};
+        SDL_Surface* thumb        = nullptr;
+        SDL_Rect     delBtn       = {-1, -1, 0, 0};
+        bool         thumbPending = false;
     };
 
     // Which tab is active in the palette panel
@@ -72,16 +78,19 @@ class EditorPalette {
 
     // ── Initialization ──────────────────────────────────────────────────────
     // Must be called once during Load() after the folder icon has been created.
-    // cache:      reference to the shared surface cache (for seeding tile lookups)
+    // Starts the thumbnail worker.
     // folderIcon: a shared, non-owning folder icon surface (lifetime managed elsewhere)
-    void Init(EditorSurfaceCache& cache, SDL_Surface* folderIcon);
+    void Init(SDL_Surface* folderIcon);
+
+    // Adopt thumbnails finished since the last call. Returns true if any
+    // palette cell changed (the caller redraws the palette).
+    bool PumpThumbnails();
 
     // ── Tile palette ────────────────────────────────────────────────────────
 
-    // Reload the tile palette from the given directory.
-    // Seeds the surface cache for tiles already in the level that reference
-    // images from directories not currently visible in the palette.
-    void LoadTileView(const std::string& dir, const Level& level);
+    // Reload the tile palette from the given directory. Thumbnails for the
+    // previous directory that are still in flight are discarded.
+    void LoadTileView(const std::string& dir);
 
     // Current tile-palette directory being displayed.
     [[nodiscard]] const std::string& CurrentDir() const { return mTileCurrentDir; }
@@ -145,13 +154,20 @@ class EditorPalette {
     void ClearCellLabels() { mCellLabels.clear(); }
 
     // ── Bulk cleanup ────────────────────────────────────────────────────────
-    // Frees all owned surfaces. Called by LevelEditorScene::Unload().
+    // Frees all owned surfaces and stops the thumbnail worker.
+    // Called by LevelEditorScene::Unload().
     void Clear();
 
   private:
+    // Thumbnail loader channels
+    static constexpr int THUMBS_TILES = 0;
+    static constexpr int THUMBS_BG    = 1;
+
     // ── References (non-owning, set via Init) ───────────────────────────────
-    EditorSurfaceCache* mCache      = nullptr;
-    SDL_Surface*        mFolderIcon = nullptr;
+    SDL_Surface* mFolderIcon = nullptr;
+
+    // ── Background thumbnail generation ─────────────────────────────────────
+    std::unique_ptr<EditorThumbLoader> mThumbs;
 
     // ── Tile palette state ──────────────────────────────────────────────────
     std::vector<PaletteItem> mPaletteItems;
@@ -179,7 +195,4 @@ class EditorPalette {
     // ── Internal helpers ────────────────────────────────────────────────────
     void FreeTileItems();
     void FreeBgItems();
-    void SeedCacheForLevel(const Level& level);
-    void SeedAnimatedTile(const std::string& path, int w, int h);
-    void SeedStaticTile(const std::string& path, int w, int h);
 };
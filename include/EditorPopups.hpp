@@ -18,6 +18,7 @@
 // orchestrator can forward them without re-declaring them.
 
 #include "AnimatedTile.hpp"
+#include "EditorHistory.hpp"
 #include "EditorPalette.hpp"
 #include "LevelData.hpp"
 #include <SDL3/SDL.h>
@@ -42,7 +43,8 @@ class EditorPopups {
 
     // ── Context: callbacks that popups need to call back into the orchestrator ─
     struct Ctx {
-        Level&        level;
+        Level&         level;
+        EditorHistory& history; // Touch() tiles before editing them
         EditorPalette& palette;
 
         std::function<void(const std::string&)> setStatus;
@@ -0,0 +1,70 @@
+#pragma once
+// EditorSpatialIndex.hpp
+// ---------------------------------------------------------------------------
+// Uniform-grid bucket index over Level::tiles, coins and enemies, used by the
+// editor's hit-tests (hover, click, erase, drag pick-up) and by SelectTool's
+// marquee so they no longer walk every entity on each mouse event.
+//
+// Each entity is registered in every CELL x CELL world cell its rect touches
+// (edges inclusive, matching EditorToolContext::HitTest). Buckets hold
+// indices in ascending order, so the lookups keep the linear-scan priority
+// they replace: HitTile returns the top-most (highest index) tile, HitCoin /
+// HitEnemy the first one.
+//
+// Sync: tools and popups edit Level directly, so instead of hooking every
+// mutation the scene calls MarkDirty() after an event that recorded an edit
+// in its EditorHistory, and the next query rebuilds (O(n), once). A change in any of the
+// three vector sizes also forces a rebuild. Indices are only valid for the
+// Level passed to the most recent query.
+// ---------------------------------------------------------------------------
+
+#include "EditorEnemyTypes.hpp"
+#include "LevelData.hpp"
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class EditorSpatialIndex {
+  public:
+    // World pixels per bucket side. A few tiles wide: small enough that a
+    // bucket holds a handful of entities, large enough that big tiles only
+    // touch a few buckets.
+    static constexpr int CELL = 256;
+
+    // Enemy hit boxes use the profile sprite size from `types`.
+    explicit EditorSpatialIndex(EditorEnemyTypes& types)
+        : mEnemyTypes(types) {}
+
+    void MarkDirty() { mDirty = true; }
+
+    // -1 when nothing is under the world point.
+    [[nodiscard]] int HitTile(const Level& level, int grid, int wx, int wy);
+    [[nodiscard]] int HitCoin(const Level& level, int grid, int wx, int wy);
+    [[nodiscard]] int HitEnemy(const Level& level, int grid, int wx, int wy);
+
+    // Indices (ascending) of tiles whose rect overlaps r with positive area.
+    void TilesInRect(const Level& level, int grid, SDL_Rect r, std::vector<int>& out);
+
+  private:
+    using Bucket = std::vector<int>;
+    using Grid   = std::unordered_map<std::int64_t, Bucket>;
+
+    struct Layer {
+        Grid                  cells;
+        std::vector<SDL_Rect> rects; // world rect per entity index
+    };
+
+    void Sync(const Level& level, int grid);
+    static void Insert(Layer& layer, int idx, SDL_Rect r);
+    static int  Pick(const Layer& layer, int wx, int wy, bool topMost);
+
+    static int          CellOf(int v);
+    static std::int64_t Key(int cx, int cy);
+
+    EditorEnemyTypes& mEnemyTypes;
+    Layer             mTiles, mCoins, mEnemies;
+    const Level*      mLevel = nullptr;
+    int               mGrid  = 0;
+    bool              mDirty = true;
+};
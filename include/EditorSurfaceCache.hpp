@@ -2,12 +2,23 @@
 // EditorSurfaceCache.hpp
 // ---------------------------------------------------------------------------
 // Owns and manages all cached SDL_Surface* resources used by the level editor:
-//   - Tile surface cache (path -> surface for rendering tiles on canvas)
-//   - Extra tile surfaces (loaded from subdirs not in current palette view)
+//   - Tile surface cache (path -> full-res surface for rendering tiles on
+//     canvas, decoded on first use by LoadAndCache)
 //   - Rotation cache (path -> {90, 180, 270} pre-rotated surfaces)
+//   - Mip levels (path + rotation -> 1/2, 1/4, 1/8 downsampled copies, so a
+//     zoomed-out canvas samples small textures instead of full-res ones)
 //   - Badge cache (text+colour key -> pre-rendered badge surface)
 //   - Destroy-anim thumbnail cache (JSON path -> 48x48 first-frame thumb)
 //
+// Memory budget: every cached surface is byte-accounted. Tile surfaces, their
+// rotations and mip levels are evicted least-recently-used first once the total goes
+// over the budget. Eviction only happens in BeginFrame(), and never touches
+// anything used in the previous frame, so a pointer returned here stays
+// valid until the next BeginFrame() and the visible working set never
+// thrashes (the budget is soft when that set alone exceeds it). Badges and
+// destroy-anim thumbs are small, bounded, and held across frames by popups,
+// so they count towards the total but are never evicted.
+//
 // Also provides static utility functions for loading/scaling surfaces that
 // are used by the palette, editor, and other subsystems.
 // ---------------------------------------------------------------------------
@@ -15,14 +26,32 @@
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <string>
 #include <unordered_map>
-#include <vector>
+#include <utility>
 
 class EditorSurfaceCache {
   public:
-    EditorSurfaceCache() = default;
+    static constexpr std::size_t DEFAULT_BUDGET = 128u << 20; // 128 MiB
+    static constexpr int         MAX_MIP        = 3;          // 1/2, 1/4, 1/8
+
+    struct Stats {
+        std::uint64_t hits          = 0; // LoadAndCache / GetRotated served from memory
+        std::uint64_t misses        = 0; // ...that had to decode or rotate
+        std::uint64_t evictions     = 0; // tile entries dropped to stay in budget
+        std::size_t   residentBytes = 0;
+        std::size_t   budgetBytes   = 0;
+        int           tiles         = 0; // resident tile surfaces
+        int           rotations     = 0; // resident rotated copies
+        int           mips          = 0; // resident mip levels
+    };
+
+    explicit EditorSurfaceCache(std::size_t byteBudget = DEFAULT_BUDGET)
+        : mBudget(byteBudget) {}
     ~EditorSurfaceCache();
 
     // Non-copyable, movable
@@ -41,32 +70,53 @@ class EditorSurfaceCache {
     // Blend mode is set to BLEND for correct compositing.
     static SDL_Surface* LoadPNG(const std::filesystem::path& p);
 
+    // ── Frame / budget ────────────────────────────────────────────────────────
+
+    // Call once per rendered frame, before anything is drawn. Evicts
+    // least-recently-used tile entries while over budget.
+    void BeginFrame();
+
+    // Called with every surface just before it is freed (eviction or
+    // Clear()), so GPU copies keyed by surface can be dropped with it.
+    using FreeFn = std::function<void(const SDL_Surface*)>;
+    void SetOnFree(FreeFn fn) { mOnFree = std::move(fn); }
+
+    void                      SetBudget(std::size_t bytes) { mBudget = bytes; }
+    [[nodiscard]] std::size_t Budget() const { return mBudget; }
+    [[nodiscard]] Stats       GetStats() const;
+
     // ── Tile surface cache ────────────────────────────────────────────────────
     // Fast path->surface lookup for rendering tiles on the canvas.
 
+    // Lookup only: never loads and does not count as a use.
     SDL_Surface* FindTileSurface(const std::string& path) const;
-    void         InsertTileSurface(const std::string& path, SDL_Surface* surf);
-    bool         HasTileSurface(const std::string& path) const;
-    void         ClearTileSurfaceCache();
 
-    // Load a PNG from disk, insert into the tile surface cache, and return it.
+    // Load a tile image from disk, insert into the tile surface cache, and
+    // return it. Animated-tile manifests resolve to their first frame.
     // Returns nullptr on failure. Subsequent calls with the same path return
-    // the cached surface without hitting disk.
+    // the cached surface (or the cached failure) without hitting disk.
     SDL_Surface* LoadAndCache(const std::string& path);
 
-    // ── Extra tile surfaces ───────────────────────────────────────────────────
-    // Surfaces loaded for level tiles from subdirs not in the current palette.
-    // Owned here, freed on clear/destruction.
-
-    void AddExtraTileSurface(SDL_Surface* surf);
-    void ClearExtraTileSurfaces();
-
     // ── Rotation cache ────────────────────────────────────────────────────────
-    // For each image path, pre-built surfaces for 90/180/270 degrees.
-    // Built lazily on first use.
+    // For each cached tile path, surfaces for 90/180/270 degrees, built
+    // lazily on first use and evicted together with the tile. Returns nullptr
+    // if `path` is not in the tile cache (callers fall back to `src`).
 
     SDL_Surface* GetRotated(const std::string& path, SDL_Surface* src, int deg);
 
+    // ── Mip levels ────────────────────────────────────────────────────────────
+    // Level (0 = full size) to draw a srcW x srcH image into a dstW x dstH
+    // rect: the smallest one that is still at least as large as the rect, so
+    // minification never drops below a 2:1 ratio.
+    static int MipLevelFor(int srcW, int srcH, int dstW, int dstH);
+
+    // `src` downsampled by 2^level, where `src` is the cached tile surface
+    // for `path` at `rotation` (i.e. LoadAndCache / GetRotated output). Each
+    // level is built lazily from the one above with a 2x2 box filter, and
+    // evicted with the tile. Returns src for level 0, nullptr if `path` is
+    // not in the tile cache.
+    SDL_Surface* GetMip(const std::string& path, SDL_Surface* src, int rotation, int level);
+
     // ── Badge cache ───────────────────────────────────────────────────────────
     // Pre-rendered text badges (P, L, A, F, H, slope markers, etc.)
     // Keyed by "text_RRGGBB". Built lazily on first use.
@@ -82,21 +132,40 @@ class EditorSurfaceCache {
     // ── Bulk cleanup ──────────────────────────────────────────────────────────
 
     // Frees ALL cached surfaces. Called by LevelEditorScene::Unload().
+    // Stats counters are kept for the session.
     void Clear();
 
   private:
-    // path -> surface (non-owning for palette items, owning for extra surfaces)
-    std::unordered_map<std::string, SDL_Surface*> mTileSurfaceCache;
+    using MipChain = std::array<SDL_Surface*, MAX_MIP>;
+
+    struct TileEntry {
+        SDL_Surface*                surf    = nullptr; // owned; nullptr = failed load
+        std::array<SDL_Surface*, 3> rot     = {};       // owned; 90, 180, 270
+        std::array<MipChain, 4>     mips    = {};       // owned; [rotation / 90][level - 1]
+        std::size_t                 bytes   = 0;        // surf + rot + mips
+        std::uint64_t               lastUse = 0;        // mFrame of the last use
+    };
 
-    // Owned surfaces loaded for level tiles from subdirs
-    std::vector<SDL_Surface*> mExtraTileSurfaces;
+    static std::size_t  SurfaceBytes(const SDL_Surface* s);
+    static SDL_Surface* Halve(SDL_Surface* src);
+    void               Free(SDL_Surface* s);
+    void               FreeTile(TileEntry& e);
+    void               Evict();
 
-    // path -> {90, 180, 270} rotated surfaces
-    std::unordered_map<std::string, std::array<SDL_Surface*, 3>> mRotCache;
+    // path -> tile surface + rotations
+    std::unordered_map<std::string, TileEntry> mTiles;
 
     // "text_RRGGBB" -> pre-rendered badge surface
     std::unordered_map<std::string, SDL_Surface*> mBadgeCache;
 
     // JSON path -> 48x48 thumbnail surface
     std::unordered_map<std::string, SDL_Surface*> mDestroyAnimThumbCache;
+
+    FreeFn        mOnFree;
+    std::size_t   mBudget;
+    std::size_t   mBytes     = 0; // every surface above
+    std::uint64_t mFrame     = 1;
+    std::uint64_t mHits      = 0;
+    std::uint64_t mMisses    = 0;
+    std::uint64_t mEvictions = 0;
 };
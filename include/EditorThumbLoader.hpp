@@ -0,0 +1,99 @@
+#pragma once
+// EditorThumbLoader.hpp
+// ---------------------------------------------------------------------------
+// Background thumbnail generation for the editor palettes.
+//
+// EditorPalette lists a folder immediately (labels and placeholder cells) and
+// queues one request per image; a worker thread produces the thumbnails and
+// the palette picks them up once per frame via Drain(), so opening a large
+// folder never stalls the editor.
+//
+// Every thumbnail is also written to an on-disk cache (CACHE_DIR), one file
+// per source image + size, stamped with the source's mtime. A revisit — in
+// this session or the next — reads the small cached pixels instead of
+// decoding the full image; editing the source invalidates its entry.
+//
+// Requests are grouped into channels (tile palette, background palette).
+// Cancel(channel) drops the channel's queue and bumps its generation, so
+// results still in flight from a folder the user has left are discarded.
+// The worker only touches files and SDL_Surfaces, never the renderer.
+// ---------------------------------------------------------------------------
+
+#include <SDL3/SDL.h>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class EditorThumbLoader {
+  public:
+    static constexpr const char* CACHE_DIR    = ".forge2d_cache/thumbs";
+    static constexpr int         NUM_CHANNELS = 2;
+
+    enum class Source : std::uint8_t {
+        Image,       // PNG on disk
+        AnimatedTile // animated-tile manifest; thumbnail of its first frame
+    };
+
+    // A finished thumbnail. The receiver owns `thumb` (nullptr if the source
+    // could not be decoded).
+    struct Done {
+        int          channel = 0;
+        int          slot    = 0;
+        SDL_Surface* thumb   = nullptr;
+    };
+
+    EditorThumbLoader();
+    ~EditorThumbLoader();
+
+    EditorThumbLoader(const EditorThumbLoader&)            = delete;
+    EditorThumbLoader& operator=(const EditorThumbLoader&) = delete;
+
+    // Queue a w x h thumbnail of `path`. `slot` is echoed back in Done so the
+    // caller can route it (palette item index). Served in request order.
+    void Request(int channel, int slot, const std::string& path, Source src, int w, int h);
+
+    // Forget every queued and in-flight request on the channel.
+    void Cancel(int channel);
+
+    // Finished thumbnails for live requests, in completion order.
+    [[nodiscard]] std::vector<Done> Drain();
+
+  private:
+    struct Job {
+        int           channel;
+        int           slot;
+        std::uint32_t generation;
+        std::string   path;
+        Source        src;
+        int           w, h;
+    };
+
+    struct Finished {
+        Done          done;
+        std::uint32_t generation;
+    };
+
+    void WorkerLoop();
+
+    static SDL_Surface* Generate(const Job& job);
+    static SDL_Surface* Decode(const Job& job);
+    static std::int64_t SourceStamp(const Job& job);
+    static std::string  CacheFile(const Job& job);
+    static SDL_Surface* ReadCached(const std::string& file, const Job& job, std::int64_t stamp);
+    static void WriteCached(const std::string& file, const Job& job, std::int64_t stamp,
+                            SDL_Surface* thumb);
+
+    std::thread             mWorker;
+    std::mutex              mMutex;
+    std::condition_variable mCv;
+    std::deque<Job>         mRequests;
+    std::vector<Finished>   mReady;
+    bool                    mQuit = false;
+
+    std::array<std::uint32_t, NUM_CHANNELS> mGeneration{};
+};
@@ -47,6 +47,8 @@ class EditorToolbar {
         Enemy,
         Tile,
         Erase,
+        Fill,
+        Stamp,
         PlayerStart,
         Select,
         MoveCam,
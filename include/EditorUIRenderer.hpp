@@ -24,12 +24,16 @@
 #include "Window.hpp"
 #include "tools/EditorTools.hpp"
 #include <SDL3/SDL.h>
+#include <climits>
 #include <memory>
 #include <string>
 #include <vector>
 
 class EditorUIRenderer {
   public:
+    // Height of the status bar along the bottom of the canvas.
+    static constexpr int BOTTOM_BAR_H = 22;
+
     // ── Anim-picker entry (mirrors LevelEditorScene::AnimPickerEntry) ────────
     struct AnimPickerEntry {
         std::string  path;
@@ -195,4 +199,8 @@ class EditorUIRenderer {
     SDL_Rect mDelYes{};
     SDL_Rect mDelNo{};
     SDL_Rect mAnimPickerRect{};
+
+    // Bottom-bar hint label is only re-rendered when its text or spot changes
+    std::string mLastHint;
+    SDL_Point   mLastHintPos{INT_MIN, INT_MIN};
 };
@@ -0,0 +1,109 @@
+#pragma once
+// FixedStep.hpp
+// ---------------------------------------------------------------------------
+// The physics tick clock behind the main loop's accumulator.
+//
+//   step.BeginFrame(frameSeconds);
+//   while (step.Step())
+//       manager.Update(step.Dt(), window);
+//   step.EndUpdate();
+//   manager.Render(window, step.Alpha());
+//
+// The simulation advances in whole ticks of Dt() and RenderSystem lerps
+// PrevTransform → Transform by Alpha(), so the tick rate can change at a
+// frame boundary without visible stutter: the accumulator is kept in seconds
+// and only the size of the next tick changes.
+//
+// A frame may simulate at most MAX_SIM_PER_FRAME of real time. Anything
+// beyond that is dropped (the game slows down instead of spiralling), and
+// the frame counts as saturated — unless it was a single hitch longer than
+// HITCH_SECONDS (scene load, breakpoint, window drag), which is simply
+// skipped. Tick cost is measured between Step() calls.
+//
+// Every EVAL_FRAMES frames the clock looks back over the window. When at
+// least a quarter of the frames saturated and ticks were a real share of
+// the frame time, the rate halves (120 → 60 Hz, not below MinHz()). After
+// RECOVER_WINDOWS quiet windows in a row whose ticks would still fit at the
+// higher rate, it steps back up. Changes are printed, marked in a trace
+// capture and shown in the F3 overlay.
+//
+// Replays need every tick to be the same size: SetAdaptive(false) pins the
+// rate while recording or playing one back.
+// ---------------------------------------------------------------------------
+
+#include <SDL3/SDL.h>
+
+class FixedStep {
+  public:
+    static constexpr float MAX_SIM_PER_FRAME = 1.0f / 20.0f;
+    static constexpr float HITCH_SECONDS     = 0.25f;
+    static constexpr int   EVAL_FRAMES       = 60;
+    static constexpr int   RECOVER_WINDOWS   = 4;
+
+    struct Stats {
+        float hz            = 0.0f; // current tick rate
+        float baseHz        = 0.0f; // configured rate the clock recovers to
+        float avgTickMs     = 0.0f; // mean cost of one tick, last window
+        float ticksPerFrame = 0.0f;
+        float tickShare     = 0.0f; // tick time / frame time, last window
+        int   saturated     = 0;    // saturated frames in the last window
+        int   drops         = 0;    // rate reductions so far
+        float lostMs        = 0.0f; // simulated time dropped so far
+    };
+
+    static FixedStep& Get();
+
+    // Base tick rate; also the current rate until the clock degrades.
+    void SetRate(float hz);
+    // Lowest rate degrading may reach (default 60 Hz).
+    void SetMinRate(float hz) { mMinHz = hz; }
+    void SetAdaptive(bool on) { mAdaptive = on; }
+
+    [[nodiscard]] float Dt() const { return mDt; }
+    [[nodiscard]] float Hz() const { return mHz; }
+    [[nodiscard]] float MinHz() const { return mMinHz; }
+
+    // Add the real time since the previous frame, clamped as described above.
+    void BeginFrame(float frameSeconds);
+    // True while a whole tick is due; consumes it from the accumulator.
+    bool Step();
+    // Close the frame's ticks: record their cost, adapt the rate if due.
+    void EndUpdate();
+    // Fraction of a tick accumulated but not simulated, in [0, 1]. Right
+    // after stepping back up a whole tick may be pending; it runs next frame.
+    [[nodiscard]] float Alpha() const { return mAccum < mDt ? mAccum / mDt : 1.0f; }
+
+    [[nodiscard]] Stats GetStats() const;
+
+  private:
+    FixedStep() = default;
+
+    void Evaluate();
+    void ChangeRate(float hz, const char* why);
+
+    float mBaseHz   = 120.0f;
+    float mHz       = 120.0f;
+    float mMinHz    = 60.0f;
+    float mDt       = 1.0f / 120.0f;
+    float mAccum    = 0.0f;
+    bool  mAdaptive = true;
+
+    // Current frame.
+    float  mFrameSeconds = 0.0f;
+    Uint64 mTickStart    = 0; // counter at the last Step() that returned true
+    int    mFrameTicks   = 0;
+    Uint64 mFrameTickCtr = 0;
+    bool   mSaturated    = false;
+
+    // Current evaluation window.
+    int    mWinFrames    = 0;
+    int    mWinTicks     = 0;
+    int    mWinSaturated = 0;
+    double mWinTickSec   = 0.0;
+    double mWinFrameSec  = 0.0;
+    int    mCalmWindows  = 0;
+
+    Stats mLast; // the last completed window
+    int   mDrops  = 0;
+    float mLostMs = 0.0f;
+};
@@ -0,0 +1,115 @@
+#pragma once
+// FramePacer.hpp
+// ---------------------------------------------------------------------------
+// Ends each presented frame on time without burning a core.
+//
+// The main loop calls EndFrame() after Render, saying whether a frame was
+// presented. How it waits depends on what the display is already doing for
+// us:
+//
+//   vsync effective   SDL_RenderPresent() blocks until the next refresh, so
+//                     when the target rate is at or above the display's the
+//                     pacer does not wait at all.
+//   no vsync          (disabled, or the driver ignores it — WSL, some VMs)
+//                     sleep with SDL_DelayNS() until `spin` before the
+//                     deadline, then spin out the rest.
+//
+// Whether vsync is effective is measured, not assumed: for the first
+// PROBE_FRAMES frames (and again after the display or the vsync setting
+// changes) the pacer does not wait and compares the natural frame interval
+// against the display's refresh period. While it relies on vsync it keeps
+// watching, and probes again if frames start arriving early (e.g. a
+// compositor that stops blocking for an occluded window).
+//
+// Iterations that present nothing (the editor skips idle frames) cannot
+// block on vsync, so they just sleep one period and are left out of the
+// interval history. When presents resume after PROBE_FRAMES or more of
+// them, vsync is probed again.
+//
+// The spin margin adapts to how late this machine's sleeps actually wake:
+// the p95 of the last OVERSHOOT_SAMPLES oversleeps plus a small guard, so a
+// desktop with 50 µs timer slack spins ~150 µs per frame instead of a full
+// millisecond, and a noisy scheduler gets the headroom it needs.
+//
+// Deadlines advance by exactly one period (no drift); a frame that misses
+// its deadline by more than a period resynchronises and counts as missed.
+// GetStats() reports the achieved interval and its jitter for the profiler
+// overlay and the summary printed on quit.
+// ---------------------------------------------------------------------------
+
+#include <SDL3/SDL.h>
+#include <array>
+
+class FramePacer {
+  public:
+    static constexpr int HISTORY           = 120; // frame intervals kept for stats
+    static constexpr int PROBE_FRAMES      = 30;  // no-wait frames used to detect vsync
+    static constexpr int OVERSHOOT_SAMPLES = 64;
+
+    struct Stats {
+        float targetHz    = 0.0f; // 0 = uncapped
+        float displayHz   = 0.0f; // 0 = unknown
+        bool  vsync       = false; // presents are observed to block on refresh
+        bool  probing     = false;
+        bool  sleeping    = false; // the pacer, not vsync, holds the rate
+        float intervalMs  = 0.0f; // mean frame interval
+        float jitterMs    = 0.0f; // standard deviation of the interval
+        float p99ErrorMs  = 0.0f; // p99 |interval - intended period|
+        float spinUs      = 0.0f; // current spin margin
+        float overshootUs = 0.0f; // p95 sleep oversleep the margin is based on
+        int   missed      = 0;    // deadlines missed by more than a period
+    };
+
+    static FramePacer& Get();
+
+    // Frames per second to pace to; 0 leaves the rate to vsync / the work.
+    void  SetTargetHz(float hz);
+    float TargetHz() const { return mTargetHz; }
+
+    // Refresh rate of the window's display (0 if SDL does not know it).
+    void SetDisplayHz(float hz);
+    // Whether the renderer was asked for vsync; off skips detection.
+    void SetVSyncRequested(bool on);
+
+    // Call once per loop iteration, after Render. Waits out the rest of the
+    // frame when the pacer (not vsync) is responsible for the rate; an
+    // iteration that did not present just sleeps.
+    void EndFrame(bool presented = true);
+
+    [[nodiscard]] Stats GetStats() const;
+    // One-line summary for the console.
+    void PrintSummary() const;
+
+  private:
+    FramePacer() = default;
+
+    void Reprobe();
+    void FinishProbe();
+    void IdleFrame();
+    void WaitUntil(Uint64 deadlineNs);
+    void UpdateSpin();
+    [[nodiscard]] Uint64 PeriodNs() const;
+    [[nodiscard]] bool   ShouldWait() const;
+    [[nodiscard]] float  RecentIntervalMs(int frames) const;
+
+    float mTargetHz       = 60.0f;
+    float mDisplayHz      = 0.0f;
+    bool  mVSyncRequested = true;
+    bool  mVSync          = false;
+    int   mProbeLeft      = PROBE_FRAMES;
+    int   mMissed         = 0;
+    int   mIdleFrames     = 0; // iterations without a present since the last one
+
+    Uint64 mFrameStart = 0; // when the previous EndFrame() returned
+    Uint64 mDeadline   = 0; // next software deadline, 0 = not running
+    Uint64 mSpinNs     = 1'000'000;
+
+    std::array<float, HISTORY> mIntervalMs{};
+    int                        mHead   = 0;
+    int                        mFrames = 0;
+
+    std::array<Uint32, OVERSHOOT_SAMPLES> mOvershootNs{};
+    int                                   mOvershootHead  = 0;
+    int                                   mOvershootCount = 0;
+    Uint64                                mOvershootP95   = 0;
+};
@@ -0,0 +1,168 @@
+#pragma once
+// FrameProfiler.hpp
+// ---------------------------------------------------------------------------
+// Per-system frame timing with an in-game overlay (F3 in GameScene).
+//
+// Code marks a scope with PROFILE_ZONE("Name"); the zone's time is summed
+// over the frame (fixed-step systems run 1–3 times per rendered frame), and
+// EndFrame() — called once per presented frame from the main loop — pushes
+// every zone's total plus the wall-clock frame time into a ring buffer of
+// the last HISTORY frames. The overlay shows per-zone average / p99 / max
+// over that window and a frame-time graph.
+//
+// Zones are registered once per call site (a function-local static), so the
+// hot path is two SDL_GetPerformanceCounter() calls and an array add. Zones
+// must be entered on the main thread only. While a TraceRecorder capture is
+// running, every zone and frame is also recorded there as a timeline span.
+//
+// With -DFORGE2D_ALLOC_TRACKING=ON each zone also counts the heap
+// allocations its thread made inside it (see AllocTracker.hpp); the overlay
+// then adds allocations and bytes per frame to every row.
+//
+// Build with -DFORGE2D_PROFILER=OFF to compile the macros to nothing: no
+// counters are read, no zones are registered, and the overlay key is inert.
+// ---------------------------------------------------------------------------
+
+#include "AllocTracker.hpp"
+#include "TraceRecorder.hpp"
+#include <SDL3/SDL.h>
+#include <array>
+#include <vector>
+
+#ifndef FORGE2D_PROFILE
+#define FORGE2D_PROFILE 0
+#endif
+
+class FrameProfiler {
+  public:
+    static constexpr int HISTORY   = 240; // frames kept (4 s at 60 Hz)
+    static constexpr int MAX_ZONES = 48;
+
+    struct ZoneStats {
+        const char* name           = "";
+        float       avgMs          = 0.0f;
+        float       p99Ms          = 0.0f;
+        float       maxMs          = 0.0f;
+        float       callsPerFrame  = 0.0f;
+        float       allocsPerFrame = 0.0f; // 0 unless AllocTracker::Enabled()
+        float       bytesPerFrame  = 0.0f;
+    };
+
+    static FrameProfiler& Get();
+
+    // Returns the id for `name` (a string literal), registering it on first
+    // use; -1 once MAX_ZONES is reached.
+    int RegisterZone(const char* name);
+
+    void Add(int zone, Uint64 ticks) {
+        if (zone < 0)
+            return;
+        mAccum[zone] += ticks;
+        ++mCalls[zone];
+    }
+    void AddAllocs(int zone, const AllocCounts& spent) {
+        if (zone < 0)
+            return;
+        mAllocAccum[zone] += spent.count;
+        mByteAccum[zone] += spent.bytes;
+    }
+
+    // Close the current frame: record every zone's total, the time since the
+    // previous EndFrame() and the main thread's allocations over that time,
+    // then reset the per-frame accumulators.
+    void EndFrame();
+
+    // ── Stats over the ring buffer ──────────────────────────────────────────
+    [[nodiscard]] int         ZoneCount() const { return mZoneCount; }
+    [[nodiscard]] const char* ZoneName(int zone) const { return mNames[zone]; }
+    [[nodiscard]] int         FrameCount() const { return mFrames; }
+    [[nodiscard]] ZoneStats   Zone(int zone) const;
+    [[nodiscard]] ZoneStats   Frame() const;
+
+    // ── Overlay ─────────────────────────────────────────────────────────────
+    void               ToggleOverlay() { mOverlay = !mOverlay; }
+    [[nodiscard]] bool OverlayVisible() const { return mOverlay; }
+
+    // Stats table and frame-time graph in the top-right corner of a
+    // `windowW` wide window. Uses SDL's built-in debug font, so drawing it
+    // never rasterises text or allocates textures.
+    void DrawOverlay(SDL_Renderer* ren, int windowW) const;
+
+  private:
+    FrameProfiler();
+
+    ZoneStats Summarise(const char* name, const float* samples, const Uint16* calls,
+                        const float* allocs = nullptr, const float* bytes = nullptr) const;
+
+    // Ring slot of the k-th most recent frame (0 = newest).
+    [[nodiscard]] int Slot(int k) const { return (mHead - 1 - k + HISTORY) % HISTORY; }
+
+    double mMsPerTick = 0.0;
+    Uint64 mLastFrame = 0;
+    int    mHead      = 0; // next slot to write
+    int    mFrames    = 0; // valid slots, up to HISTORY
+    int    mZoneCount = 0;
+    bool   mOverlay   = false;
+
+    std::array<const char*, MAX_ZONES> mNames{};
+    std::array<Uint64, MAX_ZONES>      mAccum{};
+    std::array<Uint16, MAX_ZONES>      mCalls{};
+    std::array<Uint64, MAX_ZONES>      mAllocAccum{};
+    std::array<Uint64, MAX_ZONES>      mByteAccum{};
+    AllocCounts                        mFrameAllocStart;
+
+    std::vector<float>  mZoneMs;    // [zone * HISTORY + slot]
+    std::vector<Uint16> mZoneCalls; // [zone * HISTORY + slot]
+    std::vector<float>  mFrameMs;   // [slot]
+
+    // Allocation rings; empty unless AllocTracker::Enabled().
+    std::vector<float> mZoneAllocs; // [zone * HISTORY + slot]
+    std::vector<float> mZoneBytes;  // [zone * HISTORY + slot]
+    std::vector<float> mFrameAllocs;
+    std::vector<float> mFrameBytes;
+};
+
+// RAII timer behind PROFILE_ZONE.
+class ProfileZone {
+  public:
+    explicit ProfileZone(int zone) : mZone(zone), mStart(SDL_GetPerformanceCounter()) {
+#if FORGE2D_TRACK_ALLOCS
+        mAllocStart = AllocTracker::Thread();
+#endif
+    }
+    ~ProfileZone() {
+        const Uint64 end = SDL_GetPerformanceCounter();
+        FrameProfiler::Get().Add(mZone, end - mStart);
+#if FORGE2D_TRACK_ALLOCS
+        FrameProfiler::Get().AddAllocs(mZone, AllocTracker::Thread() - mAllocStart);
+#endif
+        if (TraceRecorder::Active() && mZone >= 0)
+            TraceRecorder::Get().Complete(
+                "zone", FrameProfiler::Get().ZoneName(mZone), mStart, end);
+    }
+
+    ProfileZone(const ProfileZone&)            = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+  private:
+    int    mZone;
+    Uint64 mStart;
+#if FORGE2D_TRACK_ALLOCS
+    AllocCounts mAllocStart;
+#endif
+};
+
+#define FORGE2D_PROFILE_CAT2(a, b) a##b
+#define FORGE2D_PROFILE_CAT(a, b)  FORGE2D_PROFILE_CAT2(a, b)
+
+#if FORGE2D_PROFILE
+#define PROFILE_ZONE(name)                                                                  \
+    static const int FORGE2D_PROFILE_CAT(profZoneId_, __LINE__) =                           \
+        FrameProfiler::Get().RegisterZone(name);                                            \
+    ProfileZone FORGE2D_PROFILE_CAT(profZone_, __LINE__)(                                   \
+        FORGE2D_PROFILE_CAT(profZoneId_, __LINE__))
+#define PROFILE_END_FRAME() FrameProfiler::Get().EndFrame()
+#else
+#define PROFILE_ZONE(name)  ((void)0)
+#define PROFILE_END_FRAME() ((void)0)
+#endif
@@ -1,16 +1,22 @@
 #pragma once
 #include "AnimatedTile.hpp"
+#include "AnimatedTileLibrary.hpp"
+#include "ChunkStreamer.hpp"
 #include "Components.hpp"
 #include "Image.hpp"
+#include "InputFrame.hpp"
 #include "LevelData.hpp"
 #include "LevelSerializer.hpp"
 #include "PlayerProfile.hpp"
+#include "ProfileCache.hpp"
 #include "Rectangle.hpp"
+#include "Replay.hpp"
 #include "Scene.hpp"
 #include "SpriteSheet.hpp"
 #include "GameConfig.hpp"
 #include "Systems.hpp"
 #include "Text.hpp"
+#include "TileTextureCache.hpp"
 #include "Window.hpp"
 #include <SDL3/SDL.h>
 #include <entt/entt.hpp>
@@ -19,6 +25,7 @@
 #include <unordered_map>
 #include <vector>
 #include <array>
+#include <functional>
 
 // ─────────────────────────────────────────────────────────────────────────────
 // GameScene — Level 1
@@ -45,6 +52,13 @@ class GameScene : public Scene {
     std::unique_ptr<Scene> NextScene() override;
     entt::registry* GetRegistry() override { return &reg; }
 
+    // Drive the scene from a recording instead of the keyboard (call before
+    // Load). Live gameplay keys are ignored until the replay runs out; hold
+    // Tab to fast-forward. Construct the scene with the replay's level and
+    // profile paths.
+    void                PlayReplay(Replay replay);
+    const ReplayPlayer* GetReplay() const { return mReplay.get(); }
+
   private:
     entt::registry reg;
     Camera         mCamera;
@@ -62,7 +76,7 @@ class GameScene : public Scene {
     int            mPlayerSpriteW = 0;         // resolved sprite width  (set in Load, used in Spawn)
     int            mPlayerSpriteH = 0;         // resolved sprite height (set in Load, used in Spawn)
     std::array<float, PLAYER_ANIM_SLOT_COUNT> mSlotFps{};  // per-slot fps from profile (0 = engine default)
-    bool           mHasProfile        = false;  // true = a valid PlayerProfile was loaded
+    std::shared_ptr<const PlayerProfile> mProfile; // shared via ProfileCache (null = frost knight)
     bool           mFromEditor        = false;  // true = launched via editor Play button
     bool           mPaused            = false;  // true = pause overlay active, simulation frozen
     bool           mGoBackFromPause   = false;  // set by pause overlay "Back" button
@@ -94,16 +108,41 @@ class GameScene : public Scene {
     std::unique_ptr<SpriteSheet> coinSheet;
     // Custom enemy type sprite sheets — kept alive so GPU textures remain valid
     std::vector<std::unique_ptr<SpriteSheet>> mEnemySpriteSheets;
-    std::vector<SDL_Texture*>    tileScaledTextures; // owned; freed on Unload only
-    // Tile texture cache: key = "path|WxH|rROT" → non-owning ptr into tileScaledTextures.
-    // Populated in Spawn(), never cleared between Respawn() calls — only in Unload().
-    std::unordered_map<std::string, SDL_Texture*> tileTextureCache;
-    // Animated tile frame textures, keyed by entity. Each vector is parallel to
-    // the entity's AnimationState frame count.
-    std::unordered_map<entt::entity, std::vector<SDL_Texture*>> tileAnimFrameMap;
+    // Per enemy type: sheets (owned by mEnemySpriteSheets), frames and stats,
+    // built on first use from the shared EnemyProfile. Kept across Respawn(),
+    // cleared in Unload(). nullptr = type failed to load.
+    struct EnemyTypeCache {
+        SpriteSheet*          idleSheet = nullptr;
+        std::vector<SDL_Rect> idleFrames;
+        SpriteSheet*          moveSheet = nullptr;
+        std::vector<SDL_Rect> moveFrames;
+        float                 moveFps     = 7.0f;
+        SpriteSheet*          attackSheet = nullptr;
+        std::vector<SDL_Rect> attackFrames;
+        float                 attackFps = 10.0f;
+        SpriteSheet*          hurtSheet = nullptr;
+        std::vector<SDL_Rect> hurtFrames;
+        float                 hurtFps   = 8.0f;
+        SpriteSheet*          deadSheet = nullptr;
+        std::vector<SDL_Rect> deadFrames;
+        float                 deadFps = 6.0f;
+        int                   spriteW = 40, spriteH = 40;
+        float                 health  = 30.0f;
+    };
+    std::unordered_map<std::string, std::shared_ptr<EnemyTypeCache>> mEnemyTypeCache;
+    // Level tile textures (path + rotation). Warmed during the streaming parse
+    // in Load() and in Spawn(); never cleared between Respawn() calls — only
+    // in Unload().
+    TileTextureCache mTileTextures{"game/tiles"};
+    // Animated tile atlases (live tiles and destroy animations), one per
+    // manifest + rotation, plus the clock that selects every tile's frame.
+    // Kept across Respawn(), cleared in Unload().
+    AnimatedTileLibrary mAnimTiles;
     // Pre-sorted render list for tile Pass 1 (built in Spawn, updated when action
     // tiles are destroyed).  Avoids per-frame allocation + sort in RenderSystem.
     std::vector<entt::entity> mSortedTileRenderList;
+    // Streams tile chunks around the camera for chunked levels (null otherwise).
+    std::unique_ptr<ChunkStreamer> mChunkStreamer;
     std::vector<SDL_Rect>        walkFrames;
     std::vector<SDL_Rect>        jumpFrames;
     std::vector<SDL_Rect>        idleFrames;
@@ -126,6 +165,28 @@ class GameScene : public Scene {
     std::unique_ptr<Text>      stompText;
     std::unique_ptr<Text>      levelCompleteText;
 
+    // Resolves a tile image (path, rotation) to a GPU texture.
+    using TileTextureFn = ChunkStreamer::TextureFn;
+
+    entt::entity SpawnTile(const TileSpawn& ts, const TileTextureFn& getTex);
+    void         AttachDestroyAnim(entt::entity tile, const TileSpawn& ts);
+    void         RebuildSortedTileRenderList();
+    void         UpdateDormantEnemies();
+    SDL_FRect    CameraView() const;
     void Spawn();
     void Respawn();
+
+    // ── Input and replays (InputFrame.hpp, Replay.hpp) ──────────────────────
+    // Hold Tab during a replay to run this many ticks per Update().
+    static constexpr int REPLAY_FAST_FORWARD = 8;
+
+    InputSampler                  mInput;
+    std::unique_ptr<Replay>       mRecording;          // --record: this life so far
+    std::unique_ptr<ReplayPlayer> mReplay;             // input source while playing
+    bool                          mFastForward = false; // Tab held during a replay
+
+    void       Tick(float dt);
+    InputFrame NextInput();
+    void       BeginLife(); // seed rand() + start recording, before Spawn()
+    void       SaveRecording();
 };
@@ -0,0 +1,111 @@
+#pragma once
+// InputFrame.hpp
+// ---------------------------------------------------------------------------
+// Gameplay input as one snapshot per fixed tick.
+//
+// The gameplay systems (InputSystem, LadderSystem, MovementSystem) read an
+// InputFrame instead of SDL events or SDL_GetKeyboardState(), so a tick's
+// result depends only on the registry and its frame. That is what makes a
+// session recordable and replayable (see Replay.hpp) and lets the headless
+// benchmark walk the player around.
+//
+// InputSampler builds the frames from SDL events on the main thread:
+//   Track()  every event the scene sees — keeps `held` true to the keyboard
+//   Queue()  events gameplay reacts to  — adds press / release edges
+//   Next()   once per tick              — snapshot, then clears the edges
+// ---------------------------------------------------------------------------
+
+#include <SDL3/SDL.h>
+
+// The keys gameplay reads. Stored as bits, so the order is part of the
+// replay file format: append only.
+enum class InputKey : Uint8 {
+    A,
+    D,
+    W,
+    S,
+    Left,
+    Right,
+    Up,
+    Down,
+    Space,
+    F,
+    LCtrl,
+    LShift,
+    Count
+};
+
+struct InputFrame {
+    Uint16 held     = 0; // down after the tick's events
+    Uint16 pressed  = 0; // key-down events since the last tick (OS repeats included)
+    Uint16 released = 0; // key-up events since the last tick
+
+    static constexpr Uint16 Bit(InputKey k) { return (Uint16)(1u << (unsigned)k); }
+
+    bool Held(InputKey k) const { return held & Bit(k); }
+    bool Pressed(InputKey k) const { return pressed & Bit(k); }
+    bool Released(InputKey k) const { return released & Bit(k); }
+    // Any edge this tick; the key's final state is Held().
+    bool Changed(InputKey k) const { return (pressed | released) & Bit(k); }
+
+    bool operator==(const InputFrame&) const = default;
+};
+
+// Gameplay key for an SDL keycode, or InputKey::Count if gameplay ignores it.
+inline InputKey InputKeyFromKeycode(SDL_Keycode key) {
+    switch (key) {
+        case SDLK_A:      return InputKey::A;
+        case SDLK_D:      return InputKey::D;
+        case SDLK_W:      return InputKey::W;
+        case SDLK_S:      return InputKey::S;
+        case SDLK_LEFT:   return InputKey::Left;
+        case SDLK_RIGHT:  return InputKey::Right;
+        case SDLK_UP:     return InputKey::Up;
+        case SDLK_DOWN:   return InputKey::Down;
+        case SDLK_SPACE:  return InputKey::Space;
+        case SDLK_F:      return InputKey::F;
+        case SDLK_LCTRL:  return InputKey::LCtrl;
+        case SDLK_LSHIFT: return InputKey::LShift;
+        default:          return InputKey::Count;
+    }
+}
+
+class InputSampler {
+  public:
+    void Track(const SDL_Event& e) {
+        const InputKey k = KeyOf(e);
+        if (k == InputKey::Count)
+            return;
+        if (e.type == SDL_EVENT_KEY_DOWN)
+            mHeld |= InputFrame::Bit(k);
+        else
+            mHeld &= (Uint16)~InputFrame::Bit(k);
+    }
+
+    void Queue(const SDL_Event& e) {
+        const InputKey k = KeyOf(e);
+        if (k == InputKey::Count)
+            return;
+        if (e.type == SDL_EVENT_KEY_DOWN)
+            mPressed |= InputFrame::Bit(k);
+        else
+            mReleased |= InputFrame::Bit(k);
+    }
+
+    InputFrame Next() {
+        InputFrame f{mHeld, mPressed, mReleased};
+        mPressed = mReleased = 0;
+        return f;
+    }
+
+  private:
+    static InputKey KeyOf(const SDL_Event& e) {
+        if (e.type != SDL_EVENT_KEY_DOWN && e.type != SDL_EVENT_KEY_UP)
+            return InputKey::Count;
+        return InputKeyFromKeycode(e.key.key);
+    }
+
+    Uint16 mHeld     = 0;
+    Uint16 mPressed  = 0;
+    Uint16 mReleased = 0;
+};
@@ -8,6 +8,7 @@
 
 struct CoinSpawn {
     float x, y;
+    bool operator==(const CoinSpawn&) const = default;
 };
 
 struct EnemySpawn {
@@ -16,10 +17,12 @@ struct EnemySpawn {
     bool        antiGravity = false;
     bool        startLeft   = false; // true = starts moving left, false = starts moving right
     std::string enemyType;           // enemy profile name (empty = legacy generic slime)
+    bool operator==(const EnemySpawn&) const = default;
 };
 
 struct PlayerSpawn {
     float x, y;
+    bool operator==(const PlayerSpawn&) const = default;
 };
 
 // ── TileSpawn sub-structs ────────────────────────────────────────────────────
@@ -27,14 +30,18 @@ struct PlayerSpawn {
 // When the optional is std::nullopt, that feature is inactive.
 
 struct ActionData {
+    static constexpr int MAX_GROUP = 9; // the editor's Action tool cycles 0..MAX_GROUP
+
     int         group          = 0;   // 0 = standalone; non-zero groups trigger together
     int         hitsRequired   = 1;   // total slashes to destroy
     std::string destroyAnimPath;      // animated tile JSON for death anim (empty = none)
+    bool operator==(const ActionData&) const = default;
 };
 
 struct SlopeData {
     SlopeType type       = SlopeType::DiagUpRight;
     float     heightFrac = 1.0f; // 0..1: fraction of tile height the slope rises
+    bool operator==(const SlopeData&) const = default;
 };
 
 struct HitboxData {
@@ -42,6 +49,7 @@ struct HitboxData {
     int offY = 0;
     int w    = 0; // 0 = use tile w
     int h    = 0; // 0 = use tile h
+    bool operator==(const HitboxData&) const = default;
 };
 
 struct MovingPlatformData {
@@ -53,11 +61,13 @@ struct MovingPlatformData {
     bool  trigger = false;   // true = waits for player landing before moving
     float phase   = 0.0f;   // starting position: 0.0 = origin, 1.0 = far end
     int   loopDir = 1;      // starting direction: +1 = right/down, -1 = left/up
+    bool operator==(const MovingPlatformData&) const = default;
 };
 
 struct PowerUpData {
     std::string type;             // "antigravity", etc.
     float       duration = 15.0f; // seconds the effect lasts
+    bool operator==(const PowerUpData&) const = default;
 };
 
 // ── TileSpawn ────────────────────────────────────────────────────────────────
@@ -92,12 +102,34 @@ struct TileSpawn {
     SlopeType GetSlopeType() const {
         return slope ? slope->type : SlopeType::None;
     }
+
+    // Field-wise; the editor's undo history uses it to drop no-op edits.
+    bool operator==(const TileSpawn&) const = default;
 };
 
 // ── Level-wide settings ──────────────────────────────────────────────────────
 
 enum class GravityMode { Platformer, WallRun, OpenWorld };
 
+// ── Chunked levels ───────────────────────────────────────────────────────────
+// A chunked level's JSON is a normal level file (player, coins, enemies and any
+// always-resident tiles) plus a "chunks" block pointing at a directory of
+// per-chunk tile files. GameScene streams those chunks in and out around the
+// camera instead of spawning every tile up front (see ChunkStreamer).
+
+struct ChunkCoord {
+    int cx = 0, cy = 0;
+    bool operator==(const ChunkCoord&) const = default;
+};
+
+struct LevelChunking {
+    std::string             dir;            // chunk directory, relative to the level file
+    int                     size    = 1024; // chunk edge length in world pixels
+    float                   boundsW = 0.0f; // world extent of all chunk tiles
+    float                   boundsH = 0.0f;
+    std::vector<ChunkCoord> chunks;         // chunks that have a file on disk
+};
+
 struct Level {
     std::string             name        = "Untitled";
     std::string             background  = "game_assets/backgrounds/deepspace_scene.png";
@@ -108,4 +140,7 @@ struct Level {
     std::vector<CoinSpawn>  coins;
     std::vector<EnemySpawn> enemies;
     std::vector<TileSpawn>  tiles;
+    std::optional<LevelChunking> chunking; // set = tiles beyond `tiles` stream from disk
+
+    bool IsChunked() const { return chunking.has_value(); }
 };
@@ -1,20 +1,27 @@
 #pragma once
+#include "EditorBulkOps.hpp"
 #include "EditorCamera.hpp"
+#include "EditorEnemyTypes.hpp"
 #include "EditorFileOps.hpp"
+#include "EditorHistory.hpp"
 #include "EditorPalette.hpp"
 #include "EditorPopups.hpp"
+#include "EditorSpatialIndex.hpp"
 #include "EditorSurfaceCache.hpp"
 #include "EditorCanvasRenderer.hpp"
+#include "EditorDamage.hpp"
 #include "EditorToolbar.hpp"
 #include "EditorUIRenderer.hpp"
 #include "EnemyProfile.hpp"
 #include "Image.hpp"
 #include "LevelData.hpp"
+#include "LevelMinimap.hpp"
 #include "LevelSerializer.hpp"
 #include "Rectangle.hpp"
 #include "Scene.hpp"
 #include "SpriteSheet.hpp"
 #include "Text.hpp"
+#include "TileTextureCache.hpp"
 #include "Window.hpp"
 #include "tools/EditorTools.hpp"
 #include <SDL3/SDL.h>
@@ -43,6 +50,7 @@ class LevelEditorScene : public Scene {
     bool                   HandleEvent(SDL_Event& e) override;
     void                   Update(float dt) override;
     void                   Render(Window& window, float alpha = 1.0f) override;
+    bool                   Presented() const override { return mPresented; }
     std::unique_ptr<Scene> NextScene() override;
 
   private:
@@ -55,6 +63,7 @@ class LevelEditorScene : public Scene {
     // -------------------------------------------------------------------------
     static constexpr int   GRID          = 38;
     static constexpr int   TOOLBAR_H     = EditorToolbar::TOOLBAR_H;
+    static constexpr int   BOTTOM_BAR_H  = EditorUIRenderer::BOTTOM_BAR_H;
     static constexpr int   PALETTE_W     = EditorPalette::PALETTE_W;
     static constexpr int   PALETTE_TAB_W = EditorPalette::PALETTE_TAB_W;
     static constexpr int   ICON_SIZE     = 40;
@@ -87,8 +96,12 @@ class LevelEditorScene : public Scene {
             .level        = mLevel,
             .camera       = mCamera,
             .surfaceCache = mSurfaceCache,
+            .spatial      = mSpatial,
+            .enemyTypes   = mEnemyTypes,
+            .history      = mHistory,
             .grid         = GRID,
             .toolbarH     = TOOLBAR_H,
+            .bottomBarH   = BOTTOM_BAR_H,
             .setStatus    = [this](const std::string& msg) { SetStatus(msg); },
             .canvasW      = [this]() { return CanvasW(); },
             .sdlWindow    = mWindow ? mWindow->GetRaw() : nullptr,
@@ -104,6 +117,8 @@ class LevelEditorScene : public Scene {
         }
         mActiveToolId = id;
         mTool         = MakeEditorTool(id);
+        if (auto* st = dynamic_cast<StampTool*>(mTool.get()))
+            st->clipboard = &mClipboard;
         if (mTool) {
             auto ctx = MakeToolCtx();
             mTool->OnActivate(ctx);
@@ -120,6 +135,8 @@ class LevelEditorScene : public Scene {
             case ToolId::Enemy:       return TBBtn::Enemy;
             case ToolId::Tile:        return TBBtn::Tile;
             case ToolId::Erase:       return TBBtn::Erase;
+            case ToolId::Fill:        return TBBtn::Fill;
+            case ToolId::Stamp:       return TBBtn::Stamp;
             case ToolId::PlayerStart: return TBBtn::PlayerStart;
             case ToolId::Select:      return TBBtn::Select;
             case ToolId::MoveCam:     return TBBtn::MoveCam;
@@ -201,6 +218,40 @@ class LevelEditorScene : public Scene {
 
     Level mLevel;
 
+    // Per-type enemy metadata (sizes, preview paths) shared by hit-tests,
+    // rendering and tools; re-checked on disk by PollEnemyTypes().
+    EditorEnemyTypes mEnemyTypes;
+    float            mEnemyTypePollT = 0.0f;
+    void             PollEnemyTypes();
+
+    // Bucket index over mLevel for hit-tests; marked dirty after an event
+    // that recorded an edit in mHistory (see HandleEvent).
+    mutable EditorSpatialIndex mSpatial{mEnemyTypes};
+    std::uint64_t              mSyncedEdits = 0; // mHistory.Edits() at the last MarkDirty
+
+    // Delta-based undo/redo. HandleEvent brackets every event in a transaction
+    // (a whole drag is one step); cleared when a different level is loaded.
+    EditorHistory mHistory;
+    void          ApplyHistory(bool redo);
+    void TouchTile(int i) { mHistory.Touch(mLevel, EditorHistory::Kind::Tile, i); }
+    void TouchTile(const TileSpawn& t) { TouchTile((int)(&t - mLevel.tiles.data())); }
+
+    // Tiles copied with Ctrl+C / Ctrl+X; pasted with Ctrl+V and painted by
+    // StampTool. Bulk edits go through EditorBulkOps (one batched undo op).
+    EditorBulkOps::Clipboard mClipboard;
+    void                     HandleClipboardKey(SDL_Keycode key);
+
+    // Overview of the whole level in the canvas' bottom-right corner, kept up
+    // to date incrementally (marked dirty alongside mSpatial). Click or drag on
+    // it to move the camera; M toggles it. Saving also writes it out as the
+    // level's preview for the title-screen browser.
+    LevelMinimap mMinimap{mSurfaceCache};
+    bool         mShowMinimap = true;
+    bool         mMinimapDrag = false;
+    SDL_Rect     MinimapRect() const;
+    void         CenterCameraOnMinimap(int x, int y);
+    std::string  SaveCurrentLevel();
+
     // ── Palette ──────────────────────────────────────────────────────────────
     using PaletteItem = EditorPalette::PaletteItem;
     using BgItem      = EditorPalette::BgItem;
@@ -212,6 +263,22 @@ class LevelEditorScene : public Scene {
     std::unique_ptr<SpriteSheet> enemySheet;
     SDL_Surface*                 mFolderIcon = nullptr;
 
+    // ── Render targets ───────────────────────────────────────────────────────
+    // Canvas world layer draws straight to the renderer using these textures.
+    // Screen-space UI is rasterised into mOverlaySurface and streamed into
+    // mOverlayTex once per frame; both are reused until the window resizes.
+    TileTextureCache mTextures{"editor/tiles", true};
+    SDL_Surface*     mOverlaySurface = nullptr;
+    SDL_Texture*     mOverlayTex     = nullptr;
+
+    // What changed since the last present. HandleEvent / SetStatus / profile
+    // polling report damage; Render skips idle frames and only re-rasterises
+    // the damaged part of the overlay.
+    EditorDamage mDamage;
+    SDL_Point    mDamageMouse{-1, -1}; // last mouse position seen by HandleEvent
+    bool         mPresented = true;    // false when Render skipped an idle frame
+    SDL_Rect     DamageRegionAt(int x, int y) const;
+
     // Moving-platform placement state (popup state lives in mPopups)
     std::vector<int> mMovPlatIndices;
     int              mMovPlatNextGroupId = 1;
@@ -241,46 +308,23 @@ class LevelEditorScene : public Scene {
 
     int HitCoin(int sx, int sy) const {
         auto [wx, wy] = ScreenToWorld(sx, sy);
-        for (int i = 0; i < (int)mLevel.coins.size(); i++) {
-            SDL_Rect r = {(int)mLevel.coins[i].x, (int)mLevel.coins[i].y, GRID, GRID};
-            if (HitTest(r, wx, wy))
-                return i;
-        }
-        return -1;
+        return mSpatial.HitCoin(mLevel, GRID, wx, wy);
     }
     int HitEnemy(int sx, int sy) const {
         auto [wx, wy] = ScreenToWorld(sx, sy);
-        for (int i = 0; i < (int)mLevel.enemies.size(); i++) {
-            const auto& en = mLevel.enemies[i];
-            int ew = GRID, eh = GRID;
-            if (!en.enemyType.empty()) {
-                EnemyProfile prof;
-                if (LoadEnemyProfile("enemies/" + en.enemyType + ".json", prof)) {
-                    ew = (prof.spriteW > 0) ? prof.spriteW : GRID;
-                    eh = (prof.spriteH > 0) ? prof.spriteH : GRID;
-                }
-            }
-            SDL_Rect r = {(int)en.x, (int)en.y, ew, eh};
-            if (HitTest(r, wx, wy))
-                return i;
-        }
-        return -1;
+        return mSpatial.HitEnemy(mLevel, GRID, wx, wy);
     }
     int HitTile(int sx, int sy) const {
         auto [wx, wy] = ScreenToWorld(sx, sy);
-        for (int i = (int)mLevel.tiles.size() - 1; i >= 0; i--) {
-            const auto& t = mLevel.tiles[i];
-            SDL_Rect    r = {(int)t.x, (int)t.y, t.w, t.h};
-            if (HitTest(r, wx, wy))
-                return i;
-        }
-        return -1;
+        return mSpatial.HitTile(mLevel, GRID, wx, wy);
     }
 
     void SetStatus(const std::string& msg) {
         mStatusMsg = msg;
         if (lblStatus)
             lblStatus->CreateSurface(mStatusMsg);
+        // The status label lives in the toolbar strip
+        mDamage.Add({0, 0, mWindow ? mWindow->GetWidth() : 0, TOOLBAR_H});
     }
 
     SDL_Surface* GetBadge(const std::string& text, SDL_Color col) {
@@ -293,7 +337,7 @@ class LevelEditorScene : public Scene {
         return mSurfaceCache.GetDestroyAnimThumb(jsonPath);
     }
 
-    void LoadTileView(const std::string& dir) { mPalette.LoadTileView(dir, mLevel); }
+    void LoadTileView(const std::string& dir) { mPalette.LoadTileView(dir); }
     void LoadBgPalette() { mPalette.LoadBgPalette(mLevel); }
     void ApplyBackground(int idx);
 
@@ -0,0 +1,117 @@
+#pragma once
+// LevelMinimap.hpp
+// ---------------------------------------------------------------------------
+// Low-resolution overview of a Level, cached in a small CPU surface.
+//
+// Each tile is drawn as a block of its image's average colour. Coins, enemies
+// and the player are drawn as markers on top. The surface covers the level's
+// bounds rounded up to WORLD_QUANT, scaled to fit MAX_W x MAX_H.
+//
+// The render is built once and then kept in step incrementally: Refresh()
+// compares the level against a snapshot of what was drawn last time and
+// redraws only the pixels under entities that were added, moved, resized,
+// re-skinned or removed. Only growth past the rounded bounds rebuilds it all.
+// The caller just calls MarkDirty() after anything that may have edited the
+// level (the editor does it after events that recorded an undoable edit).
+// The snapshot keeps each tile's image as an interned id, so taking it
+// copies no strings. Each image's colour is worked out once, when it is
+// interned, from the surface the editor's EditorSurfaceCache already holds.
+//
+// The same render doubles as the level's preview in the TitleScene browser:
+// SavePreview() writes it next to the thumbnail cache when the editor saves,
+// and LoadPreview() uploads that PNG, so the browser never opens a level
+// file to draw its card.
+// ---------------------------------------------------------------------------
+
+#include "LevelData.hpp"
+#include <SDL3/SDL.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class EditorSurfaceCache;
+
+class LevelMinimap {
+  public:
+    static constexpr int         MAX_W       = 256;
+    static constexpr int         MAX_H       = 128;
+    static constexpr float       WORLD_QUANT = 1024.0f; // bounds grow in these steps
+    static constexpr const char* PREVIEW_DIR = ".forge2d_cache/level_previews";
+
+    // Tile images are read through `surfaces` (not owned).
+    explicit LevelMinimap(EditorSurfaceCache& surfaces)
+        : mSurfaces(surfaces) {}
+    ~LevelMinimap();
+
+    LevelMinimap(const LevelMinimap&)            = delete;
+    LevelMinimap& operator=(const LevelMinimap&) = delete;
+
+    // ── Cached render ───────────────────────────────────────────────────────
+    void MarkDirty() { mDirty = true; }
+
+    // Drop the render and the per-image colours (the editor calls this with
+    // its other caches on unload). The next Refresh() rebuilds everything.
+    void Clear();
+
+    // Bring the render up to date with `level`. A no-op unless MarkDirty()
+    // was called since the last Refresh(). Returns true if any pixel changed.
+    bool Refresh(const Level& level);
+
+    [[nodiscard]] SDL_Surface* Surface() const { return mSurface; }
+
+    // ── Display ─────────────────────────────────────────────────────────────
+    // Largest rect with the map's aspect ratio, centred in `box`.
+    [[nodiscard]] SDL_Rect Fit(SDL_Rect box) const;
+
+    // Blit the map into `dst` (normally Fit() output) and outline the world
+    // rect `view` (the visible part of the level) on top of it.
+    void Draw(SDL_Surface* screen, SDL_Rect dst, const SDL_FRect& view) const;
+
+    // World point under screen point (x, y) of a map drawn into `dst`.
+    [[nodiscard]] SDL_FPoint ToWorld(SDL_Rect dst, int x, int y) const;
+
+    // ── Level browser previews ──────────────────────────────────────────────
+    static std::string PreviewPath(const std::string& levelPath);
+
+    // Writes the current render as the preview of `levelPath`.
+    bool SavePreview(const std::string& levelPath) const;
+
+    // Texture of the saved preview, or nullptr if there is none or the level
+    // file changed after it was written. Caller owns it.
+    static SDL_Texture* LoadPreview(SDL_Renderer* ren, const std::string& levelPath);
+
+  private:
+    // What was drawn for one entity last time.
+    struct Mark {
+        SDL_FRect rect;
+        int       image = -1; // tiles only: index into mImages
+        bool operator==(const Mark& o) const {
+            return rect.x == o.rect.x && rect.y == o.rect.y && rect.w == o.rect.w &&
+                   rect.h == o.rect.h && image == o.image;
+        }
+    };
+
+    static SDL_FRect Bounds(const Level& level);
+
+    void     Snapshot(const Level& level, std::vector<Mark>& tiles,
+                      std::vector<Mark>& markers);
+    int      ImageId(const std::string& path);
+    SDL_Rect ToPixels(const SDL_FRect& r) const;
+    void     Redraw(SDL_Rect px);
+    void     DrawMark(const Mark& m, SDL_Color c, int minPx);
+
+    SDL_Surface*      mSurface = nullptr;
+    SDL_FRect         mWorld{};
+    float             mScale = 1.0f;
+    bool              mDirty = true;
+    std::vector<Mark> mTiles;   // level.tiles order
+    std::vector<Mark> mMarkers; // coins, enemies, player — in that order
+    int               mCoins = 0, mEnemies = 0;
+
+    EditorSurfaceCache& mSurfaces;
+
+    // Interned tile image paths; Mark::image indexes mImages and mColors.
+    std::unordered_map<std::string, int> mImageIds;
+    std::vector<std::string>             mImages;
+    std::vector<SDL_Color>               mColors; // mean colour per image
+};
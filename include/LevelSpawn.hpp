@@ -0,0 +1,126 @@
+#pragma once
+// LevelSpawn.hpp
+// ---------------------------------------------------------------------------
+// The gameplay half of turning Level data into entities: transforms, tags,
+// colliders and behaviour state. No textures, no renderer.
+//
+// GameScene::Spawn() and ChunkStreamer use it via GameScene::SpawnTile(),
+// then attach render data (Renderable, AnimationState, destroy anims) on
+// top. The headless benchmark (bench/ForgeBench.cpp) uses it directly, so it
+// simulates exactly the component layout the game runs.
+// ---------------------------------------------------------------------------
+
+#include "Components.hpp"
+#include "LevelData.hpp"
+#include <cstdlib>
+#include <entt/entt.hpp>
+
+// A static-image tile: everything except render data and destroy anims.
+inline entt::entity SpawnTileEntity(entt::registry& reg, const TileSpawn& ts) {
+    auto tile = reg.create();
+    reg.emplace<Transform>(tile, ts.x, ts.y);
+
+    bool hasCustomHitbox = ts.HasHitbox();
+    int  colW            = hasCustomHitbox ? (ts.hitbox->w > 0 ? ts.hitbox->w : ts.w) : ts.w;
+    int  colH            = hasCustomHitbox ? (ts.hitbox->h > 0 ? ts.hitbox->h : ts.h) : ts.h;
+
+    if (ts.ladder) {
+        reg.emplace<LadderTag>(tile);
+        reg.emplace<Collider>(tile, colW, colH);
+    } else if (ts.HasSlope()) {
+        reg.emplace<TileTag>(tile);
+        reg.emplace<Collider>(tile, colW, colH);
+        reg.emplace<SlopeCollider>(tile, ts.slope->type, ts.slope->heightFrac);
+    } else if (ts.hazard) {
+        reg.emplace<HazardTag>(tile);
+        reg.emplace<Collider>(tile, colW, colH);
+        if (!ts.prop)
+            reg.emplace<TileTag>(tile);
+    } else {
+        reg.emplace<Collider>(tile, colW, colH);
+        if (!ts.prop)
+            reg.emplace<TileTag>(tile);
+    }
+    if (ts.prop)
+        reg.emplace<PropTag>(tile);
+    if (ts.HasAction())
+        reg.emplace<ActionTag>(tile,
+                               ts.action->group,
+                               ts.action->hitsRequired,
+                               ts.action->hitsRequired,
+                               ts.action->destroyAnimPath);
+
+    if (ts.antiGravity) {
+        reg.emplace<FloatTag>(tile);
+        FloatState fs;
+        fs.baseY    = ts.y;
+        fs.bobAmp   = 4.0f + (rand() % 50) * 0.08f;
+        fs.bobSpeed = 1.4f + (rand() % 80) * 0.01f;
+        fs.bobPhase = (rand() % 628) * 0.01f;
+        reg.emplace<FloatState>(tile, fs);
+    }
+    if (ts.HasMoving()) {
+        const auto& mp = *ts.moving;
+        // Moving platforms need PrevTransform so RenderSystem can
+        // interpolate their draw position between physics ticks.
+        if (!reg.all_of<PrevTransform>(tile))
+            reg.emplace<PrevTransform>(tile, ts.x, ts.y);
+        reg.emplace<MovingPlatformTag>(tile);
+        MovingPlatformState mps;
+        mps.horiz     = mp.horiz;
+        mps.range     = mp.range;
+        mps.speed     = mp.speed;
+        mps.groupId   = mp.groupId;
+        mps.originX   = ts.x;
+        mps.originY   = ts.y;
+        mps.loop      = mp.loop;
+        mps.trigger   = mp.trigger;
+        mps.triggered = false;
+        if (mp.loop) {
+            mps.phase   = mp.phase * mp.range;
+            mps.loopDir = mp.loopDir;
+            if (mp.horiz)
+                reg.get<Transform>(tile).x = ts.x + mps.phase;
+        } else {
+            mps.phase   = mp.phase * 6.28318f;
+            mps.loopDir = 1;
+        }
+        reg.emplace<MovingPlatformState>(tile, mps);
+    }
+    if (hasCustomHitbox)
+        reg.emplace<ColliderOffset>(tile, ts.hitbox->offX, ts.hitbox->offY);
+    if (ts.HasPowerUp() && !ts.powerUp->type.empty()) {
+        PowerUpType puType = PowerUpType::None;
+        if (ts.powerUp->type == "antigravity")
+            puType = PowerUpType::AntiGravity;
+        // Future: else if (ts.powerUp->type == "speedboost") puType =
+        // PowerUpType::SpeedBoost;
+        if (puType != PowerUpType::None)
+            reg.emplace<PowerUpTag>(tile, puType, ts.powerUp->duration);
+    }
+    return tile;
+}
+
+// An enemy's movement state (and float bob for anti-gravity enemies). The
+// caller adds the sprite-dependent parts: Renderable, AnimationState,
+// Collider, Health and, for profile enemies, EnemyAnimData.
+inline entt::entity SpawnEnemyEntity(entt::registry& reg, const EnemySpawn& es) {
+    float speed = es.speed;
+    float dx    = es.startLeft ? -speed : speed;
+    auto  enemy = reg.create();
+    reg.emplace<Transform>(enemy, es.x, es.y);
+    reg.emplace<PrevTransform>(enemy, es.x, es.y);
+    reg.emplace<Velocity>(enemy, dx, 0.0f, speed);
+    reg.emplace<EnemyTag>(enemy);
+
+    if (es.antiGravity) {
+        reg.emplace<FloatTag>(enemy);
+        FloatState fs;
+        fs.baseY    = es.y;
+        fs.bobAmp   = 5.0f + (rand() % 40) * 0.1f;
+        fs.bobSpeed = 1.6f + (rand() % 60) * 0.01f;
+        fs.bobPhase = (rand() % 628) * 0.01f;
+        reg.emplace<FloatState>(enemy, fs);
+    }
+    return enemy;
+}
@@ -0,0 +1,189 @@
+#pragma once
+// LevelStreamLoader.hpp
+//
+// Streaming level loader built on nlohmann's SAX interface.
+//
+// LoadLevel() parses the whole file into a json DOM and then converts it,
+// so peak memory is several times the file size and nothing can happen until
+// the last byte has been read. LoadLevelStreaming() instead reads the file
+// token by token: the small header fields (name, background, player, ...)
+// are collected into a tiny DOM, while every element of the "tiles", "coins"
+// and "enemies" arrays is built on its own, converted straight into a
+// TileSpawn / CoinSpawn / EnemySpawn and then discarded.
+//
+// An optional TileConsumer is called as each tile finishes parsing, so the
+// caller can start decoding / uploading textures while the rest of the file
+// is still being read. Tiles are still appended to Level::tiles in file order.
+#include "LevelData.hpp"
+#include "LevelSerializer.hpp"
+#include <fstream>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <print>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+// Called once per tile, in file order, right after it has been parsed.
+// The reference points into Level::tiles and stays valid until the next call.
+using TileConsumer = std::function<void(const TileSpawn&)>;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// LevelSaxHandler
+//
+// Generic DOM builder (same stack scheme as nlohmann's own SAX DOM parser)
+// with one twist: elements of the three top-level spawn arrays are built into
+// mElem instead of the document, and flushed into the Level on completion.
+// ─────────────────────────────────────────────────────────────────────────────
+class LevelSaxHandler : public nlohmann::json_sax<json> {
+  public:
+    LevelSaxHandler(Level& out, TileConsumer onTile)
+        : mOut(out)
+        , mOnTile(std::move(onTile)) {}
+
+    const json&        Header() const { return mRoot; }
+    const std::string& Error() const { return mError; }
+
+    bool null() override { return Value(nullptr); }
+    bool boolean(bool v) override { return Value(v); }
+    bool number_integer(number_integer_t v) override { return Value(v); }
+    bool number_unsigned(number_unsigned_t v) override { return Value(v); }
+    bool number_float(number_float_t v, const string_t&) override { return Value(v); }
+    bool string(string_t& v) override { return Value(std::move(v)); }
+    bool binary(binary_t& v) override { return Value(json::binary(std::move(v))); }
+
+    bool start_object(std::size_t) override { return Open(json::object()); }
+    bool start_array(std::size_t) override { return Open(json::array()); }
+    bool end_object() override { return Close(); }
+    bool end_array() override { return Close(); }
+
+    bool key(string_t& k) override {
+        mKey = std::move(k);
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&,
+                     const nlohmann::detail::exception& ex) override {
+        mError = ex.what();
+        return false;
+    }
+
+  private:
+    enum class Stream { None, Tiles, Coins, Enemies };
+
+    Level&             mOut;
+    TileConsumer       mOnTile;
+    json               mRoot;
+    json               mElem;   // element of a streamed array being built
+    std::vector<json*> mStack;  // open containers, innermost last
+    Stream             mStream = Stream::None;
+    std::string        mKey;
+    std::string        mError;
+
+    // Inserts v into the innermost open container and returns a pointer to it.
+    json* Insert(json&& v) {
+        if (mStack.empty()) {
+            mRoot = std::move(v);
+            return &mRoot;
+        }
+        json& top = *mStack.back();
+        if (top.is_array()) {
+            // Element of a streamed top-level array: build it off to the side.
+            if (mStream != Stream::None && mStack.size() == 2) {
+                mElem = std::move(v);
+                return &mElem;
+            }
+            top.push_back(std::move(v));
+            return &top.back();
+        }
+        json& slot = top[mKey];
+        slot       = std::move(v);
+        return &slot;
+    }
+
+    bool Value(json&& v) {
+        json* p = Insert(std::move(v));
+        if (p == &mElem)
+            Flush();
+        return true;
+    }
+
+    bool Open(json&& container) {
+        // "tiles" / "coins" / "enemies" directly under the root object
+        if (container.is_array() && mStack.size() == 1) {
+            mStream = (mKey == "tiles")     ? Stream::Tiles
+                    : (mKey == "coins")     ? Stream::Coins
+                    : (mKey == "enemies")   ? Stream::Enemies
+                                            : Stream::None;
+        }
+        mStack.push_back(Insert(std::move(container)));
+        return true;
+    }
+
+    bool Close() {
+        bool elemDone = (mStack.back() == &mElem);
+        mStack.pop_back();
+        if (elemDone)
+            Flush();
+        else if (mStack.size() == 1)
+            mStream = Stream::None;
+        return true;
+    }
+
+    void Flush() {
+        if (mElem.is_object()) {
+            switch (mStream) {
+            case Stream::Tiles:
+                mOut.tiles.push_back(TileSpawnFromJson(mElem));
+                if (mOnTile)
+                    mOnTile(mOut.tiles.back());
+                break;
+            case Stream::Coins:
+                mOut.coins.push_back(CoinSpawnFromJson(mElem));
+                break;
+            case Stream::Enemies:
+                mOut.enemies.push_back(EnemySpawnFromJson(mElem));
+                break;
+            case Stream::None:
+                break;
+            }
+        }
+        mElem = json();
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// LoadLevelStreaming
+//
+// Drop-in replacement for LoadLevel() with the same keys, defaults and log
+// output. On failure `out` may hold a partially loaded level.
+// ─────────────────────────────────────────────────────────────────────────────
+inline bool LoadLevelStreaming(const std::string& path, Level& out,
+                               const TileConsumer& onTile = {}) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        std::print("Failed to load level: {}\n", path);
+        return false;
+    }
+
+    out.coins.clear();
+    out.enemies.clear();
+    out.tiles.clear();
+
+    LevelSaxHandler handler(out, onTile);
+    if (!json::sax_parse(file, &handler)) {
+        std::print("JSON parse error in {}: {}\n", path, handler.Error());
+        return false;
+    }
+
+    if (!handler.Header().is_object()) {
+        std::print("JSON parse error in {}: root is not an object\n", path);
+        return false;
+    }
+    LevelHeaderFromJson(handler.Header(), out);
+
+    std::print("Level loaded: {} ({} coins, {} enemies)\n",
+               out.name, out.coins.size(), out.enemies.size());
+    return true;
+}
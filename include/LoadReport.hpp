@@ -0,0 +1,130 @@
+#pragma once
+// LoadReport.hpp
+// ---------------------------------------------------------------------------
+// Where a level load's time goes. Printed, and saved as JSON, on every
+// GameScene load.
+//
+// GameScene::Load() brackets the load with Begin() / End() and marks its
+// phases in order (level file, player sprites, enemies, tiles, ...); each
+// Phase() call ends the previous one. A phase names the asset class its
+// work is charged to:
+//
+//   report.Phase("player sprites", "player");
+//
+// Inside, the asset primitives time themselves with a Timer, charged to the
+// current class:
+//
+//   Parse    JSON profiles                 GameScene (Get*Profile)
+//   Scan     sprite folder listings        GameScene slot loaders
+//   Read     file bytes from disk          LoadImageFile()
+//   Decode   PNG -> surface                LoadImageFile()
+//   Convert  pixel format, atlas stitching LoadTileSurface(), SpriteSheet, ...
+//   Rotate   CPU tile rotation             LoadTileSurface()
+//   Upload   surface -> GPU texture        TextureRegistry::CreateFromSurface()
+//
+// End() prints three tables: each phase's wall time and the part no stage
+// covered ("other": the level JSON itself, entity creation); each asset
+// class's time per stage with files, bytes read and bytes uploaded; and the
+// entity counts given to Count(). The same data is written to
+// REPORT_DIR/<level>.json, replaced by the next load of that level.
+//
+// Only the thread that called Begin() records: the chunk streamer's worker
+// decodes ahead of play and is not part of the load. Outside a load a Timer
+// costs one thread_local read.
+// ---------------------------------------------------------------------------
+
+#include <SDL3/SDL.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+class LoadReport {
+  public:
+    static constexpr const char* REPORT_DIR = "load_reports";
+
+    enum Stage { Parse, Scan, Read, Decode, Convert, Rotate, Upload, STAGE_COUNT };
+
+    // Adds the time from construction to destruction, and optional bytes, to
+    // the current asset class. Does nothing outside a load.
+    class Timer {
+      public:
+        explicit Timer(Stage stage)
+            : mStage(stage)
+            , mOn(Recording())
+            , mStart(mOn ? SDL_GetPerformanceCounter() : 0) {}
+        ~Timer() {
+            if (mOn)
+                Get().AddStage(mStage, SDL_GetPerformanceCounter() - mStart, mBytes);
+        }
+        Timer(const Timer&)            = delete;
+        Timer& operator=(const Timer&) = delete;
+
+        void Bytes(Uint64 bytes) { mBytes = bytes; }
+
+      private:
+        Stage  mStage;
+        bool   mOn;
+        Uint64 mStart;
+        Uint64 mBytes = 0;
+    };
+
+    // Charges stage timers to `assetClass` until destroyed, overriding the
+    // phase's class (a string literal).
+    class AssetClass {
+      public:
+        explicit AssetClass(const char* assetClass);
+        ~AssetClass();
+        AssetClass(const AssetClass&)            = delete;
+        AssetClass& operator=(const AssetClass&) = delete;
+
+      private:
+        const char* mPrev;
+    };
+
+    static LoadReport& Get();
+
+    // True on the loading thread between Begin() and End().
+    [[nodiscard]] static bool Recording() { return sRecording; }
+
+    // Start a report for `level` on the calling thread.
+    void Begin(const std::string& level);
+    // End the current phase and start `name`, charged to `assetClass`.
+    void Phase(const char* name, const char* assetClass);
+    // Entity (or other) count for the report, e.g. Count("tiles", n).
+    void Count(const char* what, size_t n);
+    // Print the report and write REPORT_DIR/<level>.json.
+    void End();
+
+    void AddStage(Stage stage, Uint64 ticks, Uint64 bytes);
+
+  private:
+    LoadReport() = default;
+
+    struct ClassStats {
+        const char* name;
+        Uint64      ticks[STAGE_COUNT] = {};
+        int         calls[STAGE_COUNT] = {};
+        Uint64      bytes[STAGE_COUNT] = {};
+    };
+    struct PhaseStats {
+        const char* name       = nullptr;
+        Uint64      ticks      = 0;
+        Uint64      stageTicks = 0; // part covered by stage timers
+    };
+
+    ClassStats& Class(const char* name);
+    void        ClosePhase();
+    void        Print(double totalMs) const;
+    void        Write(double totalMs) const;
+
+    static thread_local bool sRecording;
+
+    std::string                                 mLevel;
+    Uint64                                      mStart      = 0;
+    Uint64                                      mStageTicks = 0; // all stages, all classes
+    const char*                                 mClass      = "other";
+    std::vector<ClassStats>                     mClasses;
+    std::vector<PhaseStats>                     mPhases;
+    PhaseStats                                  mOpen{}; // name == nullptr: none
+    std::vector<std::pair<const char*, size_t>> mCounts;
+};
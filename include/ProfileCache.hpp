@@ -0,0 +1,97 @@
+#pragma once
+// ProfileCache.hpp
+//
+// Process-wide cache of parsed PlayerProfile / EnemyProfile files.
+//
+// GetPlayerProfile() / GetEnemyProfile() return an immutable, shared profile.
+// A file is parsed once and handed to every caller (GameScene, TitleScene's
+// character picker, the creator scenes, ...) until its modification time or
+// size changes on disk, at which point the next lookup re-parses it. Each
+// lookup costs one stat(); callers that need the profile repeatedly (e.g.
+// GameScene across Respawn) should hold on to the returned shared_ptr.
+//
+// Files that exist but fail to parse are cached as nullptr for the same
+// mtime, so a broken profile is reported once rather than on every lookup.
+// Anyone who wants to edit a profile copies it: `PlayerProfile p = *shared;`.
+#include "EnemyProfile.hpp"
+#include "PlayerProfile.hpp"
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+template <typename T>
+class ProfileCache {
+  public:
+    using LoadFn = bool (*)(const std::string&, T&);
+
+    explicit ProfileCache(LoadFn load)
+        : mLoad(load) {}
+
+    // nullptr if the file is missing or unreadable.
+    std::shared_ptr<const T> Get(const std::string& path) {
+        std::error_code                      ec;
+        const std::filesystem::file_time_type mtime =
+            std::filesystem::last_write_time(path, ec);
+        if (ec) {
+            // Missing: forget any stale entry and let the loader report it.
+            Invalidate(path);
+            T tmp;
+            mLoad(path, tmp);
+            return nullptr;
+        }
+        const std::uintmax_t size = std::filesystem::file_size(path, ec);
+
+        std::lock_guard lock(mMutex);
+        auto            it = mEntries.find(path);
+        if (it != mEntries.end() && it->second.mtime == mtime && it->second.size == size)
+            return it->second.profile;
+
+        auto fresh = std::make_shared<T>();
+        std::shared_ptr<const T> result;
+        if (mLoad(path, *fresh))
+            result = std::move(fresh);
+        mEntries[path] = {mtime, size, result};
+        return result;
+    }
+
+    // Drops one path (or everything when path is empty). Outstanding
+    // shared_ptrs stay valid; they just stop being handed out.
+    void Invalidate(const std::string& path = "") {
+        std::lock_guard lock(mMutex);
+        if (path.empty())
+            mEntries.clear();
+        else
+            mEntries.erase(path);
+    }
+
+  private:
+    struct Entry {
+        std::filesystem::file_time_type mtime;
+        std::uintmax_t                  size = 0;
+        std::shared_ptr<const T>        profile; // nullptr = failed to parse
+    };
+
+    LoadFn                                 mLoad;
+    std::mutex                             mMutex;
+    std::unordered_map<std::string, Entry> mEntries;
+};
+
+inline ProfileCache<PlayerProfile>& PlayerProfileCache() {
+    static ProfileCache<PlayerProfile> cache(&LoadPlayerProfile);
+    return cache;
+}
+
+inline ProfileCache<EnemyProfile>& EnemyProfileCache() {
+    static ProfileCache<EnemyProfile> cache(&LoadEnemyProfile);
+    return cache;
+}
+
+inline std::shared_ptr<const PlayerProfile> GetPlayerProfile(const std::string& path) {
+    return PlayerProfileCache().Get(path);
+}
+
+inline std::shared_ptr<const EnemyProfile> GetEnemyProfile(const std::string& path) {
+    return EnemyProfileCache().Get(path);
+}
@@ -0,0 +1,94 @@
+#pragma once
+// Replay.hpp
+// ---------------------------------------------------------------------------
+// A recorded play session: what GameScene spawned from (level, player
+// profile, rand() seed, window size) plus one InputFrame per simulated tick.
+// Feeding the frames back through GameScene reproduces the session tick for
+// tick; a state checksum every CHECK_INTERVAL ticks pins down where a replay
+// stopped matching, if it ever does.
+//
+//   forge2d --record                  save every life to replays/*.f2dr
+//   forge2d --replay FILE             watch it (hold Tab to fast-forward)
+//   forge2d --replay FILE --headless  re-simulate without a window, verify
+//                                     the checksums and report ms/tick
+//
+// File format (.f2dr, little-endian):
+//   "F2DR" u32 version, u32 seed, u32 viewW, u32 viewH, f32 tickDt,
+//   str level, str profile                       (str = u16 length + bytes)
+//   u32 ticks, then runs of identical frames:    u16 count, u16 held,
+//                                                u16 pressed, u16 released
+//   u32 checks, then u32 checksum[checks]
+// Held keys without edges collapse into one 8-byte run, so a minute of play
+// is usually well under a kilobyte.
+//
+// Divergence sources the format does not capture: resizing the window
+// mid-session (systems clamp to the window size) and a different build.
+// ---------------------------------------------------------------------------
+
+#include "InputFrame.hpp"
+#include <SDL3/SDL.h>
+#include <entt/entt.hpp>
+#include <string>
+#include <vector>
+
+struct Replay {
+    static constexpr Uint32      VERSION        = 1;
+    static constexpr int         CHECK_INTERVAL = 60; // ticks between checksums
+    static constexpr const char* REPLAY_DIR     = "replays";
+
+    std::string levelPath;
+    std::string profilePath; // empty = default frost knight
+    Uint32      seed   = 0;  // srand() seed GameScene::Spawn() ran with
+    int         viewW  = 0;  // window size the systems were clamped to
+    int         viewH  = 0;
+    float       tickDt = 0.0f;
+
+    std::vector<InputFrame> frames;    // one per simulated tick
+    std::vector<Uint32>     checksums; // ReplayChecksum() after every
+                                       // CHECK_INTERVAL-th tick
+
+    // Call after simulating frames.back(); records a checksum when due.
+    void Checkpoint(entt::registry& reg);
+};
+
+bool SaveReplay(const std::string& path, const Replay& replay);
+bool LoadReplay(const std::string& path, Replay& out);
+
+// REPLAY_DIR/<level name>-<date>-<time>.f2dr
+std::string NewReplayPath(const std::string& levelPath);
+
+// Hash of the state a divergence shows up in first: player and enemy motion,
+// player health, and how many coins / solid tiles are left.
+Uint32 ReplayChecksum(entt::registry& reg);
+
+// Checks a replay against the scene re-simulating it, one tick at a time.
+class ReplayPlayer {
+  public:
+    explicit ReplayPlayer(Replay replay) : mReplay(std::move(replay)) {}
+
+    const Replay& Data() const { return mReplay; }
+    bool          Finished() const { return mTick >= mReplay.frames.size(); }
+    size_t        Tick() const { return mTick; }
+
+    // The frame for the next tick (an empty frame once Finished()).
+    InputFrame Next() { return Finished() ? InputFrame{} : mReplay.frames[mTick++]; }
+
+    // Call after simulating the frame Next() returned. Compares checksums and
+    // prints the outcome once the last frame has been simulated.
+    void Verify(entt::registry& reg);
+
+    // First tick whose checksum did not match, or -1.
+    long long DivergedAt() const { return mDivergedAt; }
+    int       Checked() const { return mChecked; }
+
+  private:
+    Replay    mReplay;
+    size_t    mTick       = 0;
+    long long mDivergedAt = -1;
+    int       mChecked    = 0;
+    bool      mReported   = false;
+};
+
+// Process-wide --record switch, read by GameScene on Load.
+void SetRecordReplays(bool on);
+bool RecordReplays();
@@ -1,6 +1,8 @@
 #ifndef SPRITESHEET_HPP
 #define SPRITESHEET_HPP
 
+#include "TextureRegistry.hpp"
+#include "TraceRecorder.hpp"
 #include <SDL3/SDL.h>
 #include <string>
 #include <unordered_map>
@@ -112,7 +114,8 @@ class SpriteSheet {
     /// Call FreeSurface() explicitly once you no longer need CPU-side access.
     SDL_Texture* CreateTexture(SDL_Renderer* renderer) {
         if (!texture && surface) {
-            texture = SDL_CreateTextureFromSurface(renderer, surface);
+            TRACE_SCOPE("gpu", "SpriteSheet upload");
+            texture = TextureRegistry::Get().CreateFromSurface(renderer, surface, "sprites");
             // Use nearest-neighbor scaling so pixel art stays crisp
             // instead of getting blurred by the default linear filter.
             if (texture)
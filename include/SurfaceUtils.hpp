@@ -1,7 +1,11 @@
 #pragma once
+#include "LoadReport.hpp"
+#include "TraceRecorder.hpp"
 #include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
 #include <SDL3_ttf/SDL_ttf.h>
 #include <cmath>
+#include <print>
 #include <string>
 
 /// Rotates an SDL_Surface 90 degrees clockwise.
@@ -120,6 +124,64 @@ inline SDL_Surface* RotateSurfaceAngle(SDL_Surface* src, float angleDeg) {
     return dst;
 }
 
+/// IMG_Load() as two steps, reading the file and then decoding it from memory,
+/// so a LoadReport can tell disk time from decode time. Returns nullptr on
+/// failure (SDL_GetError() says why); caller frees.
+inline SDL_Surface* LoadImageFile(const std::string& path) {
+    size_t size = 0;
+    void*  data = nullptr;
+    {
+        LoadReport::Timer t(LoadReport::Read);
+        data = SDL_LoadFile(path.c_str(), &size);
+        t.Bytes(size);
+    }
+    if (!data)
+        return nullptr;
+    SDL_Surface* surf = nullptr;
+    {
+        LoadReport::Timer t(LoadReport::Decode);
+        surf = IMG_Load_IO(SDL_IOFromConstMem(data, size), true);
+    }
+    SDL_free(data);
+    return surf;
+}
+
+/// Loads a tile image as a blend-enabled ARGB8888 surface, rotated clockwise
+/// by `rotation` (0/90/180/270). Touches no renderer state, so it is safe to
+/// call from a worker thread. Returns nullptr on failure; caller frees.
+inline SDL_Surface* LoadTileSurface(const std::string& path, int rotation = 0) {
+    TRACE_SCOPE("asset", "LoadTileSurface", path);
+    SDL_Surface* raw = LoadImageFile(path);
+    if (!raw) {
+        std::print("Failed to load tile: {}\n", path);
+        return nullptr;
+    }
+
+    SDL_Surface* conv = nullptr;
+    {
+        LoadReport::Timer t(LoadReport::Convert);
+        conv = SDL_ConvertSurface(raw, SDL_PIXELFORMAT_ARGB8888);
+    }
+    SDL_DestroySurface(raw);
+    if (!conv)
+        return nullptr;
+
+    SDL_SetSurfaceBlendMode(conv, SDL_BLENDMODE_BLEND);
+
+    if (rotation != 0) {
+        SDL_Surface* rot = nullptr;
+        {
+            LoadReport::Timer t(LoadReport::Rotate);
+            rot = RotateSurfaceDeg(conv, rotation);
+        }
+        if (rot) {
+            SDL_DestroySurface(conv);
+            return rot;
+        }
+    }
+    return conv;
+}
+
 /// Returns the x position needed to horizontally center text within a container.
 inline int CenterTextX(TTF_Font*          font,
                        const std::string& text,
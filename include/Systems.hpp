@@ -7,6 +7,7 @@
 #include <systems/CollisionSystem.hpp>
 #include <systems/HUDSystem.hpp>
 #include <systems/InputSystem.hpp>
+#include <systems/JumpSystem.hpp>
 #include <systems/LadderSystem.hpp>
 #include <systems/FloatingSystem.hpp>
 #include <systems/MovementSystem.hpp>
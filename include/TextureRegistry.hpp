@@ -0,0 +1,120 @@
+#pragma once
+// TextureRegistry.hpp
+// ---------------------------------------------------------------------------
+// Every SDL_Texture the engine creates, with its size and who owns it.
+//
+// Code creates and destroys textures through the registry instead of SDL:
+//
+//   SDL_Texture* t = TextureRegistry::Get().CreateFromSurface(ren, surf, "sprites");
+//   ...
+//   TextureRegistry::Get().Destroy(t);
+//
+// Each entry records the owner tag (a string literal), the estimated GPU
+// bytes (w * h * bytes per pixel) and the last frame it was used. "Used"
+// means drawn by RenderSystem, Text or Image, or handed out by a cache
+// (TileTextureCache); Touch() is cheap when the same texture is drawn
+// repeatedly, which is the common case for tiles.
+//
+// F6 toggles a debug view (drawn by Window::Update in every scene): the
+// total against the budget, then bytes and counts per owner.
+//
+// Budget: SetBudget(bytes) caps the total. At EndFrame(), called after each
+// presented frame, while the total is over the budget, the least recently
+// used *evictable* texture not used this frame is evicted. A texture is
+// evictable once its owner registers a TextureEvictor for it: the owner is
+// told to forget the pointer (it must be able to recreate the texture on
+// its next use), then the registry destroys it. Everything else — sprite
+// sheets, tiles held by entities, text — is resident and never evicted; if
+// residents alone exceed the budget, that is reported once rather than
+// acted on.
+// ---------------------------------------------------------------------------
+
+#include <SDL3/SDL.h>
+#include <unordered_map>
+#include <vector>
+
+class TextureEvictor {
+  public:
+    // Drop every reference to `tex`; the registry destroys it afterwards.
+    // Must not call TextureRegistry::Destroy() on it.
+    virtual void OnEvict(SDL_Texture* tex) = 0;
+
+  protected:
+    ~TextureEvictor() = default;
+};
+
+class TextureRegistry {
+  public:
+    struct OwnerStats {
+        const char* owner     = "";
+        int         count     = 0;
+        Uint64      bytes     = 0;
+        int         evictable = 0;
+    };
+
+    static TextureRegistry& Get();
+
+    // ── Creation / destruction (tracked wrappers around SDL) ────────────────
+    SDL_Texture* CreateFromSurface(SDL_Renderer* ren, SDL_Surface* surf, const char* owner);
+    SDL_Texture* Create(SDL_Renderer* ren, SDL_PixelFormat format, SDL_TextureAccess access,
+                        int w, int h, const char* owner);
+    // Untrack and SDL_DestroyTexture(); nullptr is ignored.
+    void Destroy(SDL_Texture* tex);
+
+    // Mark `tex` used this frame.
+    void Touch(SDL_Texture* tex) {
+        if (tex != mLastTouched)
+            TouchSlow(tex);
+    }
+
+    // Make `tex` evictable under the budget (nullptr makes it resident again).
+    void SetEvictor(SDL_Texture* tex, TextureEvictor* evictor);
+
+    // ── Budget ──────────────────────────────────────────────────────────────
+    void                 SetBudget(Uint64 bytes) { mBudget = bytes; } // 0 = unlimited
+    [[nodiscard]] Uint64 Budget() const { return mBudget; }
+
+    // Advance the frame counter and enforce the budget. Once per presented
+    // frame: iterations that draw nothing touch nothing, and counting them
+    // would make every texture look unused.
+    void EndFrame();
+
+    // ── Stats ───────────────────────────────────────────────────────────────
+    [[nodiscard]] Uint64 Bytes() const { return mBytes; }
+    [[nodiscard]] int    Count() const { return (int)mEntries.size(); }
+    [[nodiscard]] int    Evicted() const { return mEvicted; }
+    // Per owner tag, largest first.
+    [[nodiscard]] std::vector<OwnerStats> ByOwner() const;
+
+    // ── Debug view ──────────────────────────────────────────────────────────
+    void               ToggleView() { mView = !mView; }
+    [[nodiscard]] bool ViewVisible() const { return mView; }
+    // Top-left table drawn with SDL's debug font.
+    void DrawView(SDL_Renderer* ren) const;
+
+  private:
+    TextureRegistry() = default;
+
+    struct Entry {
+        const char*     owner    = "";
+        Uint64          bytes    = 0;
+        int             w        = 0;
+        int             h        = 0;
+        Uint64          lastUsed = 0; // frame number
+        TextureEvictor* evictor  = nullptr;
+    };
+
+    SDL_Texture* Track(SDL_Texture* tex, const char* owner);
+    void         TouchSlow(SDL_Texture* tex);
+    void         EnforceBudget();
+
+    std::unordered_map<SDL_Texture*, Entry> mEntries;
+    SDL_Texture*                            mLastTouched = nullptr;
+
+    Uint64 mFrame      = 1;
+    Uint64 mBytes      = 0;
+    Uint64 mBudget     = 0;
+    int    mEvicted    = 0;
+    bool   mWarnedOver = false;
+    bool   mView       = false;
+};
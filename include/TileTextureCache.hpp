@@ -0,0 +1,60 @@
+#pragma once
+// TileTextureCache.hpp
+//
+// GPU texture cache for tile-sized images, shared by GameScene and the level
+// editor canvas.
+//
+//   Get()          decodes a PNG from disk (rotated on the CPU by 0/90/180/270)
+//                  and uploads it once at native resolution. Key: path + rotation.
+//                  The renderer scales to the tile size at draw time with
+//                  PIXELART filtering, so one texture serves every tile size.
+//   FromSurface()  uploads a surface the caller already has in memory (editor
+//                  tiles, mip levels, badges), keyed by the surface itself so
+//                  a per-frame lookup builds no string. The surface's owner
+//                  must call Forget() before freeing it, or a new surface
+//                  allocated at the same address would hit the old texture.
+//
+// Failed disk loads are cached as nullptr so a missing image is reported once
+// and never retried per frame. All textures are destroyed by Clear() / the
+// destructor, which must run while the renderer is still alive.
+//
+// Textures are tracked by TextureRegistry under the owner tag given at
+// construction. An evictable cache lets the registry drop textures that fell
+// out of use when over its budget; the entry is forgotten and the next
+// Get() / FromSurface() recreates it. Only callers that look textures up
+// again every frame (the editor canvas) may be evictable — GameScene hands
+// the pointers to entities, so its cache stays resident.
+#include "TextureRegistry.hpp"
+#include <SDL3/SDL.h>
+#include <string>
+#include <unordered_map>
+
+class TileTextureCache : public TextureEvictor {
+  public:
+    explicit TileTextureCache(const char* owner = "tiles", bool evictable = false)
+        : mOwner(owner)
+        , mEvictable(evictable) {}
+    ~TileTextureCache() { Clear(); }
+
+    TileTextureCache(const TileTextureCache&)            = delete;
+    TileTextureCache& operator=(const TileTextureCache&) = delete;
+
+    SDL_Texture* Get(SDL_Renderer* ren, const std::string& path, int rotation = 0);
+    SDL_Texture* FromSurface(SDL_Renderer* ren, SDL_Surface* src);
+    void         Forget(const SDL_Surface* src);
+
+    int  Count() const { return (int)(mEntries.size() + mSurfaces.size()); }
+    void Clear();
+
+    void OnEvict(SDL_Texture* tex) override;
+
+  private:
+    static std::string Key(const std::string& path, int rotation);
+    SDL_Texture*       Upload(SDL_Renderer* ren, SDL_Surface* surf);
+
+    // Owned textures; nullptr = load failed.
+    std::unordered_map<std::string, SDL_Texture*>        mEntries;  // Get()
+    std::unordered_map<const SDL_Surface*, SDL_Texture*> mSurfaces; // FromSurface()
+    const char*                                          mOwner;
+    bool                                                 mEvictable;
+};
@@ -1,9 +1,11 @@
 #pragma once
 #include "Image.hpp"
+#include "LevelMinimap.hpp"
 #include "PlayerProfile.hpp"
 #include "Rectangle.hpp"
 #include "Scene.hpp"
 #include "Text.hpp"
+#include "TextureRegistry.hpp"
 #include "Window.hpp"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
@@ -102,11 +104,13 @@ class TitleScene : public Scene {
         if (mNamingActive)
             SDL_StopTextInput(mSDLWindow);
         for (auto& c : mCharCards) {
-            if (c.previewTex) { SDL_DestroyTexture(c.previewTex); c.previewTex = nullptr; }
-            for (auto* t : c.walkFrames) if (t) SDL_DestroyTexture(t);
+            if (c.previewTex) { TextureRegistry::Get().Destroy(c.previewTex); c.previewTex = nullptr; }
+            for (auto* t : c.walkFrames) if (t) TextureRegistry::Get().Destroy(t);
             c.walkFrames.clear();
         }
         mCharCards.clear();
+        freeLevelPreviews();
+        mLevelButtons.clear();
     }
 
     bool HandleEvent(SDL_Event& e) override {
@@ -160,6 +164,7 @@ class TitleScene : public Scene {
                         std::print("[Delete] FAILED: '{}' ec={}\n", mDelConfirmPath, ec.message());
                     else
                         std::print("[Delete] OK: '{}'\n", mDelConfirmPath);
+                    fs::remove(LevelMinimap::PreviewPath(mDelConfirmPath), ec);
                     mDelConfirmOpen = false;
                     mDelConfirmPath.clear();
                     scanLevels(); // refresh list
@@ -300,7 +305,8 @@ class TitleScene : public Scene {
                     SDL_Surface* conv = SDL_ConvertSurface(raw, SDL_PIXELFORMAT_ARGB8888);
                     SDL_DestroySurface(raw);
                     if (conv) {
-                        SDL_Texture* t = SDL_CreateTextureFromSurface(mRenderer, conv);
+                        SDL_Texture* t =
+                            TextureRegistry::Get().CreateFromSurface(mRenderer, conv, "title");
                         SDL_DestroySurface(conv);
                         if (t) {
                             SDL_SetTextureScaleMode(t, SDL_SCALEMODE_PIXELART);
@@ -495,8 +501,23 @@ class TitleScene : public Scene {
                                    : SDL_Color{50,150,75,255};
                 fillRect(ren, pr, playBg);
                 outlineRect(ren, pr, playBdr);
+
+                // Overview thumbnail saved by the editor (never parses the level)
+                SDL_Rect thumb = {pr.x + 4, pr.y + 4, (rowH - 8) * 2, rowH - 8};
+                fillRect(ren, thumb, {14, 16, 26, 255});
+                if (SDL_Texture* pv = mLevelButtons[i].preview) {
+                    float tw, th;
+                    SDL_GetTextureSize(pv, &tw, &th);
+                    float sc = std::min(thumb.w / tw, thumb.h / th);
+                    SDL_FRect dst = {thumb.x + (thumb.w - tw * sc) * 0.5f,
+                                     thumb.y + (thumb.h - th * sc) * 0.5f, tw * sc, th * sc};
+                    SDL_RenderTexture(ren, pv, nullptr, &dst);
+                }
+                outlineRect(ren, thumb, {20, 60, 35, 255});
+                SDL_Rect nameRect = {thumb.x + thumb.w, pr.y, pr.w - (thumb.x + thumb.w - pr.x), pr.h};
+
                 std::string nm = fs::path(mLevelButtons[i].path).stem().string();
-                auto [lx, ly] = Text::CenterInRect(nm, 16, pr);
+                auto [lx, ly] = Text::CenterInRect(nm, 16, nameRect);
                 Text lbl(nm, {255,255,255,255}, lx, ly, 16);
                 lbl.Render(ren);
 
@@ -627,6 +648,7 @@ class TitleScene : public Scene {
         SDL_Rect    rect     = {-1,-1,0,0};
         SDL_Rect    editRect = {-1,-1,0,0};
         SDL_Rect    delRect  = {-1,-1,0,0};
+        SDL_Texture* preview = nullptr;  // editor-saved minimap, owned here
     };
     int  mHoverRow       = -1;  // row under cursor (-1 = none)
     bool mHoverEdit      = false;
@@ -636,6 +658,7 @@ class TitleScene : public Scene {
     float mLoadingTimer  = 0.0f;
     int   mLoadingIdx    = -1;
     void scanLevels() {
+        freeLevelPreviews();
         mLevelButtons.clear();
         if (!fs::exists("levels")) return;
         std::vector<fs::path> found;
@@ -643,7 +666,12 @@ class TitleScene : public Scene {
             if (entry.path().extension() == ".json") found.push_back(entry.path());
         std::sort(found.begin(), found.end());
         for (const auto& p : found)
-            mLevelButtons.push_back({p.string(), {}, {}});
+            mLevelButtons.push_back({p.string(), {}, {}, {},
+                                     LevelMinimap::LoadPreview(mRenderer, p.string())});
+    }
+    void freeLevelPreviews() {
+        for (auto& lb : mLevelButtons)
+            if (lb.preview) { TextureRegistry::Get().Destroy(lb.preview); lb.preview = nullptr; }
     }
     void clampBrowserScroll() {
         int rowH = 44, rowGap = 4, ph = std::min(mWindowH - 80, 560);
@@ -0,0 +1,136 @@
+#pragma once
+// TraceRecorder.hpp
+// ---------------------------------------------------------------------------
+// Captures a timeline of the session as Chrome Trace Event JSON, for offline
+// hitch hunting in chrome://tracing or https://ui.perfetto.dev.
+//
+// What lands in a trace:
+//   - every PROFILE_ZONE scope (category "zone") and one "Frame" span per
+//     presented frame, from FrameProfiler
+//   - asset decodes        TRACE_SCOPE("asset", ...)  with the file path
+//   - GPU texture uploads  TRACE_SCOPE("gpu", ...)
+//   - text rasterisation   TRACE_SCOPE("text", ...)   with the string
+//   - scene loads / unloads and transitions ("scene")
+//
+// Recording is toggled at runtime (F4, or --trace on the command line) and
+// costs one relaxed atomic load per scope while off. While on, events go
+// into a fixed-capacity ring, so a long session keeps only the most recent
+// CAPACITY events and memory never grows past CAPACITY * 48 bytes (~12 MB).
+// Detail strings are interned into a table capped at MAX_STRINGS.
+//
+// Thread-safe: asset decodes on the chunk-streamer and thumbnail workers are
+// recorded on their own tracks. Compiled out with FORGE2D_PROFILER=OFF, like
+// the profiler zones.
+// ---------------------------------------------------------------------------
+
+#include <SDL3/SDL.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#ifndef FORGE2D_PROFILE
+#define FORGE2D_PROFILE 0
+#endif
+
+class TraceRecorder {
+  public:
+    static constexpr size_t      CAPACITY    = size_t{1} << 18; // events kept
+    static constexpr size_t      MAX_STRINGS = 16384;
+    static constexpr const char* TRACE_DIR   = "traces";
+
+    static TraceRecorder& Get();
+
+    [[nodiscard]] static bool Active() {
+        return sActive.load(std::memory_order_relaxed);
+    }
+
+    // Start a fresh capture (discarding any unsaved one). The calling thread
+    // is labelled "main" in the trace.
+    void Start();
+
+    // Stop and write the capture to TRACE_DIR/forge2d-<date>-<time>.json.
+    // Returns the path written, or "" if nothing was recording or the write
+    // failed.
+    std::string Stop();
+
+    // Start() or Stop(), for the F4 key.
+    void Toggle();
+
+    // ── Recording (no-ops unless Active()) ──────────────────────────────────
+    // A span from `start` to `end` (SDL_GetPerformanceCounter ticks).
+    // `name` and `cat` must be string literals; `detail` is copied.
+    void Complete(const char* cat, const char* name, Uint64 start, Uint64 end,
+                  std::string_view detail = {});
+
+    // A zero-length marker at the current time.
+    void Instant(const char* cat, const char* name, std::string_view detail = {});
+
+  private:
+    struct Event {
+        const char*  cat;
+        const char*  name;
+        Uint64       start;
+        Uint64       dur; // ticks; 0 with `instant`
+        SDL_ThreadID thread;
+        Sint32       detail; // index into mStrings, -1 for none
+        bool         instant;
+    };
+
+    TraceRecorder() = default;
+
+    void   Push(const Event& ev);
+    Sint32 Intern(std::string_view s); // mMutex held
+    bool   Write(const std::string& path) const;
+
+    static std::atomic<bool> sActive;
+
+    mutable std::mutex mMutex;
+    std::vector<Event> mEvents;        // ring of CAPACITY once full
+    size_t             mNext       = 0; // next ring slot once full
+    size_t             mDropped    = 0;
+    Uint64             mStart      = 0;
+    SDL_ThreadID       mMainThread = 0;
+
+    std::vector<std::string>                mStrings;
+    std::unordered_map<std::string, Sint32> mStringIds;
+};
+
+// RAII span behind TRACE_SCOPE. `detail` must outlive the scope.
+class TraceScope {
+  public:
+    TraceScope(const char* cat, const char* name, std::string_view detail = {})
+        : mCat(cat), mName(name), mDetail(detail),
+          mStart(TraceRecorder::Active() ? SDL_GetPerformanceCounter() : 0) {}
+    ~TraceScope() {
+        if (mStart && TraceRecorder::Active())
+            TraceRecorder::Get().Complete(mCat, mName, mStart, SDL_GetPerformanceCounter(),
+                                          mDetail);
+    }
+
+    TraceScope(const TraceScope&)            = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+  private:
+    const char*      mCat;
+    const char*      mName;
+    std::string_view mDetail;
+    Uint64           mStart;
+};
+
+#define FORGE2D_TRACE_CAT2(a, b) a##b
+#define FORGE2D_TRACE_CAT(a, b)  FORGE2D_TRACE_CAT2(a, b)
+
+#if FORGE2D_PROFILE
+#define TRACE_SCOPE(...) TraceScope FORGE2D_TRACE_CAT(traceScope_, __LINE__)(__VA_ARGS__)
+#define TRACE_INSTANT(...)                                                                  \
+    do {                                                                                    \
+        if (TraceRecorder::Active())                                                        \
+            TraceRecorder::Get().Instant(__VA_ARGS__);                                      \
+    } while (0)
+#else
+#define TRACE_SCOPE(...)   ((void)0)
+#define TRACE_INSTANT(...) ((void)0)
+#endif
@@ -21,6 +21,9 @@ using UniqueSDLRenderer = std::unique_ptr<SDL_Renderer, SDLRendererDeleter>;
 class Window {
   public:
     Window();
+    // Exact logical size in points (replays need the size they were recorded
+    // at); 0 picks the default size for that axis.
+    Window(int width, int height);
 
     SDL_Window*   GetRaw()      const;
     SDL_Renderer* GetRenderer() const;
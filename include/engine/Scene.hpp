@@ -28,6 +28,11 @@ class Scene {
     // RenderSystem so it can lerp between PrevTransform and Transform.
     virtual void Render(Window& window, float alpha = 1.0f) = 0;
 
+    // Whether the last Render() presented a frame. Scenes that skip idle
+    // frames return false for those so the main loop does not pace them as
+    // presents.
+    virtual bool Presented() const { return true; }
+
     // Returns a pointer to this scene's EnTT registry, or nullptr if the
     // scene has no registry (UI-only scenes, title screen, etc.).
     // SceneManager uses this to snapshot PrevTransform before each tick.
@@ -2,6 +2,7 @@
 #pragma once
 #include "Components.hpp"
 #include "Scene.hpp"
+#include "TraceRecorder.hpp"
 #include <SDL3/SDL.h>
 #include <engine/Scene.hpp>
 #include <entt/entt.hpp>
@@ -13,10 +14,7 @@ class Window;
 class SceneManager {
   public:
     void SetScene(std::unique_ptr<Scene> scene, Window& window) {
-        if (mCurrent)
-            mCurrent->Unload();
-        mCurrent = std::move(scene);
-        mCurrent->Load(window);
+        Switch(std::move(scene), window);
     }
 
     bool HandleEvent(SDL_Event& e) {
@@ -47,19 +45,20 @@ class SceneManager {
         mCurrent->Update(dt);
 
         auto next = mCurrent->NextScene();
-        if (next) {
-            mCurrent->Unload();
-            mCurrent = std::move(next);
-            mCurrent->Load(window);
-        }
+        if (next)
+            Switch(std::move(next), window);
     }
 
     // alpha: sub-step interpolation factor in [0, 1).
-    // Pass (accumulator / FIXED_DT) from the main loop so RenderSystem can
+    // Pass FixedStep::Alpha() from the main loop so RenderSystem can
     // lerp between PrevTransform and Transform for perfectly smooth motion.
-    void Render(Window& window, float alpha = 1.0f) {
-        if (mCurrent)
-            mCurrent->Render(window, alpha);
+    // Returns whether a frame was presented (false when the scene skipped an
+    // idle frame); FramePacer and TextureRegistry only count presented ones.
+    bool Render(Window& window, float alpha = 1.0f) {
+        if (!mCurrent)
+            return false;
+        mCurrent->Render(window, alpha);
+        return mCurrent->Presented();
     }
 
     void Shutdown() {
@@ -74,5 +73,18 @@ class SceneManager {
     }
 
   private:
+    // Unload the current scene and load `scene`; both halves show up as
+    // "scene" spans in a trace capture.
+    void Switch(std::unique_ptr<Scene> scene, Window& window) {
+        TRACE_INSTANT("scene", "Scene switch");
+        if (mCurrent) {
+            TRACE_SCOPE("scene", "Scene::Unload");
+            mCurrent->Unload();
+        }
+        mCurrent = std::move(scene);
+        TRACE_SCOPE("scene", "Scene::Load");
+        mCurrent->Load(window);
+    }
+
     std::unique_ptr<Scene> mCurrent;
 };
@@ -33,7 +33,7 @@ inline FloatingResult FloatingSystem(entt::registry& reg, float dt) {
 
         auto tileView  = reg.view<TileTag, Transform, Collider>();
         auto enemyView = reg.view<EnemyTag, Transform, Collider, Velocity>(
-            entt::exclude<DeadTag, FloatTag>);
+            entt::exclude<DeadTag, FloatTag, DormantTag>);
 
         enemyView.each([&](Transform& et, const Collider& ec, Velocity& ev) {
             ev.dy = std::min(ev.dy + ENEMY_GRAVITY * dt, ENEMY_MAX_FALL);
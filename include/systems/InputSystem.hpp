@@ -1,11 +1,17 @@
 #pragma once
 #include <Components.hpp>
+#include <InputFrame.hpp>
 #include <SDL3/SDL.h>
 #include <entt/entt.hpp>
 
-inline void InputSystem(entt::registry& reg, SDL_Event& e) {
+// Applies one tick's key edges (see InputFrame.hpp). Key-down effects fire on
+// every press edge, OS key repeats included; held flags (crouch, sprint,
+// climb, jump) follow the key's state at the end of the tick.
+inline void InputSystem(entt::registry& reg, const InputFrame& in) {
+    using K = InputKey;
+
     // F key — set attackPressed on the player's AttackState
-    if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_F) {
+    if (in.Pressed(K::F)) {
         auto atk = reg.view<PlayerTag, AttackState>();
         atk.each([](AttackState& a) {
             if (!a.isAttacking) a.attackPressed = true;
@@ -13,94 +19,69 @@ inline void InputSystem(entt::registry& reg, SDL_Event& e) {
     }
 
     auto view = reg.view<PlayerTag, Velocity, Renderable, GravityState, ClimbState>();
-    view.each([&e](Velocity& v, Renderable& r, GravityState& g, ClimbState& climb) {
+    view.each([&in](Velocity& v, Renderable& r, GravityState& g, ClimbState& climb) {
         // On the top wall the sprite is rotated 180 so left/right facing is inverted
         bool invertFlip = g.active && g.direction == GravityDir::UP;
-        if (e.type == SDL_EVENT_KEY_DOWN) {
-            switch (e.key.key) {
-                case SDLK_A: case SDLK_LEFT:
-                    if (!g.isCrouching) {
-                        v.dx    = -v.speed;
-                        // Only set flip for horizontal movement on horizontal-gravity walls
-                        if (g.direction == GravityDir::DOWN || g.direction == GravityDir::UP)
-                            r.flipH = !invertFlip;
-                    }
-                    break;
-                case SDLK_D: case SDLK_RIGHT:
-                    if (!g.isCrouching) {
-                        v.dx    = v.speed;
-                        if (g.direction == GravityDir::DOWN || g.direction == GravityDir::UP)
-                            r.flipH = invertFlip;
-                    }
-                    break;
-                case SDLK_W: case SDLK_UP:
-                    if (!g.isCrouching) {
-                        if (g.direction == GravityDir::LEFT) {
-                            // 90CW: flipH=true (face left) -> face up the left wall
-                            r.flipH = true;
-                        } else if (g.direction == GravityDir::RIGHT) {
-                            // 90CCW: flipH=false (face right) -> face up the right wall
-                            r.flipH = false;
-                        }
-                    }
-                    break;
-                case SDLK_S: case SDLK_DOWN:
-                    if (!g.isCrouching) {
-                        if (g.direction == GravityDir::LEFT) {
-                            // 90CW: flipH=false (face right) -> face down the left wall
-                            r.flipH = false;
-                        } else if (g.direction == GravityDir::RIGHT) {
-                            // 90CCW: flipH=true (face left) -> face down the right wall
-                            r.flipH = true;
-                        }
-                    }
-                    break;
-                case SDLK_LCTRL:
-                    g.isCrouching = true;
-                    // Don't zero velocity — let MovementSystem apply friction
-                    // so the character slides to a gradual stop.
-                    break;
-                case SDLK_LSHIFT:
-                    g.sprinting = true;
-                    break;
-            }
-        }
+        const bool leftDown  = in.Pressed(K::A) || in.Pressed(K::Left);
+        const bool rightDown = in.Pressed(K::D) || in.Pressed(K::Right);
+        const bool upDown    = in.Pressed(K::W) || in.Pressed(K::Up);
+        const bool downDown  = in.Pressed(K::S) || in.Pressed(K::Down);
 
-        if (e.type == SDL_EVENT_KEY_UP) {
-            if (e.key.key == SDLK_LCTRL)  g.isCrouching = false;
-            if (e.key.key == SDLK_LSHIFT) g.sprinting   = false;
+        if (leftDown && !g.isCrouching) {
+            v.dx    = -v.speed;
+            // Only set flip for horizontal movement on horizontal-gravity walls
+            if (g.direction == GravityDir::DOWN || g.direction == GravityDir::UP)
+                r.flipH = !invertFlip;
         }
-
-        // ── Event-driven W/S tracking for ladder climbing ─────────────────────────
-        // These flags are set/cleared by events so LadderSystem never polls the
-        // keyboard state — a tap only moves for exactly the frames the key is down.
-        if (e.type == SDL_EVENT_KEY_DOWN) {
-            if (e.key.key == SDLK_W || e.key.key == SDLK_UP)   climb.wPressed = true;
-            if (e.key.key == SDLK_S || e.key.key == SDLK_DOWN) climb.sPressed = true;
+        if (rightDown && !g.isCrouching) {
+            v.dx    = v.speed;
+            if (g.direction == GravityDir::DOWN || g.direction == GravityDir::UP)
+                r.flipH = invertFlip;
         }
-        if (e.type == SDL_EVENT_KEY_UP) {
-            if (e.key.key == SDLK_W || e.key.key == SDLK_UP)   climb.wPressed = false;
-            if (e.key.key == SDLK_S || e.key.key == SDLK_DOWN) climb.sPressed = false;
+        if (upDown && !g.isCrouching) {
+            if (g.direction == GravityDir::LEFT) {
+                // 90CW: flipH=true (face left) -> face up the left wall
+                r.flipH = true;
+            } else if (g.direction == GravityDir::RIGHT) {
+                // 90CCW: flipH=false (face right) -> face up the right wall
+                r.flipH = false;
+            }
         }
+        if (downDown && !g.isCrouching) {
+            if (g.direction == GravityDir::LEFT) {
+                // 90CW: flipH=false (face right) -> face down the left wall
+                r.flipH = false;
+            } else if (g.direction == GravityDir::RIGHT) {
+                // 90CCW: flipH=true (face left) -> face down the right wall
+                r.flipH = true;
+            }
+        }
+
+        // Don't zero velocity on crouch — let MovementSystem apply friction
+        // so the character slides to a gradual stop.
+        if (in.Changed(K::LCtrl))  g.isCrouching = in.Held(K::LCtrl);
+        if (in.Changed(K::LShift)) g.sprinting   = in.Held(K::LShift);
+
+        // ── Edge-driven W/S tracking for ladder climbing ──────────────────────────
+        // These flags only change on key edges so LadderSystem never looks at
+        // held keys — a tap only moves for exactly the ticks the key is down.
+        if (in.Changed(K::W) || in.Changed(K::Up))
+            climb.wPressed = in.Held(K::W) || in.Held(K::Up);
+        if (in.Changed(K::S) || in.Changed(K::Down))
+            climb.sPressed = in.Held(K::S) || in.Held(K::Down);
 
         if (!g.active) {
             // Only drive v.dy from input in free-float mode (wall-run gravity off).
             // During ladder climbing LadderSystem owns all vertical movement.
             if (!climb.climbing && !climb.atTop) {
-                if (e.type == SDL_EVENT_KEY_DOWN) {
-                    switch (e.key.key) {
-                        case SDLK_W: case SDLK_UP:   v.dy = -v.speed; break;
-                        case SDLK_S: case SDLK_DOWN: v.dy =  v.speed; break;
-                    }
-                }
+                if (upDown)   v.dy = -v.speed;
+                if (downDown) v.dy =  v.speed;
             }
         } else {
-            // Track spacebar held state via events — actual jump fires each frame
+            // Track spacebar held state via edges — actual jump fires each tick
             // in MovementSystem after CollisionSystem has settled isGrounded.
-            if (e.type == SDL_EVENT_KEY_DOWN && (e.key.key == SDLK_SPACE || e.key.key == SDLK_UP))
-                g.jumpHeld = true;
-            if (e.type == SDL_EVENT_KEY_UP && (e.key.key == SDLK_SPACE || e.key.key == SDLK_UP))
-                g.jumpHeld = false;
+            if (in.Changed(K::Space) || in.Changed(K::Up))
+                g.jumpHeld = in.Held(K::Space) || in.Held(K::Up);
         }
     });
 }
@@ -0,0 +1,20 @@
+#pragma once
+#include <Components.hpp>
+#include <entt/entt.hpp>
+
+// Applies a queued jump (GravityState::jumpHeld, set by InputSystem on Space)
+// once the player is grounded. Runs after CollisionSystem so isGrounded is
+// this tick's. Not used in GravityMode::OpenWorld.
+inline void JumpSystem(entt::registry& reg) {
+    auto jumpView = reg.view<PlayerTag, GravityState, AnimationSet>();
+    jumpView.each([](GravityState& g, const AnimationSet& set) {
+        // Respect slot capability: no jump frames = jumping disabled.
+        if (g.active && g.jumpHeld && g.isGrounded && !set.jump.empty()) {
+            g.velocity   = -JUMP_FORCE;
+            g.isGrounded = false;
+            g.jumpHeld   = false;
+        } else if (set.jump.empty()) {
+            g.jumpHeld = false; // drain the held flag so it doesn't queue
+        }
+    });
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include <Components.hpp>
+#include <InputFrame.hpp>
 #include <SDL3/SDL.h>
 #include <algorithm>
 #include <entt/entt.hpp>
@@ -16,9 +17,8 @@
 //   climbing — gravity off, W moves up, S moves down, no input = frozen
 //   atTop   — gravity off, locked to topRestY, S descends, Space jumps off
 // ─────────────────────────────────────────────────────────────────────────────
-inline void LadderSystem(entt::registry& reg, float dt) {
-    const bool* keys      = SDL_GetKeyboardState(nullptr);
-    bool        spaceHeld = keys[SDL_SCANCODE_SPACE];
+inline void LadderSystem(entt::registry& reg, float dt, const InputFrame& in) {
+    bool spaceHeld = in.Held(InputKey::Space);
 
     auto ladderView = reg.view<LadderTag, Transform, Collider>();
     auto playerView =
@@ -1,25 +1,26 @@
 #pragma once
 #include <Components.hpp>
+#include <InputFrame.hpp>
 #include <SDL3/SDL.h>
 #include <cmath>
 #include <entt/entt.hpp>
 
-inline void MovementSystem(entt::registry& reg, float dt, int windowW) {
-    const bool* keys = SDL_GetKeyboardState(nullptr);
+inline void MovementSystem(entt::registry& reg, float dt, int windowW, const InputFrame& in) {
+    using K = InputKey;
 
     auto playerView = reg.view<Transform, Velocity, GravityState, PlayerTag, ClimbState>();
-    playerView.each([dt, keys](Transform& t, Velocity& v, GravityState& g, const ClimbState& climb) {
+    playerView.each([dt, &in](Transform& t, Velocity& v, GravityState& g, const ClimbState& climb) {
         constexpr float friction = 3.0f;
 
         if (!g.active) {
             // While climbing or parked at top, LadderSystem owns v.dy entirely.
             // Only apply horizontal movement here — never touch v.dy.
             if (climb.climbing || climb.atTop) {
-                // Drive horizontal velocity directly from keyboard state each
+                // Drive horizontal velocity directly from held keys each
                 // frame so strafe feels as responsive as normal movement.
                 // CLIMB_STRAFE_SPEED is the max speed while on the ladder.
-                bool leftHeld  = keys[SDL_SCANCODE_A] || keys[SDL_SCANCODE_LEFT];
-                bool rightHeld = keys[SDL_SCANCODE_D] || keys[SDL_SCANCODE_RIGHT];
+                bool leftHeld  = in.Held(K::A) || in.Held(K::Left);
+                bool rightHeld = in.Held(K::D) || in.Held(K::Right);
                 if (leftHeld && !rightHeld) {
                     v.dx = -CLIMB_STRAFE_SPEED;
                 } else if (rightHeld && !leftHeld) {
@@ -34,10 +35,10 @@ inline void MovementSystem(entt::registry& reg, float dt, int windowW) {
                 return;
             }
             // Free-float mode (gravity off for other reasons, e.g. wall-run punishment)
-            bool moving = keys[SDL_SCANCODE_W] || keys[SDL_SCANCODE_S] ||
-                          keys[SDL_SCANCODE_A] || keys[SDL_SCANCODE_D] ||
-                          keys[SDL_SCANCODE_UP] || keys[SDL_SCANCODE_DOWN] ||
-                          keys[SDL_SCANCODE_LEFT] || keys[SDL_SCANCODE_RIGHT];
+            bool moving = in.Held(K::W) || in.Held(K::S) ||
+                          in.Held(K::A) || in.Held(K::D) ||
+                          in.Held(K::Up) || in.Held(K::Down) ||
+                          in.Held(K::Left) || in.Held(K::Right);
             if (!moving) {
                 v.dx -= v.dx * friction * dt;
                 v.dy -= v.dy * friction * dt;
@@ -71,12 +72,12 @@ inline void MovementSystem(entt::registry& reg, float dt, int windowW) {
             switch (g.direction) {
                 case GravityDir::DOWN:
                 case GravityDir::UP: {
-                    if (keys[SDL_SCANCODE_A] || keys[SDL_SCANCODE_LEFT])
+                    if (in.Held(K::A) || in.Held(K::Left))
                         v.dx = -effSpeed;
-                    if (keys[SDL_SCANCODE_D] || keys[SDL_SCANCODE_RIGHT])
+                    if (in.Held(K::D) || in.Held(K::Right))
                         v.dx = effSpeed;
-                    if (!keys[SDL_SCANCODE_A] && !keys[SDL_SCANCODE_D]
-                     && !keys[SDL_SCANCODE_LEFT] && !keys[SDL_SCANCODE_RIGHT]) {
+                    if (!in.Held(K::A) && !in.Held(K::D)
+                     && !in.Held(K::Left) && !in.Held(K::Right)) {
                         v.dx -= v.dx * friction * dt;
                         if (std::abs(v.dx) < 0.5f)
                             v.dx = 0.0f;
@@ -86,12 +87,12 @@ inline void MovementSystem(entt::registry& reg, float dt, int windowW) {
                 }
                 case GravityDir::LEFT:
                 case GravityDir::RIGHT: {
-                    if (keys[SDL_SCANCODE_W] || keys[SDL_SCANCODE_UP])
+                    if (in.Held(K::W) || in.Held(K::Up))
                         v.dy = -effSpeed;
-                    if (keys[SDL_SCANCODE_S] || keys[SDL_SCANCODE_DOWN])
+                    if (in.Held(K::S) || in.Held(K::Down))
                         v.dy = effSpeed;
-                    if (!keys[SDL_SCANCODE_W] && !keys[SDL_SCANCODE_S]
-                     && !keys[SDL_SCANCODE_UP] && !keys[SDL_SCANCODE_DOWN]) {
+                    if (!in.Held(K::W) && !in.Held(K::S)
+                     && !in.Held(K::Up) && !in.Held(K::Down)) {
                         v.dy -= v.dy * friction * dt;
                         if (std::abs(v.dy) < 0.5f)
                             v.dy = 0.0f;
@@ -152,7 +153,7 @@ inline void MovementSystem(entt::registry& reg, float dt, int windowW) {
     }
 
     auto enemyView = reg.view<EnemyTag, Transform, Velocity, Collider, Renderable>(
-        entt::exclude<DeadTag>);
+        entt::exclude<DeadTag, DormantTag>);
     enemyView.each([&](entt::entity ent, Transform& t, Velocity& v, const Collider& c, Renderable& r) {
         // Enemy AI: if within aggro range, walk toward the player.
         // Skip chasing while stunned (HitFlash active = just got hit).
@@ -1,6 +1,8 @@
 #pragma once
+#include <AnimatedTileLibrary.hpp>
 #include <Components.hpp>
 #include <SDL3/SDL.h>
+#include <TextureRegistry.hpp>
 #include <algorithm>
 #include <cmath>
 #include <entt/entt.hpp>
@@ -22,14 +24,32 @@
 //   drawX = prevX + (currX - prevX) * alpha
 // Tiles (TileTag, LadderTag, PropTag) are static — they skip interpolation.
 // Moving platforms do have PrevTransform and interpolate naturally.
+//
+// animTiles: entities with an AnimatedTileRef draw from this library's shared
+//        atlas at the frame its clock selects, instead of Renderable's sheet.
 inline void RenderSystem(entt::registry& reg, SDL_Renderer* renderer,
                          float camX = 0.0f, float camY = 0.0f,
                          int vw = 0, int vh = 0,
                          const std::vector<entt::entity>* sortedTiles = nullptr,
-                         float alpha = 1.0f) {
+                         float alpha = 1.0f,
+                         const AnimatedTileLibrary* animTiles = nullptr) {
     if (vw == 0 || vh == 0)
         SDL_GetRenderOutputSize(renderer, &vw, &vh);
 
+    // Sheet + src rect for an entity: the shared atlas frame for animated
+    // tiles, otherwise Renderable's own sheet at the AnimationState frame.
+    auto resolve = [&](entt::entity e, const Renderable& r, const AnimationState& anim,
+                       SDL_Rect& src) -> SDL_Texture* {
+        if (animTiles)
+            if (const auto* ref = reg.try_get<AnimatedTileRef>(e))
+                if (SDL_Texture* atlas = animTiles->Resolve(*ref, src))
+                    return atlas;
+        int idx = anim.currentFrame;
+        if (idx >= (int)r.frames.size()) idx = 0;
+        src = r.frames[idx];
+        return r.sheet;
+    };
+
     auto culled = [&](float wx, float wy, int w, int h) -> bool {
         return wx + w  <= camX      ||
                wx      >= camX + vw ||
@@ -71,9 +91,8 @@ inline void RenderSystem(entt::registry& reg, SDL_Renderer* renderer,
             auto& anim = *anip;
             if (!r.sheet || r.frames.empty()) continue;
 
-            int tFrameIdx = anim.currentFrame;
-            if (tFrameIdx >= (int)r.frames.size()) tFrameIdx = 0;
-            const SDL_Rect& src = r.frames[tFrameIdx];
+            SDL_Rect     src;
+            SDL_Texture* sheet = resolve(entity, r, anim, src);
             // Use renderW/H when set (native-res tiles); fall back to src dims.
             const int tDrawW = (r.renderW > 0) ? r.renderW : src.w;
             const int tDrawH = (r.renderH > 0) ? r.renderH : src.h;
@@ -87,7 +106,8 @@ inline void RenderSystem(entt::registry& reg, SDL_Renderer* renderer,
                 angle = (double)fs->spinAngle;
 
             SDL_FRect srcF = {(float)src.x, (float)src.y, (float)src.w, (float)src.h};
-            SDL_RenderTextureRotated(renderer, r.sheet, &srcF, &dst, angle, nullptr, SDL_FLIP_NONE);
+            TextureRegistry::Get().Touch(sheet);
+            SDL_RenderTextureRotated(renderer, sheet, &srcF, &dst, angle, nullptr, SDL_FLIP_NONE);
 
             // HitFlash overlay
             if (const auto* hf = reg.try_get<HitFlash>(entity)) {
@@ -119,12 +139,11 @@ inline void RenderSystem(entt::registry& reg, SDL_Renderer* renderer,
                   const AnimationState& anim) {
         if (!r.sheet || r.frames.empty()) return;
 
-        // Clamp frame index — protects against a 1-frame window where
-        // AnimationSystem has advanced currentFrame but PlayerStateSystem
+        // resolve() clamps the frame index — protects against a 1-frame window
+        // where AnimationSystem has advanced currentFrame but PlayerStateSystem
         // hasn't swapped the frames vector yet (or vice versa).
-        int frameIdx = anim.currentFrame;
-        if (frameIdx >= (int)r.frames.size()) frameIdx = 0;
-        const SDL_Rect& src = r.frames[frameIdx];
+        SDL_Rect     src;
+        SDL_Texture* sheet = resolve(entity, r, anim, src);
         // Use the intended render size when set; fall back to source frame dims.
         const int drawW = (r.renderW > 0) ? r.renderW : src.w;
         const int drawH = (r.renderH > 0) ? r.renderH : src.h;
@@ -146,13 +165,13 @@ inline void RenderSystem(entt::registry& reg, SDL_Renderer* renderer,
         bool colorModded = false;
         if (hf && hf->timer > 0.0f) {
             // Enemy hit flash — bright red tint
-            SDL_SetTextureColorMod(r.sheet, 255, 60, 60);
+            SDL_SetTextureColorMod(sheet, 255, 60, 60);
             colorModded = true;
         } else if (inv && inv->isInvincible && (int)(inv->remaining * 10.0f) % 2 == 0) {
-            SDL_SetTextureColorMod(r.sheet, 255, 0, 0);
+            SDL_SetTextureColorMod(sheet, 255, 0, 0);
             colorModded = true;
         } else if (hz && hz->active && (int)(hz->flashTimer * 8.0f) % 2 == 0) {
-            SDL_SetTextureColorMod(r.sheet, 255, 80, 80);
+            SDL_SetTextureColorMod(sheet, 255, 80, 80);
             colorModded = true;
         }
 
@@ -219,9 +238,10 @@ inline void RenderSystem(entt::registry& reg, SDL_Renderer* renderer,
         // with nearest-neighbor, keeping pixel art crisp.
         SDL_FRect srcF = {(float)src.x, (float)src.y, (float)src.w, (float)src.h};
         SDL_FRect dst  = {rx, ry, (float)drawW, (float)drawH};
-        SDL_RenderTextureRotated(renderer, r.sheet, &srcF, &dst, angle, nullptr, flip);
+        TextureRegistry::Get().Touch(sheet);
+        SDL_RenderTextureRotated(renderer, sheet, &srcF, &dst, angle, nullptr, flip);
 
         if (colorModded)
-            SDL_SetTextureColorMod(r.sheet, 255, 255, 255);
+            SDL_SetTextureColorMod(sheet, 255, 255, 255);
     });
 }
@@ -0,0 +1,198 @@
+#pragma once
+// BulkTools.hpp
+//
+// Multi-tile tools: Fill (flood fill / re-skin) and Stamp (paint with the
+// clipboard). Both apply their edits through EditorBulkOps, so every click
+// or stamp is one batched append to Level::tiles and one undo op.
+
+#include "EditorBulkOps.hpp"
+#include "tools/EditorTool.hpp"
+#include "tools/PlacementTools.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// FillTool
+// ═══════════════════════════════════════════════════════════════════════════════
+// Click empty space: fill the enclosed empty area (bounded by tiles and the
+// visible canvas) with the palette tile. Click a tile: re-skin the connected
+// run of identical tiles. Scroll changes the fill tile size, like TileTool.
+class FillTool final : public EditorTool {
+  public:
+    [[nodiscard]] const char* Name() const override { return "Fill"; }
+
+    int   tileW       = 38;
+    int   tileH       = 38;
+    float scrollAccum = 0.0f;
+
+    // Set by the orchestrator before dispatch, as for TileTool.
+    TilePlacementInfo placementInfo;
+
+    ToolResult OnMouseDown(EditorToolContext& ctx, int mx, int my,
+                           Uint8 button, SDL_Keymod /*mods*/) override {
+        if (button != SDL_BUTTON_LEFT) return ToolResult::Ignored;
+        if (my < ctx.ToolbarH() || mx >= ctx.CanvasW()) return ToolResult::Ignored;
+
+        if (!placementInfo.hasSelection || placementInfo.isFolder) {
+            ctx.SetStatus("Fill: pick a tile in the palette first");
+            return ToolResult::Consumed;
+        }
+
+        TileSpawn proto;
+        proto.w         = tileW;
+        proto.h         = tileH;
+        proto.imagePath = placementInfo.imagePath;
+
+        auto [wx, wy] = ctx.ScreenToWorld(mx, my);
+        bool truncated = false;
+        int  n = EditorBulkOps::FloodFill(ctx.level, ctx.history, ctx.spatial, ctx.Grid(),
+                                          VisibleWorldRect(ctx), wx, wy, proto, &truncated);
+        if (n == 0)
+            ctx.SetStatus("Fill: nothing to fill here");
+        else
+            ctx.SetStatus("Fill: " + std::to_string(n) + " tile(s) " + placementInfo.label +
+                          (truncated ? "  (capped)" : ""));
+        return ToolResult::Consumed;
+    }
+
+    ToolResult OnScroll(EditorToolContext& ctx, float wheelY,
+                        int /*mx*/, int /*my*/, SDL_Keymod /*mods*/) override {
+        scrollAccum += wheelY;
+        int steps = static_cast<int>(scrollAccum);
+        if (steps != 0) {
+            scrollAccum -= steps;
+            tileW = std::max(ctx.Grid(), tileW + steps * ctx.Grid());
+            tileH = tileW;
+            ctx.SetStatus("Fill tile size: " + std::to_string(tileW));
+        }
+        return ToolResult::Consumed;
+    }
+
+    void OnActivate(EditorToolContext& ctx) override {
+        scrollAccum = 0.0f;
+        ctx.SetStatus("Fill: click empty space to fill, a tile to re-skin its run");
+    }
+
+  private:
+    // World rect of the canvas area between the toolbar and the bottom bar.
+    static SDL_Rect VisibleWorldRect(EditorToolContext& ctx) {
+        int winW = 0, winH = 0;
+        if (ctx.sdlWindow) SDL_GetWindowSize(ctx.sdlWindow, &winW, &winH);
+        auto [x0, y0] = ctx.ScreenToWorld(0, ctx.ToolbarH());
+        auto [x1, y1] = ctx.ScreenToWorld(ctx.CanvasW(),
+                                          std::max(ctx.ToolbarH(), winH - ctx.BottomBarH()));
+        return {x0, y0, x1 - x0, y1 - y0};
+    }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// StampTool
+// ═══════════════════════════════════════════════════════════════════════════════
+// Paints copies of the clipboard (Select + Ctrl+C). Click stamps once at the
+// cursor; dragging stamps on a lattice of clipboard-sized steps from the
+// first stamp, so copies butt up against each other without overlapping.
+// The whole drag is one undo step.
+class StampTool final : public EditorTool {
+  public:
+    [[nodiscard]] const char* Name() const override { return "Stamp"; }
+
+    // Set by the orchestrator before dispatch; not owned.
+    const EditorBulkOps::Clipboard* clipboard = nullptr;
+
+    ToolResult OnMouseDown(EditorToolContext& ctx, int mx, int my,
+                           Uint8 button, SDL_Keymod /*mods*/) override {
+        if (button != SDL_BUTTON_LEFT) return ToolResult::Ignored;
+        if (my < ctx.ToolbarH() || mx >= ctx.CanvasW()) return ToolResult::Ignored;
+        if (!clipboard || clipboard->Empty()) {
+            ctx.SetStatus("Stamp: copy tiles first (Select, then Ctrl+C)");
+            return ToolResult::Consumed;
+        }
+        auto [sx, sy] = ctx.SnapToGrid(mx, my);
+        mStamping  = true;
+        mOriginX   = sx;
+        mOriginY   = sy;
+        mUngrouped = 0;
+        mStamped.clear();
+        StampCell(ctx, 0, 0);
+        return ToolResult::Consumed;
+    }
+
+    ToolResult OnMouseMove(EditorToolContext& ctx, int mx, int my) override {
+        if (!mStamping || !clipboard || clipboard->Empty()) return ToolResult::Ignored;
+        if (my < ctx.ToolbarH() || mx >= ctx.CanvasW()) return ToolResult::Consumed;
+        auto [sx, sy] = ctx.SnapToGrid(mx, my);
+        StampCell(ctx, EditorBulkOps::FloorDiv(sx - mOriginX, std::max(1, clipboard->w)),
+                  EditorBulkOps::FloorDiv(sy - mOriginY, std::max(1, clipboard->h)));
+        return ToolResult::Consumed;
+    }
+
+    ToolResult OnMouseUp(EditorToolContext& ctx, int /*mx*/, int /*my*/,
+                         Uint8 button, SDL_Keymod /*mods*/) override {
+        if (button != SDL_BUTTON_LEFT || !mStamping) return ToolResult::Ignored;
+        mStamping = false;
+        const auto  tiles = mStamped.size() * clipboard->tiles.size();
+        std::string msg   = "Stamped " + std::to_string(mStamped.size()) + "x (" +
+                            std::to_string(tiles) + " tiles)";
+        if (mUngrouped > 0)
+            msg += "  (" + std::to_string(mUngrouped) + " standalone: action groups 1-" +
+                   std::to_string(ActionData::MAX_GROUP) + " all in use)";
+        ctx.SetStatus(msg);
+        return ToolResult::Consumed;
+    }
+
+    void OnActivate(EditorToolContext& ctx) override {
+        mStamping = false;
+        ctx.SetStatus(clipboard && !clipboard->Empty()
+                          ? "Stamp: click or drag to paint the clipboard"
+                          : "Stamp: copy tiles first (Select, then Ctrl+C)");
+    }
+
+    void OnHistoryApplied(EditorToolContext& ctx) override {
+        EditorTool::OnHistoryApplied(ctx);
+        mStamping = false;
+    }
+
+    // Outline of the clipboard under the cursor.
+    void RenderOverlay(EditorToolContext& ctx, SDL_Surface* screen, int canvasW) override {
+        if (!clipboard || clipboard->Empty()) return;
+        float fmx, fmy;
+        SDL_GetMouseState(&fmx, &fmy);
+        int mx = (int)fmx, my = (int)fmy;
+        if (my < ctx.ToolbarH() || mx >= canvasW) return;
+
+        auto [wx, wy] = ctx.SnapToGrid(mx, my);
+        float zoom = ctx.Zoom();
+        auto  toScreen = [&](float x, float y, int w, int h) {
+            return SDL_Rect{static_cast<int>((x - ctx.CamX()) * zoom),
+                            static_cast<int>((y - ctx.CamY()) * zoom),
+                            static_cast<int>(w * zoom), static_cast<int>(h * zoom)};
+        };
+        SDL_Rect box = toScreen((float)wx, (float)wy, clipboard->w, clipboard->h);
+        EditorToolContext::DrawRectAlpha(screen, box, {255, 200, 60, 30});
+        // Per-tile outlines only while they stay cheap and legible.
+        if (clipboard->tiles.size() <= 256 && zoom >= 0.5f)
+            for (const auto& t : clipboard->tiles)
+                EditorToolContext::DrawOutline(
+                    screen, toScreen(wx + t.x, wy + t.y, t.w, t.h), {255, 200, 60, 120}, 1);
+        EditorToolContext::DrawOutline(screen, box, {255, 200, 60, 220}, 2);
+    }
+
+  private:
+    void StampCell(EditorToolContext& ctx, int i, int j) {
+        for (const auto& c : mStamped)
+            if (c.first == i && c.second == j) return;
+        mStamped.push_back({i, j});
+        if (mOriginX + i * clipboard->w < 0 || mOriginY + j * clipboard->h < 0) return;
+        int ungrouped = 0;
+        EditorBulkOps::Paste(ctx.level, ctx.history, *clipboard,
+                             static_cast<float>(mOriginX + i * clipboard->w),
+                             static_cast<float>(mOriginY + j * clipboard->h), &ungrouped);
+        mUngrouped += ungrouped;
+    }
+
+    bool                             mStamping = false;
+    int                              mOriginX = 0, mOriginY = 0;
+    int                              mUngrouped = 0; // tiles stamped without action group
+    std::vector<std::pair<int, int>> mStamped; // lattice cells painted this drag
+};
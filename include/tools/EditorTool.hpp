@@ -39,6 +39,8 @@ enum class ToolId {
     Select,
     MoveCam,
     PowerUp,
+    Fill,
+    Stamp,
 };
 
 // Return value from event handlers: tells the orchestrator whether the
@@ -92,6 +94,14 @@ class EditorTool {
         return ToolResult::Ignored;
     }
 
+    // Called after undo/redo rewrote the level. Entity indices the tool holds
+    // (selection, drag target, open popup) may no longer exist; drop them.
+    // The default cancels the generic entity drag below.
+    virtual void OnHistoryApplied(EditorToolContext& /*ctx*/) {
+        mIsDragging = false;
+        mDragIndex  = -1;
+    }
+
     // ── Render overlay ───────────────────────────────────────────────────────
     // Called after the main canvas is rendered but before the toolbar/palette.
     // Tools that need visual feedback (selection marquee, resize handles,
@@ -104,6 +114,8 @@ class EditorTool {
     [[nodiscard]] bool IsDragging() const { return mIsDragging; }
 
   protected:
+    using Kind = EditorHistory::Kind;
+
     // Generic entity drag state -- used by modifier tools that don't have
     // their own specialized drag (e.g. Prop, Ladder, Hazard, AntiGrav).
     bool mIsDragging  = false;
@@ -140,13 +152,16 @@ class EditorTool {
         if (!mIsDragging || mDragIndex < 0) return;
         auto [sx, sy] = ctx.SnapToGrid(mx, my);
         if (mDragIsTile && mDragIndex < static_cast<int>(ctx.level.tiles.size())) {
+            ctx.Touch(Kind::Tile, mDragIndex);
             ctx.level.tiles[mDragIndex].x = static_cast<float>(sx);
             ctx.level.tiles[mDragIndex].y = static_cast<float>(sy);
         } else if (mDragIsCoin && mDragIndex < static_cast<int>(ctx.level.coins.size())) {
+            ctx.Touch(Kind::Coin, mDragIndex);
             ctx.level.coins[mDragIndex].x = static_cast<float>(sx);
             ctx.level.coins[mDragIndex].y = static_cast<float>(sy);
         } else if (!mDragIsCoin && !mDragIsTile &&
                    mDragIndex < static_cast<int>(ctx.level.enemies.size())) {
+            ctx.Touch(Kind::Enemy, mDragIndex);
             ctx.level.enemies[mDragIndex].x = static_cast<float>(sx);
             ctx.level.enemies[mDragIndex].y = static_cast<float>(sy);
         }
@@ -11,6 +11,9 @@
 // each tool's compilation unit small.
 
 #include "EditorCamera.hpp"
+#include "EditorEnemyTypes.hpp"
+#include "EditorHistory.hpp"
+#include "EditorSpatialIndex.hpp"
 #include "EditorSurfaceCache.hpp"
 #include "EnemyProfile.hpp"
 #include "LevelData.hpp"
@@ -19,6 +22,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 struct EditorToolContext {
     // ── Level data (read/write) ──────────────────────────────────────────────
@@ -30,9 +34,19 @@ struct EditorToolContext {
     // ── Surface cache (read for thumbnails, badges, rotations) ───────────────
     EditorSurfaceCache& surfaceCache;
 
+    // ── Spatial index (hit-tests, marquee) — rebuilt lazily after edits ─────
+    EditorSpatialIndex& spatial;
+
+    // ── Enemy-type metadata (sizes, default speed, preview) — no disk I/O ───
+    EditorEnemyTypes& enemyTypes;
+
+    // ── Undo history — record every level edit (see EditorHistory.hpp) ──────
+    EditorHistory& history;
+
     // ── Layout constants ─────────────────────────────────────────────────────
-    int grid     = 38;
-    int toolbarH = 48;
+    int grid       = 38;
+    int toolbarH   = 48;
+    int bottomBarH = 22;
 
     // ── Status callback — tool calls this to update the bottom status bar ────
     std::function<void(const std::string&)> setStatus;
@@ -59,6 +73,7 @@ struct EditorToolContext {
     [[nodiscard]] float CamY() const { return camera.Y(); }
     [[nodiscard]] int   CanvasW() const { return canvasW ? canvasW() : 800; }
     [[nodiscard]] int   ToolbarH() const { return toolbarH; }
+    [[nodiscard]] int   BottomBarH() const { return bottomBarH; }
     [[nodiscard]] int   Grid() const { return grid; }
 
     void SetStatus(const std::string& msg) {
@@ -73,43 +88,32 @@ struct EditorToolContext {
 
     [[nodiscard]] int HitTile(int sx, int sy) const {
         auto [wx, wy] = ScreenToWorld(sx, sy);
-        for (int i = static_cast<int>(level.tiles.size()) - 1; i >= 0; --i) {
-            const auto& t = level.tiles[i];
-            SDL_Rect    r = {static_cast<int>(t.x), static_cast<int>(t.y), t.w, t.h};
-            if (HitTest(r, wx, wy)) return i;
-        }
-        return -1;
+        return spatial.HitTile(level, grid, wx, wy);
     }
 
     [[nodiscard]] int HitCoin(int sx, int sy) const {
         auto [wx, wy] = ScreenToWorld(sx, sy);
-        for (int i = 0; i < static_cast<int>(level.coins.size()); ++i) {
-            SDL_Rect r = {static_cast<int>(level.coins[i].x),
-                          static_cast<int>(level.coins[i].y), grid, grid};
-            if (HitTest(r, wx, wy)) return i;
-        }
-        return -1;
+        return spatial.HitCoin(level, grid, wx, wy);
     }
 
     [[nodiscard]] int HitEnemy(int sx, int sy) const {
         auto [wx, wy] = ScreenToWorld(sx, sy);
-        for (int i = 0; i < static_cast<int>(level.enemies.size()); ++i) {
-            const auto& en = level.enemies[i];
-            // Use profile sprite size if available, otherwise grid
-            int ew = grid, eh = grid;
-            if (!en.enemyType.empty()) {
-                EnemyProfile prof;
-                if (LoadEnemyProfile("enemies/" + en.enemyType + ".json", prof)) {
-                    ew = (prof.spriteW > 0) ? prof.spriteW : grid;
-                    eh = (prof.spriteH > 0) ? prof.spriteH : grid;
-                }
-            }
-            SDL_Rect r = {static_cast<int>(en.x), static_cast<int>(en.y), ew, eh};
-            if (HitTest(r, wx, wy)) return i;
-        }
-        return -1;
+        return spatial.HitEnemy(level, grid, wx, wy);
     }
 
+    // Tiles overlapping a world-space rect, ascending index order.
+    void TilesInRect(SDL_Rect worldRect, std::vector<int>& out) const {
+        spatial.TilesInRect(level, grid, worldRect, out);
+    }
+
+    // ── Undo recording ───────────────────────────────────────────────────────
+    // Touch before editing an entity in place, Erasing before erasing it,
+    // Appended after push_back. The scene owns the transaction boundaries.
+
+    void Touch(EditorHistory::Kind kind, int i) { history.Touch(level, kind, i); }
+    void Erasing(EditorHistory::Kind kind, int i) { history.Erasing(level, kind, i); }
+    void Appended(EditorHistory::Kind kind) { history.Appended(level, kind); }
+
     // ── Surface drawing helpers (thin wrappers so tools can render overlays) ─
 
     static void DrawRect(SDL_Surface* s, SDL_Rect r, SDL_Color c) {
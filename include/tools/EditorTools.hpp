@@ -10,6 +10,7 @@
 #include "tools/SelectTool.hpp"
 #include "tools/ResizeTool.hpp"
 #include "tools/HitboxTool.hpp"
+#include "tools/BulkTools.hpp"
 #include <memory>
 
 // ─── Factory ─────────────────────────────────────────────────────────────────
@@ -34,6 +35,8 @@ inline std::unique_ptr<EditorTool> MakeEditorTool(ToolId id) {
         case ToolId::Slope:       return std::make_unique<SlopeTool>();
         case ToolId::Hazard:      return std::make_unique<HazardTool>();
         case ToolId::AntiGrav:    return std::make_unique<AntiGravTool>();
+        case ToolId::Fill:        return std::make_unique<FillTool>();
+        case ToolId::Stamp:       return std::make_unique<StampTool>();
 
         // Complex tools -- handled inline by the orchestrator for now.
         case ToolId::Action:
@@ -23,6 +23,14 @@ class HitboxTool final : public EditorTool {
         mHoverHdl = Handle::None;
     }
 
+    // Undo may have removed the selected tile's hitbox (or the tile itself);
+    // the handle code dereferences it unconditionally.
+    void OnHistoryApplied(EditorToolContext& /*ctx*/) override {
+        mTileIdx  = -1;
+        mDragging = false;
+        mHoverHdl = Handle::None;
+    }
+
     ToolResult OnMouseDown(EditorToolContext& ctx, int mx, int my,
                            Uint8 button, SDL_Keymod /*mods*/) override {
         if (button != SDL_BUTTON_LEFT) return ToolResult::Ignored;
@@ -54,6 +62,7 @@ class HitboxTool final : public EditorTool {
                 mTileIdx = ti;
                 auto& t  = ctx.level.tiles[ti];
                 if (!t.HasHitbox()) {
+                    ctx.Touch(Kind::Tile, ti);
                     t.hitbox = HitboxData{0, 0, t.w, t.h};
                 }
                 ctx.SetStatus("Hitbox: tile " + std::to_string(ti) + "  drag edges to adjust");
@@ -67,6 +76,7 @@ class HitboxTool final : public EditorTool {
     ToolResult OnMouseMove(EditorToolContext& ctx, int mx, int my) override {
         // Drag update
         if (mDragging && mTileIdx >= 0 && mTileIdx < static_cast<int>(ctx.level.tiles.size())) {
+            ctx.Touch(Kind::Tile, mTileIdx);
             auto& t = ctx.level.tiles[mTileIdx];
             int dx = mx - mDragX, dy = my - mDragY;
             constexpr int MIN_SIDE = 4;
@@ -23,6 +23,7 @@ class PropTool final : public EditorTool {
         if (my < ctx.ToolbarH() || mx >= ctx.CanvasW()) return ToolResult::Ignored;
         int ti = ctx.HitTile(mx, my);
         if (ti >= 0) {
+            ctx.Touch(Kind::Tile, ti);
             auto& t      = ctx.level.tiles[ti];
             bool nowProp  = !t.prop;
             t.prop        = nowProp;
@@ -69,6 +70,7 @@ class LadderTool final : public EditorTool {
         if (my < ctx.ToolbarH() || mx >= ctx.CanvasW()) return ToolResult::Ignored;
         int ti = ctx.HitTile(mx, my);
         if (ti >= 0) {
+            ctx.Touch(Kind::Tile, ti);
             auto& t        = ctx.level.tiles[ti];
             bool nowLadder  = !t.ladder;
             t.ladder        = nowLadder;
@@ -113,6 +115,7 @@ class SlopeTool final : public EditorTool {
         if (my < ctx.ToolbarH() || mx >= ctx.CanvasW()) return ToolResult::Ignored;
         int ti = ctx.HitTile(mx, my);
         if (ti >= 0) {
+            ctx.Touch(Kind::Tile, ti);
             auto&       t = ctx.level.tiles[ti];
             SlopeType   curType = t.GetSlopeType();
             std::string label;
@@ -142,6 +145,7 @@ class SlopeTool final : public EditorTool {
         if (my < ctx.ToolbarH() || mx >= ctx.CanvasW()) return ToolResult::Ignored;
         int hovSlope = ctx.HitTile(mx, my);
         if (hovSlope >= 0 && ctx.level.tiles[hovSlope].HasSlope()) {
+            ctx.Touch(Kind::Tile, hovSlope);
             float& frac = ctx.level.tiles[hovSlope].slope->heightFrac;
             frac = std::clamp(frac + wheelY * 0.05f, 0.05f, 1.0f);
             frac = std::round(frac * 20.0f) / 20.0f;
@@ -180,6 +184,7 @@ class HazardTool final : public EditorTool {
         if (my < ctx.ToolbarH() || mx >= ctx.CanvasW()) return ToolResult::Ignored;
         int ti = ctx.HitTile(mx, my);
         if (ti >= 0) {
+            ctx.Touch(Kind::Tile, ti);
             auto& t        = ctx.level.tiles[ti];
             bool nowHazard  = !t.hazard;
             t.hazard        = nowHazard;
@@ -226,6 +231,7 @@ class AntiGravTool final : public EditorTool {
         if (my < ctx.ToolbarH() || mx >= ctx.CanvasW()) return ToolResult::Ignored;
         int ti = ctx.HitTile(mx, my);
         if (ti >= 0) {
+            ctx.Touch(Kind::Tile, ti);
             bool now                         = !ctx.level.tiles[ti].antiGravity;
             ctx.level.tiles[ti].antiGravity  = now;
             ctx.SetStatus("Tile " + std::to_string(ti) +
@@ -234,6 +240,7 @@ class AntiGravTool final : public EditorTool {
         }
         int ei = ctx.HitEnemy(mx, my);
         if (ei >= 0) {
+            ctx.Touch(Kind::Enemy, ei);
             bool now                           = !ctx.level.enemies[ei].antiGravity;
             ctx.level.enemies[ei].antiGravity  = now;
             ctx.SetStatus("Enemy " + std::to_string(ei) +
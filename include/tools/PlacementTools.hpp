@@ -33,6 +33,7 @@ class CoinTool final : public EditorTool {
         if (my < ctx.ToolbarH() || mx >= ctx.CanvasW()) return ToolResult::Ignored;
         auto [sx, sy] = ctx.SnapToGrid(mx, my);
         ctx.level.coins.push_back({static_cast<float>(sx), static_cast<float>(sy)});
+        ctx.Appended(Kind::Coin);
         ctx.SetStatus("Coin at " + std::to_string(sx) + "," + std::to_string(sy));
         return ToolResult::Consumed;
     }
@@ -93,6 +94,15 @@ class EnemyTool final : public EditorTool {
         speedInputActive = false;
     }
 
+    // The speed popup's enemy index may be stale; close it without applying.
+    void OnHistoryApplied(EditorToolContext& ctx) override {
+        if (speedInputActive)
+            SDL_StopTextInput(ctx.sdlWindow);
+        speedPopupOpen   = false;
+        speedInputActive = false;
+        speedPopupIdx    = -1;
+    }
+
     void RefreshPicker();
     void CommitSpeedEdit(EditorToolContext& ctx);
 
@@ -129,18 +139,21 @@ class EraseTool final : public EditorTool {
 
         int ci = ctx.HitCoin(mx, my);
         if (ci >= 0) {
+            ctx.Erasing(Kind::Coin, ci);
             ctx.level.coins.erase(ctx.level.coins.begin() + ci);
             ctx.SetStatus("Erased coin");
             return ToolResult::Consumed;
         }
         int ei = ctx.HitEnemy(mx, my);
         if (ei >= 0) {
+            ctx.Erasing(Kind::Enemy, ei);
             ctx.level.enemies.erase(ctx.level.enemies.begin() + ei);
             ctx.SetStatus("Erased enemy");
             return ToolResult::Consumed;
         }
         int ti = ctx.HitTile(mx, my);
         if (ti >= 0) {
+            ctx.Erasing(Kind::Tile, ti);
             ctx.level.tiles.erase(ctx.level.tiles.begin() + ti);
             ctx.SetStatus("Erased tile");
             return ToolResult::Consumed;
@@ -161,6 +174,7 @@ class PlayerStartTool final : public EditorTool {
         if (button != SDL_BUTTON_LEFT) return ToolResult::Ignored;
         if (my < ctx.ToolbarH() || mx >= ctx.CanvasW()) return ToolResult::Ignored;
         auto [sx, sy]  = ctx.SnapToGrid(mx, my);
+        ctx.Touch(Kind::Player, 0);
         ctx.level.player = {static_cast<float>(sx), static_cast<float>(sy)};
         ctx.SetStatus("Player start set");
         return ToolResult::Consumed;
@@ -191,6 +205,7 @@ class TileTool final : public EditorTool {
             if (my >= ctx.ToolbarH() && mx < ctx.CanvasW()) {
                 int ti = ctx.HitTile(mx, my);
                 if (ti >= 0) {
+                    ctx.Touch(Kind::Tile, ti);
                     int& rot = ctx.level.tiles[ti].rotation;
                     rot = (rot + 90) % 360;
                     ctx.SetStatus("Tile " + std::to_string(ti) + " rotated to " +
@@ -216,6 +231,7 @@ class TileTool final : public EditorTool {
                                   tileW, tileH, placementInfo.imagePath};
         newTile.rotation = ghostRotation;
         ctx.level.tiles.push_back(std::move(newTile));
+        ctx.Appended(Kind::Tile);
         ctx.SetStatus("Tile: " + placementInfo.label +
                       (ghostRotation ? "  rot=" + std::to_string(ghostRotation) : ""));
         return ToolResult::Consumed;
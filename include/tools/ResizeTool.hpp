@@ -20,6 +20,13 @@ class ResizeTool final : public EditorTool {
         mHoverTileIdx = -1;
     }
 
+    void OnHistoryApplied(EditorToolContext& /*ctx*/) override {
+        mIsResizing    = false;
+        mResizeTileIdx = -1;
+        mHoverEdge     = Edge::None;
+        mHoverTileIdx  = -1;
+    }
+
     ToolResult OnMouseDown(EditorToolContext& ctx, int mx, int my,
                            Uint8 button, SDL_Keymod /*mods*/) override {
         if (button != SDL_BUTTON_LEFT) return ToolResult::Ignored;
@@ -41,6 +48,7 @@ class ResizeTool final : public EditorTool {
     ToolResult OnMouseMove(EditorToolContext& ctx, int mx, int my) override {
         if (mIsResizing && mResizeTileIdx >= 0 &&
             mResizeTileIdx < static_cast<int>(ctx.level.tiles.size())) {
+            ctx.Touch(Kind::Tile, mResizeTileIdx);
             auto& t  = ctx.level.tiles[mResizeTileIdx];
             int   dx = mx - mResizeDragX, dy = my - mResizeDragY;
             int   grid = ctx.Grid();
@@ -5,6 +5,7 @@
 // State: selected indices, rubber-band rect, drag origin/positions.
 
 #include "tools/EditorTool.hpp"
+#include "EditorBulkOps.hpp"
 #include <algorithm>
 #include <climits>
 #include <vector>
@@ -31,6 +32,14 @@ class SelectTool final : public EditorTool {
         selDragging = false;
     }
 
+    // Selected indices may name other tiles (or none) after undo/redo.
+    void OnHistoryApplied(EditorToolContext& /*ctx*/) override {
+        selIndices.clear();
+        selBoxing   = false;
+        selDragging = false;
+        mSelOrigPositions.clear();
+    }
+
     ToolResult OnMouseDown(EditorToolContext& ctx, int mx, int my,
                            Uint8 button, SDL_Keymod mods) override {
         if (button != SDL_BUTTON_LEFT) return ToolResult::Ignored;
@@ -80,6 +89,7 @@ class SelectTool final : public EditorTool {
             for (int i = 0; i < static_cast<int>(selIndices.size()); ++i) {
                 int idx = selIndices[i];
                 if (idx < static_cast<int>(ctx.level.tiles.size())) {
+                    ctx.Touch(Kind::Tile, idx);
                     float rawX = mSelOrigPositions[i].first + dx;
                     float rawY = mSelOrigPositions[i].second + dy;
                     ctx.level.tiles[idx].x = static_cast<float>((static_cast<int>(rawX) / grid) * grid);
@@ -98,13 +108,16 @@ class SelectTool final : public EditorTool {
             int rx0 = std::min(selBoxX0, selBoxX1), ry0 = std::min(selBoxY0, selBoxY1);
             int rx1 = std::max(selBoxX0, selBoxX1), ry1 = std::max(selBoxY0, selBoxY1);
             if (!(mods & SDL_KMOD_SHIFT)) selIndices.clear();
-            for (int i = 0; i < static_cast<int>(ctx.level.tiles.size()); ++i) {
-                const auto& t = ctx.level.tiles[i];
-                if (static_cast<int>(t.x) + t.w > rx0 && static_cast<int>(t.x) < rx1 &&
-                    static_cast<int>(t.y) + t.h > ry0 && static_cast<int>(t.y) < ry1) {
-                    if (std::find(selIndices.begin(), selIndices.end(), i) == selIndices.end())
+            ctx.TilesInRect({rx0, ry0, rx1 - rx0, ry1 - ry0}, mBoxHits);
+            if (selIndices.empty()) {
+                selIndices = mBoxHits;
+            } else {
+                // Shift-extend: sorted copy keeps this O(n log n) on big selections.
+                std::vector<int> prev = selIndices;
+                std::sort(prev.begin(), prev.end());
+                for (int i : mBoxHits)
+                    if (!std::binary_search(prev.begin(), prev.end(), i))
                         selIndices.push_back(i);
-                }
             }
             ctx.SetStatus("Selected " + std::to_string(selIndices.size()) + " tile(s)");
         }
@@ -118,11 +131,9 @@ class SelectTool final : public EditorTool {
     ToolResult OnKeyDown(EditorToolContext& ctx, SDL_Keycode key, SDL_Keymod /*mods*/) override {
         if (key == SDLK_DELETE || key == SDLK_BACKSPACE) {
             if (!selIndices.empty()) {
-                std::sort(selIndices.begin(), selIndices.end(), std::greater<int>());
-                for (int idx : selIndices)
-                    if (idx >= 0 && idx < static_cast<int>(ctx.level.tiles.size()))
-                        ctx.level.tiles.erase(ctx.level.tiles.begin() + idx);
-                ctx.SetStatus("Deleted " + std::to_string(selIndices.size()) + " tile(s)");
+                // One compaction pass and one undo op, however many are selected.
+                int n = EditorBulkOps::EraseTiles(ctx.level, ctx.history, selIndices);
+                ctx.SetStatus("Deleted " + std::to_string(n) + " tile(s)");
                 selIndices.clear();
             }
             return ToolResult::Consumed;
@@ -194,4 +205,5 @@ class SelectTool final : public EditorTool {
   private:
     int mSelDragStartWX = 0, mSelDragStartWY = 0;
     std::vector<std::pair<float, float>> mSelOrigPositions;
+    std::vector<int>                     mBoxHits; // marquee query scratch
 };
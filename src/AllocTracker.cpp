@@ -0,0 +1,29 @@
+#include "AllocTracker.hpp"
+#include <cstdlib>
+#include <new>
+
+thread_local AllocCounts AllocTracker::sThread;
+std::atomic<Uint64>      AllocTracker::sCount{0};
+std::atomic<Uint64>      AllocTracker::sBytes{0};
+
+#if FORGE2D_TRACK_ALLOCS
+// ── Global allocation hook ───────────────────────────────────────────────────
+// Replacing the single-object forms is enough: the standard library's
+// default new[] / nothrow new / sized delete forward to these.
+void* operator new(std::size_t size) {
+    AllocTracker::Record(size);
+    if (size == 0)
+        size = 1;
+    for (;;) {
+        if (void* p = std::malloc(size))
+            return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#endif
@@ -0,0 +1,165 @@
+#include "AnimatedTileLibrary.hpp"
+#include "AnimatedTile.hpp"
+#include "SurfaceUtils.hpp"
+#include "TextureRegistry.hpp"
+#include "TraceRecorder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <print>
+#include <utility>
+
+namespace {
+// Transparent pixels between atlas cells (and around the edge).
+constexpr int ATLAS_GUTTER = 2;
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Loading
+// ─────────────────────────────────────────────────────────────────────────────
+std::string AnimatedTileLibrary::Key(const std::string& manifestPath, int rotation) {
+    return manifestPath + "|r" + std::to_string(rotation);
+}
+
+int AnimatedTileLibrary::Acquire(SDL_Renderer*      ren,
+                                 const std::string& manifestPath,
+                                 int                rotation) {
+    if (auto it = mIds.find(Key(manifestPath, rotation)); it != mIds.end())
+        return it->second;
+
+    Stitched stitched;
+    Stitch(manifestPath, rotation, stitched);
+    return Adopt(ren, stitched);
+}
+
+bool AnimatedTileLibrary::Stitch(const std::string& manifestPath, int rotation,
+                                 Stitched& out) {
+    out.path     = manifestPath;
+    out.rotation = rotation;
+    AnimatedTileDef def;
+    if (!LoadAnimatedTileDef(manifestPath, def) || def.framePaths.empty()) {
+        std::print("[AnimatedTileLibrary] failed to load '{}'\n", manifestPath);
+        return false;
+    }
+    out.fps = def.fps;
+
+    // Decode every frame first so the atlas cell size is known.
+    std::vector<SDL_Surface*> surfs;
+    int                       cellW = 0, cellH = 0;
+    for (const auto& fp : def.framePaths) {
+        SDL_Surface* s = LoadTileSurface(fp, rotation);
+        if (!s)
+            continue;
+        cellW = std::max(cellW, s->w);
+        cellH = std::max(cellH, s->h);
+        surfs.push_back(s);
+    }
+    if (surfs.empty()) {
+        std::print("[AnimatedTileLibrary] no frames loaded for '{}'\n", manifestPath);
+        return false;
+    }
+
+    // Near-square grid keeps the atlas well inside GPU texture size limits.
+    const int n     = (int)surfs.size();
+    const int cols  = (int)std::ceil(std::sqrt((double)n));
+    const int rows  = (n + cols - 1) / cols;
+    const int atlW  = cols * (cellW + ATLAS_GUTTER) + ATLAS_GUTTER;
+    const int atlH  = rows * (cellH + ATLAS_GUTTER) + ATLAS_GUTTER;
+
+    out.atlas = SDL_CreateSurface(atlW, atlH, SDL_PIXELFORMAT_ARGB8888);
+    if (out.atlas) {
+        LoadReport::Timer stitch(LoadReport::Convert);
+        SDL_FillSurfaceRect(out.atlas, nullptr, 0);
+        for (int i = 0; i < n; ++i) {
+            SDL_Rect dst = {ATLAS_GUTTER + (i % cols) * (cellW + ATLAS_GUTTER),
+                            ATLAS_GUTTER + (i / cols) * (cellH + ATLAS_GUTTER),
+                            surfs[i]->w,
+                            surfs[i]->h};
+            // Straight copy — alpha must land in the atlas, not be blended away.
+            SDL_SetSurfaceBlendMode(surfs[i], SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(surfs[i], nullptr, out.atlas, &dst);
+            out.frames.push_back(dst);
+        }
+    } else {
+        std::print("[AnimatedTileLibrary] cannot create {}x{} atlas for '{}': {}\n", atlW,
+                   atlH, manifestPath, SDL_GetError());
+    }
+    for (auto* s : surfs)
+        SDL_DestroySurface(s);
+    return out.atlas != nullptr;
+}
+
+int AnimatedTileLibrary::Adopt(SDL_Renderer* ren, Stitched& stitched) {
+    SDL_Surface* atlas = std::exchange(stitched.atlas, nullptr);
+    const auto [it, inserted] = mIds.try_emplace(Key(stitched.path, stitched.rotation), -1);
+    if (!inserted || !atlas) {
+        if (atlas)
+            SDL_DestroySurface(atlas);
+        return it->second;
+    }
+
+    Anim anim;
+    anim.path     = stitched.path;
+    anim.rotation = stitched.rotation;
+    anim.fps      = stitched.fps;
+    anim.frames   = std::move(stitched.frames);
+    {
+        TRACE_SCOPE("gpu", "AnimatedTile atlas upload", stitched.path);
+        anim.atlas = TextureRegistry::Get().CreateFromSurface(ren, atlas, "anim-tiles");
+    }
+    if (!anim.atlas) {
+        std::print("[AnimatedTileLibrary] atlas upload failed for '{}' ({}x{}): {}\n",
+                   stitched.path, atlas->w, atlas->h, SDL_GetError());
+        SDL_DestroySurface(atlas);
+        return -1;
+    }
+    SDL_DestroySurface(atlas);
+    SDL_SetTextureScaleMode(anim.atlas, SDL_SCALEMODE_PIXELART);
+
+    it->second = (int)mAnims.size();
+    mAnims.push_back(std::move(anim));
+    return it->second;
+}
+
+void AnimatedTileLibrary::Clear() {
+    for (auto& a : mAnims)
+        if (a.atlas)
+            TextureRegistry::Get().Destroy(a.atlas);
+    mAnims.clear();
+    mIds.clear();
+    mClock = 0.0;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Clock-driven frame lookup
+// ─────────────────────────────────────────────────────────────────────────────
+int AnimatedTileLibrary::FrameIndex(const AnimatedTileRef& ref) const {
+    const Anim* a = Get(ref.id);
+    if (!a || a->frames.empty())
+        return 0;
+    const int    n   = (int)a->frames.size();
+    const double fps = (a->fps > 0.0f) ? a->fps : 8.0;
+    if (!ref.loop) {
+        int f = (int)std::floor(std::max(0.0, mClock - ref.start) * fps);
+        return std::min(f, n - 1);
+    }
+    long long f = (long long)std::floor(mClock * fps + (double)ref.phase * n);
+    return (int)(((f % n) + n) % n);
+}
+
+bool AnimatedTileLibrary::Finished(const AnimatedTileRef& ref) const {
+    const Anim* a = Get(ref.id);
+    if (!a || a->frames.empty())
+        return true;
+    if (ref.loop)
+        return false;
+    const double fps = (a->fps > 0.0f) ? a->fps : 8.0;
+    return (mClock - ref.start) * fps >= (double)a->frames.size();
+}
+
+SDL_Texture* AnimatedTileLibrary::Resolve(const AnimatedTileRef& ref, SDL_Rect& src) const {
+    const Anim* a = Get(ref.id);
+    if (!a || a->frames.empty())
+        return nullptr;
+    src = a->frames[FrameIndex(ref)];
+    return a->atlas;
+}
@@ -0,0 +1,407 @@
+#include "ChunkStreamer.hpp"
+#include "AnimatedTile.hpp"
+#include "ChunkedLevel.hpp"
+#include "Components.hpp"
+#include "SurfaceUtils.hpp"
+#include "TextureRegistry.hpp"
+#include "TraceRecorder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <print>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Construction / teardown
+// ─────────────────────────────────────────────────────────────────────────────
+ChunkStreamer::ChunkStreamer(SDL_Renderer* ren, entt::registry& reg,
+                             AnimatedTileLibrary& anims, const std::string& levelPath,
+                             const LevelChunking& chunking, SpawnFn spawn,
+                             DespawnFn despawn)
+    : mRen(ren)
+    , mReg(reg)
+    , mAnims(anims)
+    , mLevelPath(levelPath)
+    , mChunking(chunking)
+    , mSpawn(std::move(spawn))
+    , mDespawn(std::move(despawn)) {
+    for (const auto& c : mChunking.chunks)
+        mOnDisk.insert(c);
+    mWorker = std::thread(&ChunkStreamer::WorkerLoop, this);
+}
+
+ChunkStreamer::~ChunkStreamer() {
+    {
+        std::lock_guard lock(mMutex);
+        mQuit = true;
+        mRequests.clear();
+    }
+    mCv.notify_all();
+    if (mWorker.joinable())
+        mWorker.join();
+
+    // Entities belong to the registry, which the scene tears down itself.
+    for (auto& p : mReady) {
+        FreeSurfaces(p.surfaces);
+        FreeAnims(p.anims);
+    }
+    for (auto& [coord, ch] : mChunks)
+        FreeSurfaces(ch.surfaces);
+    for (auto& [key, te] : mTextures)
+        if (te.tex)
+            TextureRegistry::Get().Destroy(te.tex);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────────────────────────────────────
+std::string ChunkStreamer::TexKey(const std::string& path, int rot) {
+    return path + "|r" + std::to_string(rot);
+}
+
+void ChunkStreamer::FreeSurfaces(std::unordered_map<std::string, SDL_Surface*>& s) {
+    for (auto& [key, surf] : s)
+        if (surf)
+            SDL_DestroySurface(surf);
+    s.clear();
+}
+
+void ChunkStreamer::FreeAnims(std::vector<AnimatedTileLibrary::Stitched>& anims) {
+    for (auto& a : anims)
+        if (a.atlas)
+            SDL_DestroySurface(a.atlas);
+    anims.clear();
+}
+
+bool ChunkStreamer::InRing(ChunkCoord c, const SDL_FRect& view, int ring) const {
+    const float S  = (float)mChunking.size;
+    const float m  = S * ring;
+    const float x0 = c.cx * S, y0 = c.cy * S;
+    return x0 + S > view.x - m && x0 < view.x + view.w + m &&
+           y0 + S > view.y - m && y0 < view.y + view.h + m;
+}
+
+// Runs on the worker thread (or the main thread, from Prime): parse the chunk
+// file, decode every static tile image it references into surfaces, and
+// stitch the atlas of each animated manifest (live tiles and destroy
+// animations) that no earlier chunk claimed. Only the upload is left to the
+// main thread.
+ChunkStreamer::Prepared ChunkStreamer::PrepareChunk(const std::string& file,
+                                                    ChunkCoord         coord) {
+    Prepared p;
+    p.coord = coord;
+    if (!LoadChunkTiles(file, p.tiles))
+        return p;
+
+    auto decode = [&](const std::string& path, int rot) {
+        std::string key = TexKey(path, rot);
+        if (p.surfaces.count(key))
+            return;
+        p.surfaces[key] = LoadTileSurface(path, rot);
+    };
+    auto stitch = [&](const std::string& path, int rot) {
+        if (!ClaimAnim(AnimatedTileLibrary::Key(path, rot)))
+            return;
+        AnimatedTileLibrary::Stitched s;
+        AnimatedTileLibrary::Stitch(path, rot, s);
+        p.anims.push_back(std::move(s)); // failures too, so they are cached
+    };
+    for (const auto& ts : p.tiles) {
+        if (IsAnimatedTile(ts.imagePath))
+            stitch(ts.imagePath, ts.rotation);
+        else
+            decode(ts.imagePath, ts.rotation);
+        if (ts.HasAction() && !ts.action->destroyAnimPath.empty())
+            stitch(ts.action->destroyAnimPath, 0);
+    }
+    return p;
+}
+
+// True for the first caller per manifest. A manifest claimed by a chunk still
+// in flight when its tiles spawn is stitched again by Acquire(); Adopt() then
+// drops the late copy.
+bool ChunkStreamer::ClaimAnim(const std::string& key) {
+    std::lock_guard lock(mMutex);
+    return mAnimsClaimed.insert(key).second;
+}
+
+// Main thread: upload freshly stitched atlases. They belong to the level, not
+// the chunk, so this happens even if the chunk was dropped in flight.
+void ChunkStreamer::AdoptAnims(std::vector<AnimatedTileLibrary::Stitched>& anims) {
+    for (auto& a : anims)
+        mAnims.Adopt(mRen, a);
+    anims.clear();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Worker thread
+// ─────────────────────────────────────────────────────────────────────────────
+void ChunkStreamer::WorkerLoop() {
+    for (;;) {
+        ChunkCoord coord;
+        {
+            std::unique_lock lock(mMutex);
+            mCv.wait(lock, [&] { return mQuit || !mRequests.empty(); });
+            if (mQuit)
+                return;
+            coord = mRequests.front();
+            mRequests.pop_front();
+        }
+
+        Prepared p = PrepareChunk(ChunkFilePath(mLevelPath, mChunking, coord), coord);
+
+        std::lock_guard lock(mMutex);
+        if (mQuit) {
+            FreeSurfaces(p.surfaces);
+            FreeAnims(p.anims);
+            return;
+        }
+        mReady.push_back(std::move(p));
+    }
+}
+
+void ChunkStreamer::Request(ChunkCoord c) {
+    mChunks[c].state = State::Queued;
+    {
+        std::lock_guard lock(mMutex);
+        mRequests.push_back(c);
+    }
+    mCv.notify_one();
+}
+
+void ChunkStreamer::DrainReady() {
+    std::vector<Prepared> ready;
+    {
+        std::lock_guard lock(mMutex);
+        ready.swap(mReady);
+    }
+    for (auto& p : ready) {
+        AdoptAnims(p.anims);
+        auto it = mChunks.find(p.coord);
+        // Dropped while in flight, or already loaded synchronously by Prime().
+        if (it == mChunks.end() || it->second.state != State::Queued) {
+            FreeSurfaces(p.surfaces);
+            continue;
+        }
+        it->second.state    = State::Ready;
+        it->second.tiles    = std::move(p.tiles);
+        it->second.surfaces = std::move(p.surfaces);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Spawning
+// ─────────────────────────────────────────────────────────────────────────────
+void ChunkStreamer::SpawnChunk(Chunk& ch, ChunkCoord coord) {
+    TextureFn getTex = [&](const std::string& path, int rot) -> SDL_Texture* {
+        std::string key = TexKey(path, rot);
+        auto        it  = mTextures.find(key);
+        if (it == mTextures.end()) {
+            // Normally decoded by the worker; fall back to a synchronous decode
+            // for anything it didn't know about (e.g. an unreadable def).
+            SDL_Surface* surf = nullptr;
+            if (auto sit = ch.surfaces.find(key); sit != ch.surfaces.end()) {
+                surf = sit->second;
+                ch.surfaces.erase(sit);
+            } else {
+                surf = LoadTileSurface(path, rot);
+            }
+            if (!surf)
+                return nullptr;
+            SDL_Texture* tex = nullptr;
+            {
+                TRACE_SCOPE("gpu", "ChunkStreamer upload", path);
+                tex = TextureRegistry::Get().CreateFromSurface(mRen, surf, "chunks");
+            }
+            SDL_DestroySurface(surf);
+            if (!tex)
+                return nullptr;
+            SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_PIXELART);
+            it = mTextures.emplace(key, TexEntry{tex, 0}).first;
+        }
+        it->second.refs++;
+        ch.texRefs.push_back(key);
+        return it->second.tex;
+    };
+
+    const auto* broken = [&]() -> const std::vector<bool>* {
+        auto it = mBroken.find(coord);
+        return it != mBroken.end() ? &it->second : nullptr;
+    }();
+
+    ch.entities.assign(ch.tiles.size(), entt::null);
+    for (size_t i = 0; i < ch.tiles.size(); ++i) {
+        if (broken && i < broken->size() && (*broken)[i])
+            continue;
+        ch.entities[i] = mSpawn(ch.tiles[i], getTex);
+    }
+
+    // Everything this chunk needs is on the GPU now.
+    FreeSurfaces(ch.surfaces);
+    ch.state = State::Spawned;
+}
+
+void ChunkStreamer::DespawnChunk(Chunk& ch, ChunkCoord coord) {
+    for (size_t i = 0; i < ch.entities.size(); ++i) {
+        entt::entity e = ch.entities[i];
+        if (e == entt::null)
+            continue;
+        // Destroyed by gameplay (or mid death-anim): remember it as broken.
+        bool gone = !mReg.valid(e) || mReg.all_of<DestroyAnimTag>(e);
+        if (gone) {
+            auto& b = mBroken[coord];
+            b.resize(ch.tiles.size(), false);
+            b[i] = true;
+        }
+        if (mReg.valid(e))
+            mDespawn(e);
+    }
+    ch.entities.clear();
+    for (const auto& key : ch.texRefs)
+        ReleaseTexture(key);
+    ch.texRefs.clear();
+    ch.state = State::Ready;
+}
+
+void ChunkStreamer::ReleaseTexture(const std::string& key) {
+    auto it = mTextures.find(key);
+    if (it != mTextures.end() && it->second.refs > 0)
+        it->second.refs--;
+}
+
+// Destroys textures no spawned chunk references any more. Deferred to the end
+// of Update()/Prime() so a chunk despawned and another spawned in the same
+// call can hand a shared texture over without a re-upload.
+void ChunkStreamer::CollectTextures() {
+    for (auto it = mTextures.begin(); it != mTextures.end();) {
+        if (it->second.refs <= 0) {
+            if (it->second.tex)
+                TextureRegistry::Get().Destroy(it->second.tex);
+            it = mTextures.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Per-frame driving
+// ─────────────────────────────────────────────────────────────────────────────
+bool ChunkStreamer::Update(const SDL_FRect& view) {
+    bool changed = false;
+    DrainReady();
+
+    // Drop everything that has left the prefetch ring.
+    std::vector<ChunkCoord> dropped;
+    for (auto it = mChunks.begin(); it != mChunks.end();) {
+        if (InRing(it->first, view, PREFETCH_RING)) {
+            ++it;
+            continue;
+        }
+        if (it->second.state == State::Spawned) {
+            DespawnChunk(it->second, it->first);
+            changed = true;
+        }
+        FreeSurfaces(it->second.surfaces);
+        dropped.push_back(it->first);
+        it = mChunks.erase(it);
+    }
+    if (!dropped.empty()) {
+        std::lock_guard lock(mMutex);
+        std::erase_if(mRequests, [&](ChunkCoord c) {
+            return std::find(dropped.begin(), dropped.end(), c) != dropped.end();
+        });
+    }
+
+    // Queue prefetch for chunks entering the ring, nearest to the view centre
+    // first: the worker takes requests in order, so the chunks the player
+    // reaches soonest are ready soonest.
+    const float S   = (float)mChunking.size;
+    const int   cx0 = (int)std::floor(view.x / S) - PREFETCH_RING;
+    const int   cy0 = (int)std::floor(view.y / S) - PREFETCH_RING;
+    const int   cx1 = (int)std::floor((view.x + view.w) / S) + PREFETCH_RING;
+    const int   cy1 = (int)std::floor((view.y + view.h) / S) + PREFETCH_RING;
+    std::vector<ChunkCoord> wanted;
+    for (int cy = cy0; cy <= cy1; ++cy)
+        for (int cx = cx0; cx <= cx1; ++cx) {
+            ChunkCoord c{cx, cy};
+            if (mOnDisk.count(c) && !mChunks.count(c))
+                wanted.push_back(c);
+        }
+    const float midX = view.x + view.w * 0.5f, midY = view.y + view.h * 0.5f;
+    auto        dist = [&](ChunkCoord c) {
+        const float dx = (c.cx + 0.5f) * S - midX, dy = (c.cy + 0.5f) * S - midY;
+        return dx * dx + dy * dy;
+    };
+    std::sort(wanted.begin(), wanted.end(),
+              [&](ChunkCoord a, ChunkCoord b) { return dist(a) < dist(b); });
+    for (ChunkCoord c : wanted)
+        Request(c);
+
+    // Spawn ready chunks inside the spawn ring, a few per frame.
+    int budget = MAX_SPAWNS_PER_UPDATE;
+    for (auto& [c, ch] : mChunks) {
+        if (budget <= 0)
+            break;
+        if (ch.state == State::Ready && InRing(c, view, SPAWN_RING)) {
+            SpawnChunk(ch, c);
+            changed = true;
+            --budget;
+        }
+    }
+
+    CollectTextures();
+    return changed;
+}
+
+bool ChunkStreamer::Prime(const SDL_FRect& view) {
+    bool spawned = false;
+    DrainReady();
+    for (ChunkCoord c : mChunking.chunks) {
+        if (!InRing(c, view, SPAWN_RING))
+            continue;
+        Chunk& ch = mChunks[c];
+        if (ch.state == State::Queued) {
+            Prepared p = PrepareChunk(ChunkFilePath(mLevelPath, mChunking, c), c);
+            AdoptAnims(p.anims);
+            ch.tiles    = std::move(p.tiles);
+            ch.surfaces = std::move(p.surfaces);
+            ch.state    = State::Ready;
+        }
+        if (ch.state == State::Ready) {
+            SpawnChunk(ch, c);
+            spawned = true;
+        }
+    }
+    CollectTextures();
+    // Let the worker start on the prefetch ring straight away.
+    return Update(view) || spawned;
+}
+
+void ChunkStreamer::ResetSpawned() {
+    mBroken.clear();
+    for (auto& [c, ch] : mChunks) {
+        if (ch.state != State::Spawned)
+            continue;
+        ch.entities.clear();
+        for (const auto& key : ch.texRefs)
+            ReleaseTexture(key);
+        ch.texRefs.clear();
+        ch.state = State::Ready;
+    }
+}
+
+bool ChunkStreamer::Unspawned(float x, float y) const {
+    const float S = (float)mChunking.size;
+    ChunkCoord  c{(int)std::floor(x / S), (int)std::floor(y / S)};
+    if (!mOnDisk.count(c))
+        return false;
+    auto it = mChunks.find(c);
+    return it == mChunks.end() || it->second.state != State::Spawned;
+}
+
+int ChunkStreamer::SpawnedChunks() const {
+    int n = 0;
+    for (const auto& [c, ch] : mChunks)
+        if (ch.state == State::Spawned)
+            ++n;
+    return n;
+}
@@ -0,0 +1,276 @@
+#include "EditorBulkOps.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <unordered_map>
+
+namespace {
+using Kind = EditorHistory::Kind;
+
+std::int64_t PosKey(int x, int y) {
+    return (static_cast<std::int64_t>(x) << 32) | static_cast<std::uint32_t>(y);
+}
+
+// Maps group ids of one paste to fresh ones above `next`, 0 staying 0.
+struct GroupRemap {
+    int                          next = 0; // highest id in use
+    std::unordered_map<int, int> ids;
+
+    int operator()(int id) {
+        if (id == 0)
+            return 0;
+        auto [it, fresh] = ids.try_emplace(id, next + 1);
+        if (fresh)
+            ++next;
+        return it->second;
+    }
+};
+
+// Action groups live in 1..ActionData::MAX_GROUP, the range the Action tool
+// cycles through, so a paste takes the lowest ids still free in the level.
+// Once they run out the remaining groups paste as standalone (0).
+struct ActionGroupRemap {
+    bool                         used[ActionData::MAX_GROUP + 1] = {};
+    std::unordered_map<int, int> ids;
+    int                          ungrouped = 0; // pasted tiles that lost their group
+
+    int operator()(int id) {
+        if (id == 0)
+            return 0;
+        auto [it, fresh] = ids.try_emplace(id, 0);
+        if (fresh)
+            for (int g = 1; g <= ActionData::MAX_GROUP; ++g)
+                if (!used[g]) {
+                    used[g]    = true;
+                    it->second = g;
+                    break;
+                }
+        if (it->second == 0)
+            ++ungrouped;
+        return it->second;
+    }
+};
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Copy / paste / erase
+// ─────────────────────────────────────────────────────────────────────────────
+EditorBulkOps::Clipboard EditorBulkOps::Copy(const Level& level,
+                                             const std::vector<int>& indices) {
+    Clipboard clip;
+    float     x0 = (float)INT_MAX, y0 = (float)INT_MAX;
+    float     x1 = (float)INT_MIN, y1 = (float)INT_MIN;
+    for (int i : indices) {
+        if (i < 0 || i >= (int)level.tiles.size())
+            continue;
+        const auto& t = level.tiles[i];
+        x0            = std::min(x0, t.x);
+        y0            = std::min(y0, t.y);
+        x1            = std::max(x1, t.x + t.w);
+        y1            = std::max(y1, t.y + t.h);
+    }
+    if (x0 > x1)
+        return clip;
+
+    // Keep level order so overlapping tiles stack the same way when pasted.
+    std::vector<int> order = indices;
+    std::sort(order.begin(), order.end());
+    order.erase(std::unique(order.begin(), order.end()), order.end());
+    clip.tiles.reserve(order.size());
+    for (int i : order) {
+        if (i < 0 || i >= (int)level.tiles.size())
+            continue;
+        TileSpawn t = level.tiles[i];
+        t.x -= x0;
+        t.y -= y0;
+        clip.tiles.push_back(std::move(t));
+    }
+    clip.w = (int)(x1 - x0);
+    clip.h = (int)(y1 - y0);
+    return clip;
+}
+
+int EditorBulkOps::Paste(Level& level, EditorHistory& history, const Clipboard& clip,
+                         float x, float y, int* ungrouped) {
+    // Only grouped clipboards pay for the scan of the level's ids.
+    const bool grouped =
+        std::any_of(clip.tiles.begin(), clip.tiles.end(), [](const TileSpawn& t) {
+            return (t.HasMoving() && t.moving->groupId) ||
+                   (t.HasAction() && t.action->group);
+        });
+    GroupRemap       moveIds;
+    ActionGroupRemap actionIds;
+    if (grouped)
+        for (const auto& t : level.tiles) {
+            if (t.HasMoving())
+                moveIds.next = std::max(moveIds.next, t.moving->groupId);
+            if (t.HasAction() && t.action->group > 0 &&
+                t.action->group <= ActionData::MAX_GROUP)
+                actionIds.used[t.action->group] = true;
+        }
+
+    const int first = (int)level.tiles.size();
+    level.tiles.reserve(level.tiles.size() + clip.tiles.size());
+    for (const auto& src : clip.tiles) {
+        TileSpawn t = src;
+        t.x += x;
+        t.y += y;
+        if (t.HasMoving())
+            t.moving->groupId = moveIds(t.moving->groupId);
+        if (t.HasAction())
+            t.action->group = actionIds(t.action->group);
+        level.tiles.push_back(std::move(t));
+    }
+    history.AppendedRange(level, Kind::Tile, first);
+    if (ungrouped)
+        *ungrouped = actionIds.ungrouped;
+    return first;
+}
+
+int EditorBulkOps::EraseTiles(Level& level, EditorHistory& history, std::vector<int> indices) {
+    std::erase_if(indices, [&](int i) { return i < 0 || i >= (int)level.tiles.size(); });
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    if (indices.empty())
+        return 0;
+
+    history.ErasingMany(level, Kind::Tile, indices);
+
+    // One compaction pass instead of an erase (and tail shift) per tile.
+    auto&  tiles = level.tiles;
+    size_t w = (size_t)indices.front(), k = 0;
+    for (size_t r = w; r < tiles.size(); ++r) {
+        if (k < indices.size() && indices[k] == (int)r) {
+            ++k;
+            continue;
+        }
+        tiles[w++] = std::move(tiles[r]);
+    }
+    tiles.erase(tiles.begin() + w, tiles.end());
+    return (int)indices.size();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Flood fill
+// ─────────────────────────────────────────────────────────────────────────────
+int EditorBulkOps::FloodFill(Level& level, EditorHistory& history, EditorSpatialIndex& spatial,
+                             int grid, SDL_Rect bounds, int wx, int wy, const TileSpawn& proto,
+                             bool* truncated) {
+    if (truncated)
+        *truncated = false;
+    if (proto.w <= 0 || proto.h <= 0 || bounds.w <= 0 || bounds.h <= 0)
+        return 0;
+    int seed = spatial.HitTile(level, grid, wx, wy);
+    if (seed >= 0)
+        return Reskin(level, history, spatial, grid, bounds, seed, proto, truncated);
+    return FillEmpty(level, history, spatial, grid, bounds, FloorDiv(wx, grid) * grid,
+                     FloorDiv(wy, grid) * grid, proto, truncated);
+}
+
+// Cells of the lattice anchored at (ox, oy) that touch `bounds` form an
+// nx x ny occupancy grid, rasterised once from the tiles in the area; the
+// fill is then a plain BFS over it.
+int EditorBulkOps::FillEmpty(Level& level, EditorHistory& history, EditorSpatialIndex& spatial,
+                             int grid, SDL_Rect bounds, int ox, int oy, const TileSpawn& proto,
+                             bool* truncated) {
+    const int cw = proto.w, ch = proto.h;
+    const int i0 = FloorDiv(bounds.x - ox, cw), i1 = FloorDiv(bounds.x + bounds.w - 1 - ox, cw);
+    const int j0 = FloorDiv(bounds.y - oy, ch), j1 = FloorDiv(bounds.y + bounds.h - 1 - oy, ch);
+    if (i0 > 0 || i1 < 0 || j0 > 0 || j1 < 0)
+        return 0; // seed cell outside the bounds
+    const int nx = i1 - i0 + 1, ny = j1 - j0 + 1;
+
+    enum : char { Free, Blocked, Filled };
+    std::vector<char> cells((size_t)nx * ny, Free);
+    std::vector<int>  hits;
+    spatial.TilesInRect(
+        level, grid, {ox + i0 * cw, oy + j0 * ch, nx * cw, ny * ch}, hits);
+    for (int idx : hits) {
+        const auto& t  = level.tiles[idx];
+        const int   tx = (int)t.x, ty = (int)t.y;
+        const int   a0 = std::max(i0, FloorDiv(tx - ox, cw));
+        const int   a1 = std::min(i1, FloorDiv(tx + t.w - 1 - ox, cw));
+        const int   b0 = std::max(j0, FloorDiv(ty - oy, ch));
+        const int   b1 = std::min(j1, FloorDiv(ty + t.h - 1 - oy, ch));
+        for (int j = b0; j <= b1; ++j)
+            for (int i = a0; i <= a1; ++i)
+                cells[(size_t)(j - j0) * nx + (i - i0)] = Blocked;
+    }
+
+    const int start = (0 - j0) * nx + (0 - i0);
+    if (cells[start] != Free)
+        return 0;
+
+    std::vector<int> queue{start};
+    cells[start] = Filled;
+    for (size_t q = 0; q < queue.size() && (int)queue.size() < MAX_FILL_TILES; ++q) {
+        const int c = queue[q], cx = c % nx, cy = c / nx;
+        const int next[4][2] = {{cx - 1, cy}, {cx + 1, cy}, {cx, cy - 1}, {cx, cy + 1}};
+        for (const auto& n : next) {
+            if (n[0] < 0 || n[0] >= nx || n[1] < 0 || n[1] >= ny)
+                continue;
+            const int ni = n[1] * nx + n[0];
+            if (cells[ni] != Free || (int)queue.size() >= MAX_FILL_TILES)
+                continue;
+            cells[ni] = Filled;
+            queue.push_back(ni);
+        }
+    }
+    if ((int)queue.size() >= MAX_FILL_TILES && truncated)
+        *truncated = true;
+
+    // Row-major, so the new tiles sit in the level in reading order.
+    std::sort(queue.begin(), queue.end());
+    const int first = (int)level.tiles.size();
+    level.tiles.reserve(level.tiles.size() + queue.size());
+    for (int c : queue) {
+        TileSpawn t = proto;
+        t.x         = (float)(ox + (c % nx + i0) * cw);
+        t.y         = (float)(oy + (c / nx + j0) * ch);
+        level.tiles.push_back(std::move(t));
+    }
+    history.AppendedRange(level, Kind::Tile, first);
+    return (int)queue.size();
+}
+
+// Edits in place, so plain per-tile Touch records suffice (no vector shifts).
+int EditorBulkOps::Reskin(Level& level, EditorHistory& history, EditorSpatialIndex& spatial,
+                          int grid, SDL_Rect bounds, int seed, const TileSpawn& proto,
+                          bool* truncated) {
+    const TileSpawn ref = level.tiles[seed];
+    if (ref.imagePath == proto.imagePath)
+        return 0;
+
+    // Same-looking tiles in the area by position; the top-most wins a tie.
+    std::vector<int> hits;
+    spatial.TilesInRect(level, grid, bounds, hits);
+    std::unordered_map<std::int64_t, int> at;
+    for (int idx : hits) {
+        const auto& t = level.tiles[idx];
+        if (t.imagePath == ref.imagePath && t.w == ref.w && t.h == ref.h)
+            at[PosKey((int)t.x, (int)t.y)] = idx;
+    }
+    at.erase(PosKey((int)ref.x, (int)ref.y));
+
+    std::vector<int> queue{seed};
+    for (size_t q = 0; q < queue.size() && (int)queue.size() < MAX_FILL_TILES; ++q) {
+        const auto& t          = level.tiles[queue[q]];
+        const int   x          = (int)t.x, y = (int)t.y;
+        const int   next[4][2] = {{x - ref.w, y}, {x + ref.w, y}, {x, y - ref.h}, {x, y + ref.h}};
+        for (const auto& n : next) {
+            auto it = at.find(PosKey(n[0], n[1]));
+            if (it == at.end() || (int)queue.size() >= MAX_FILL_TILES)
+                continue;
+            queue.push_back(it->second);
+            at.erase(it);
+        }
+    }
+    if ((int)queue.size() >= MAX_FILL_TILES && truncated)
+        *truncated = true;
+
+    for (int idx : queue) {
+        history.Touch(level, Kind::Tile, idx);
+        level.tiles[idx].imagePath = proto.imagePath;
+    }
+    return (int)queue.size();
+}
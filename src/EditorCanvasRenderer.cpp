@@ -1,12 +1,12 @@
 #include "EditorCanvasRenderer.hpp"
 #include "AnimatedTile.hpp"
-#include "EnemyProfile.hpp"
 #include "tools/PlacementTools.hpp"
 #include <SDL3_image/SDL_image.h>
 #include <algorithm>
 #include <cmath>
 #include <print>
 #include <string>
+#include <vector>
 
 namespace {
 // ─── Generic surface drawing helpers (internal linkage) ─────────────────────
@@ -14,16 +14,6 @@ void DrawRectS(SDL_Surface* s, SDL_Rect r, SDL_Color c) {
     const auto* fmt = SDL_GetPixelFormatDetails(s->format);
     SDL_FillSurfaceRect(s, &r, SDL_MapRGBA(fmt, nullptr, c.r, c.g, c.b, c.a));
 }
-void DrawRectAlphaS(SDL_Surface* s, SDL_Rect r, SDL_Color c) {
-    if (r.w <= 0 || r.h <= 0) return;
-    SDL_Surface* ov = SDL_CreateSurface(r.w, r.h, SDL_PIXELFORMAT_ARGB8888);
-    if (!ov) return;
-    SDL_SetSurfaceBlendMode(ov, SDL_BLENDMODE_BLEND);
-    const auto* fmt = SDL_GetPixelFormatDetails(ov->format);
-    SDL_FillSurfaceRect(ov, nullptr, SDL_MapRGBA(fmt, nullptr, c.r, c.g, c.b, c.a));
-    SDL_BlitSurface(ov, nullptr, s, &r);
-    SDL_DestroySurface(ov);
-}
 void DrawOutlineS(SDL_Surface* s, SDL_Rect r, SDL_Color c, int t = 1) {
     const auto* fmt = SDL_GetPixelFormatDetails(s->format);
     Uint32      col = SDL_MapRGBA(fmt, nullptr, c.r, c.g, c.b, c.a);
@@ -35,15 +25,15 @@ void DrawOutlineS(SDL_Surface* s, SDL_Rect r, SDL_Color c, int t = 1) {
     };
     for (auto& rr : rects) SDL_FillSurfaceRect(s, &rr, col);
 }
+SDL_FRect ToF(const SDL_Rect& r) {
+    return {(float)r.x, (float)r.y, (float)r.w, (float)r.h};
+}
 } // namespace
 
 // ── Statics (delegate to anonymous namespace) ─────────────────────────────
 void EditorCanvasRenderer::DrawRect(SDL_Surface* s, SDL_Rect r, SDL_Color c) {
     DrawRectS(s, r, c);
 }
-void EditorCanvasRenderer::DrawRectAlpha(SDL_Surface* s, SDL_Rect r, SDL_Color c) {
-    DrawRectAlphaS(s, r, c);
-}
 void EditorCanvasRenderer::DrawOutline(SDL_Surface* s, SDL_Rect r, SDL_Color c, int t) {
     DrawOutlineS(s, r, c, t);
 }
@@ -57,16 +47,91 @@ SDL_Surface* EditorCanvasRenderer::Badge(EditorSurfaceCache& cache,
     return cache.GetBadge(text, col);
 }
 
+// ── GPU helpers ─────────────────────────────────────────────────────────────
+// Same geometry as the surface helpers so the canvas looks as it did when it
+// was rasterised on the CPU; fills are alpha-blended over what's beneath.
+void EditorCanvasRenderer::FillRect(SDL_Rect r, SDL_Color c) const {
+    if (r.w <= 0 || r.h <= 0) return;
+    SDL_SetRenderDrawColor(mRen, c.r, c.g, c.b, c.a);
+    SDL_FRect f = ToF(r);
+    SDL_RenderFillRect(mRen, &f);
+}
+void EditorCanvasRenderer::Outline(SDL_Rect r, SDL_Color c, int t) const {
+    SDL_SetRenderDrawColor(mRen, c.r, c.g, c.b, c.a);
+    SDL_FRect rects[4] = {
+        ToF({r.x, r.y, r.w, t}),
+        ToF({r.x, r.y + r.h, r.w, t}),
+        ToF({r.x, r.y, t, r.h}),
+        ToF({r.x + r.w, r.y, t, r.h}),
+    };
+    SDL_RenderFillRects(mRen, rects, 4);
+}
+
+// GPU copies are keyed by the cached surface itself (a tile's rotation and
+// mip level are separate surfaces), so per-tile lookups build no strings.
+SDL_Texture* EditorCanvasRenderer::SurfaceTexture(SDL_Surface* surf) {
+    return surf ? mTextures->FromSurface(mRen, surf) : nullptr;
+}
+
+SDL_Point EditorCanvasRenderer::BadgeSize(const std::string& text, SDL_Color col) {
+    SDL_Surface* b = mCache->GetBadge(text, col);
+    return b ? SDL_Point{b->w, b->h} : SDL_Point{0, 0};
+}
+
+SDL_Point EditorCanvasRenderer::DrawBadge(const std::string& text, SDL_Color col,
+                                          int x, int y) {
+    return DrawBadge(mCache->GetBadge(text, col), x, y);
+}
+
+SDL_Point EditorCanvasRenderer::DrawBadge(SDL_Surface* badge, int x, int y) {
+    if (!badge) return {0, 0};
+    if (SDL_Texture* tex = SurfaceTexture(badge)) {
+        SDL_FRect d = {(float)x, (float)y, (float)badge->w, (float)badge->h};
+        SDL_RenderTexture(mRen, tex, nullptr, &d);
+    }
+    return {badge->w, badge->h};
+}
+
+// Tiles use the full-res surfaces in EditorSurfaceCache, decoded the first
+// time a tile is drawn and uploaded once per path + rotation + mip level.
+SDL_Texture* EditorCanvasRenderer::TileTexture(const std::string& path, int rotation,
+                                               int dstW, int dstH) {
+    SDL_Surface* src = mCache->LoadAndCache(path);
+    if (!src) return nullptr;
+    SDL_Surface* draw = (rotation != 0) ? mCache->GetRotated(path, src, rotation) : src;
+    if (!draw) draw = src;
+    int level = EditorSurfaceCache::MipLevelFor(draw->w, draw->h, dstW, dstH);
+    if (level > 0)
+        if (SDL_Surface* mip = mCache->GetMip(path, draw, rotation, level))
+            draw = mip;
+    return SurfaceTexture(draw);
+}
+
+SDL_Texture* EditorCanvasRenderer::SheetTexture(SpriteSheet* sheet) {
+    if (!sheet) return nullptr;
+    if (SDL_Texture* t = sheet->GetTexture()) return t;
+    return sheet->CreateTexture(mRen);
+}
+
+void EditorCanvasRenderer::SetScaleFor(SDL_Texture* tex, const SDL_Rect& dst,
+                                       float srcW, float srcH) {
+    SDL_SetTextureScaleMode(tex, (dst.w < srcW || dst.h < srcH) ? SDL_SCALEMODE_LINEAR
+                                                                : SDL_SCALEMODE_PIXELART);
+}
+
 // ── Main entry ──────────────────────────────────────────────────────────────
 void EditorCanvasRenderer::Render(
     Window&              window,
-    SDL_Surface*         screen,
+    SDL_Surface*         overlay,
+    TileTextureCache&    textures,
     int                  canvasW,
     int                  toolbarH,
     int                  grid,
     const Level&         level,
+    EditorSpatialIndex&  spatial,
     const EditorCamera&  camera,
     EditorSurfaceCache&  cache,
+    EditorEnemyTypes&    enemyTypes,
     const EditorPalette& palette,
     Image*               background,
     SpriteSheet*         coinSheet,
@@ -79,8 +144,11 @@ void EditorCanvasRenderer::Render(
 {
     SDL_Renderer* ren  = window.GetRenderer();
     int           winH = window.GetHeight();
+    mRen      = ren;
+    mTextures = &textures;
+    mCache    = &cache;
 
-    // ── Background (GPU-rendered before the surface pipeline) ────────────────
+    // ── Background ───────────────────────────────────────────────────────────
     if (background) {
         if (background->GetFitMode() == FitMode::SCROLL)
             background->RenderScrolling(ren, camera.X(), 0.0f);
@@ -90,18 +158,35 @@ void EditorCanvasRenderer::Render(
             background->Render(ren);
     }
 
-    RenderGrid(screen, canvasW, toolbarH, winH, camera, grid);
-    RenderTiles(screen, canvasW, toolbarH, winH, level, camera, cache,
-                activeToolId, actionAnimDropHover);
+    // ── World layer (GPU, clipped to the canvas) ─────────────────────────────
+    SDL_BlendMode prevBlend = SDL_BLENDMODE_NONE;
+    SDL_GetRenderDrawBlendMode(ren, &prevBlend);
+    SDL_SetRenderDrawBlendMode(ren, SDL_BLENDMODE_BLEND);
+    SDL_Rect clip = {0, toolbarH, canvasW, winH - toolbarH};
+    SDL_SetRenderClipRect(ren, &clip);
+
+    // Only tiles on screen are visited, so frame cost follows what is visible
+    // rather than level size. The world rect is padded by a pixel because the
+    // index stores tile positions truncated to ints.
+    const float zoom = camera.Zoom();
+    SDL_Rect    view = {(int)std::floor(camera.X()) - 1,
+                        (int)std::floor(camera.Y() + toolbarH / zoom) - 1,
+                        (int)std::ceil(canvasW / zoom) + 2,
+                        (int)std::ceil((winH - toolbarH) / zoom) + 2};
+    spatial.TilesInRect(level, grid, view, mVisible);
+
+    RenderGrid(canvasW, toolbarH, winH, camera, grid);
+    RenderTiles(canvasW, toolbarH, winH, level, camera, activeToolId, actionAnimDropHover);
 
     // ── Moving-platform tool overlay ─────────────────────────────────────────
     if (activeToolId == ToolId::MovingPlat) {
-        RenderMovingPlatOverlay(screen, canvasW, toolbarH, level, camera, cache, grid, movPlat);
+        RenderMovingPlatOverlay(overlay, canvasW, toolbarH, level, camera, grid, movPlat);
         if (movPlat.popupOpen)
-            RenderMovPlatPopup(screen, canvasW, toolbarH, cache, movPlat);
+            RenderMovPlatPopup(overlay, canvasW, toolbarH, cache, movPlat);
     } else {
         // Outside MovingPlat: subtle M badge on all moving tiles
-        for (int ti = 0; ti < (int)level.tiles.size(); ti++) {
+        SDL_Surface* movBadge = cache.GetBadge("M", {255, 255, 255, 255});
+        for (int ti : mVisible) {
             const auto& t = level.tiles[ti];
             if (!t.HasMoving()) continue;
             int tsx = (int)((t.x - camera.X()) * camera.Zoom());
@@ -110,27 +195,29 @@ void EditorCanvasRenderer::Render(
             int tsh = (int)(t.h * camera.Zoom());
             if (tsx + tsw <= 0 || tsx >= canvasW || tsy + tsh <= toolbarH || tsy >= winH)
                 continue;
-            DrawRect(screen, {tsx + 2, tsy + 2, 14, 14}, {0, 160, 180, 200});
-            BlitBadge(screen, Badge(cache, "M", {255, 255, 255, 255}), tsx + 4, tsy + 2);
+            FillRect({tsx + 2, tsy + 2, 14, 14}, {0, 160, 180, 200});
+            DrawBadge(movBadge, tsx + 4, tsy + 2);
         }
     }
 
-    RenderEntities(screen, canvasW, toolbarH, winH, level, camera, cache, coinSheet, enemySheet, grid);
-    RenderPlayerMarker(screen, level, camera);
+    RenderEntities(canvasW, toolbarH, winH, level, camera, enemyTypes, coinSheet, enemySheet);
+    RenderPlayerMarker(level, camera);
+    RenderGhost(canvasW, toolbarH, camera, palette, activeToolId, activeTool, grid);
+
+    SDL_SetRenderClipRect(ren, nullptr);
+    SDL_SetRenderDrawBlendMode(ren, prevBlend);
 
     // ── Tool overlay (Select marquee, Resize/Hitbox handles, etc.) ───────────
     if (activeTool) {
-        activeTool->RenderOverlay(toolCtx, screen, canvasW);
+        activeTool->RenderOverlay(toolCtx, overlay, canvasW);
     }
-
-    RenderGhost(screen, canvasW, toolbarH, camera, palette, cache, activeToolId, activeTool, grid);
 }
 
 // ── Grid ─────────────────────────────────────────────────────────────────────
-void EditorCanvasRenderer::RenderGrid(SDL_Surface* screen, int canvasW, int toolbarH,
-                                      int winH, const EditorCamera& cam, int grid)
+// All lines go out in a single SDL_RenderFillRects batch.
+void EditorCanvasRenderer::RenderGrid(int canvasW, int toolbarH, int winH,
+                                      const EditorCamera& cam, int grid)
 {
-    const auto* fmt    = SDL_GetPixelFormatDetails(screen->format);
     const float zoom   = cam.Zoom();
     const float camX   = cam.X();
     const float camY   = cam.Y();
@@ -138,49 +225,42 @@ void EditorCanvasRenderer::RenderGrid(SDL_Surface* screen, int canvasW, int tool
     // Alpha fades as you zoom out so the grid doesn't overwhelm the canvas
     float zoomT = std::clamp(
         (zoom - EditorCamera::ZOOM_MIN) / (1.0f - EditorCamera::ZOOM_MIN), 0.0f, 1.0f);
-    Uint8  gridAlpha = static_cast<Uint8>(4.0f + zoomT * 16.0f);
-    Uint32 gridCol   = SDL_MapRGBA(fmt, nullptr, 255, 255, 255, gridAlpha);
+    Uint8 gridAlpha = static_cast<Uint8>(4.0f + zoomT * 16.0f);
 
     int firstCol = (int)std::floor(camX / grid);
     int firstRow = (int)std::floor(camY / grid);
     int numCols  = (int)std::ceil(canvasW / (grid * zoom)) + 2;
     int numRows  = (int)std::ceil(winH    / (grid * zoom)) + 2;
 
+    std::vector<SDL_FRect> lines;
+    lines.reserve(numCols + numRows);
     for (int i = 0; i < numCols; i++) {
         float worldX = (firstCol + i) * (float)grid;
         int   sx     = (int)std::round((worldX - camX) * zoom);
         if (sx < 0 || sx >= canvasW) continue;
-        SDL_Rect l = {sx, toolbarH, 1, winH - toolbarH};
-        SDL_FillSurfaceRect(screen, &l, gridCol);
+        lines.push_back(ToF({sx, toolbarH, 1, winH - toolbarH}));
     }
     for (int i = 0; i < numRows; i++) {
         float worldY = (firstRow + i) * (float)grid;
         int   sy     = (int)std::round((worldY - camY) * zoom);
         if (sy < toolbarH || sy >= winH) continue;
-        SDL_Rect l = {0, sy, canvasW, 1};
-        SDL_FillSurfaceRect(screen, &l, gridCol);
+        lines.push_back(ToF({0, sy, canvasW, 1}));
     }
+    if (lines.empty()) return;
+    SDL_SetRenderDrawColor(mRen, 255, 255, 255, gridAlpha);
+    SDL_RenderFillRects(mRen, lines.data(), (int)lines.size());
 }
 
 // ── Tiles ─────────────────────────────────────────────────────────────────────
-void EditorCanvasRenderer::RenderTiles(SDL_Surface* screen, int canvasW, int toolbarH,
-                                       int winH, const Level& level,
-                                       const EditorCamera& cam,
-                                       EditorSurfaceCache& cache, ToolId activeToolId,
-                                       int actionAnimDropHover)
+void EditorCanvasRenderer::RenderTiles(int canvasW, int toolbarH, int winH,
+                                       const Level& level, const EditorCamera& cam,
+                                       ToolId activeToolId, int actionAnimDropHover)
 {
     const float zoom = cam.Zoom();
     const float camX = cam.X();
     const float camY = cam.Y();
 
-    auto blitBadge = [&](SDL_Surface* badge, int bx, int by) {
-        BlitBadge(screen, badge, bx, by);
-    };
-    auto badge = [&](const std::string& text, SDL_Color col) -> SDL_Surface* {
-        return cache.GetBadge(text, col);
-    };
-
-    for (int ti = 0; ti < (int)level.tiles.size(); ti++) {
+    for (int ti : mVisible) {
         const auto& t   = level.tiles[ti];
         int tsx = (int)((t.x - camX) * zoom);
         int tsy = (int)((t.y - camY) * zoom);
@@ -189,25 +269,27 @@ void EditorCanvasRenderer::RenderTiles(SDL_Surface* screen, int canvasW, int too
         if (tsx + tsw <= 0 || tsx >= canvasW || tsy + tsh <= toolbarH || tsy >= winH)
             continue;
 
-        SDL_Surface* ts  = cache.FindTileSurface(t.imagePath);
+        SDL_Texture* tex = TileTexture(t.imagePath, t.rotation, tsw, tsh);
         SDL_Rect     dst = {tsx, tsy, tsw, tsh};
 
-        if (ts) {
-            SDL_Surface* draw = (t.rotation != 0)
-                ? cache.GetRotated(t.imagePath, ts, t.rotation) : ts;
-            if (t.prop)   SDL_SetSurfaceColorMod(draw, 120, 255, 120);
-            if (t.ladder) SDL_SetSurfaceColorMod(draw, 120, 220, 255);
-            if (t.HasAction()) SDL_SetSurfaceColorMod(draw, 255, 160,  80);
-            if (t.hazard) SDL_SetSurfaceColorMod(draw, 255,  80,  80);
+        if (tex) {
+            Uint8 mr = 255, mg = 255, mb = 255;
+            if (t.prop)        { mr = 120; mg = 255; mb = 120; }
+            if (t.ladder)      { mr = 120; mg = 220; mb = 255; }
+            if (t.HasAction()) { mr = 255; mg = 160; mb =  80; }
+            if (t.hazard)      { mr = 255; mg =  80; mb =  80; }
+            float texW = 0, texH = 0;
+            SDL_GetTextureSize(tex, &texW, &texH);
+            SDL_SetTextureColorMod(tex, mr, mg, mb);
             // Use LINEAR when downscaling (zoom < 100%) for smooth minification;
             // PIXELART when at or above source size for crisp pixel edges.
-            SDL_ScaleMode tileScale = (dst.w < draw->w || dst.h < draw->h)
-                                    ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_PIXELART;
-            SDL_BlitSurfaceScaled(draw, nullptr, screen, &dst, tileScale);
-            if (t.prop || t.ladder || t.HasAction() || t.hazard)
-                SDL_SetSurfaceColorMod(draw, 255, 255, 255);
+            SetScaleFor(tex, dst, texW, texH);
+            SDL_FRect d = ToF(dst);
+            SDL_RenderTexture(mRen, tex, nullptr, &d);
+            if (mr != 255 || mg != 255 || mb != 255)
+                SDL_SetTextureColorMod(tex, 255, 255, 255);
         } else {
-            DrawRect(screen, dst, {80, 80, 120, 200});
+            FillRect(dst, {80, 80, 120, 200});
         }
 
         SDL_Color outlineCol = t.ladder   ? SDL_Color{0, 220, 220, 255}
@@ -215,15 +297,15 @@ void EditorCanvasRenderer::RenderTiles(SDL_Surface* screen, int canvasW, int too
                              : t.HasAction() ? SDL_Color{255, 160, 60, 255}
                              : t.hazard   ? SDL_Color{255, 60, 60, 255}
                                           : SDL_Color{100, 180, 255, 255};
-        DrawOutline(screen, dst, outlineCol);
+        Outline(dst, outlineCol);
 
         // ── Stacked top-left badges ──────────────────────────────────────────
         {
             int           bx = tsx + 2;
             constexpr int BH = 14, BW = 14, GAP = 2;
             auto drawBadge = [&](const char* label, SDL_Color bg, SDL_Color fg) {
-                DrawRect(screen, {bx, tsy + 2, BW, BH}, bg);
-                blitBadge(badge(label, fg), bx + 2, tsy + 2);
+                FillRect({bx, tsy + 2, BW, BH}, bg);
+                DrawBadge(label, fg, bx + 2, tsy + 2);
                 bx += BW + GAP;
             };
             if (t.prop)   drawBadge("P", {0, 180, 0, 210},       {255, 255, 255, 255});
@@ -233,8 +315,8 @@ void EditorCanvasRenderer::RenderTiles(SDL_Surface* screen, int canvasW, int too
                 if (t.action->group > 0)  ab += std::to_string(t.action->group);
                 if (t.action->hitsRequired > 1) ab += "x" + std::to_string(t.action->hitsRequired);
                 int abw = (int)ab.size() * 6 + 4;
-                DrawRect(screen, {bx, tsy + 2, abw, BH}, {200, 100, 0, 200});
-                blitBadge(badge(ab, {255, 255, 255, 255}), bx + 2, tsy + 2);
+                FillRect({bx, tsy + 2, abw, BH}, {200, 100, 0, 200});
+                DrawBadge(ab, {255, 255, 255, 255}, bx + 2, tsy + 2);
                 bx += abw + GAP;
             }
             if (t.hazard)    drawBadge("H", {200, 0, 0, 220},    {255, 255, 255, 255});
@@ -242,9 +324,9 @@ void EditorCanvasRenderer::RenderTiles(SDL_Surface* screen, int canvasW, int too
             if (t.HasPowerUp()) {
                 std::string pb  = t.powerUp->type.empty() ? "PU" : t.powerUp->type.substr(0, 2);
                 int         pw  = (int)pb.size() * 6 + 4;
-                DrawRect(screen, {bx, tsy + 2, pw, BH}, {180, 0, 220, 220});
-                DrawOutline(screen, {bx, tsy + 2, pw, BH}, {255, 80, 255, 255});
-                blitBadge(badge(pb, {255, 255, 255, 255}), bx + 2, tsy + 2);
+                FillRect({bx, tsy + 2, pw, BH}, {180, 0, 220, 220});
+                Outline({bx, tsy + 2, pw, BH}, {255, 80, 255, 255});
+                DrawBadge(pb, {255, 255, 255, 255}, bx + 2, tsy + 2);
                 bx += pw + GAP;
             }
             if (t.HasSlope()) {
@@ -252,8 +334,8 @@ void EditorCanvasRenderer::RenderTiles(SDL_Surface* screen, int canvasW, int too
                 if (t.slope->heightFrac < 0.99f)
                     sb += std::to_string((int)std::round(t.slope->heightFrac * 100)) + "%";
                 int bw = (int)sb.size() * 6 + 4;
-                DrawRect(screen, {bx, tsy + 2, bw, BH}, {160, 120, 0, 200});
-                blitBadge(badge(sb, {255, 255, 255, 255}), bx + 2, tsy + 2);
+                FillRect({bx, tsy + 2, bw, BH}, {160, 120, 0, 200});
+                DrawBadge(sb, {255, 255, 255, 255}, bx + 2, tsy + 2);
                 bx += bw + GAP;
             }
             (void)bx;
@@ -266,36 +348,38 @@ void EditorCanvasRenderer::RenderTiles(SDL_Surface* screen, int canvasW, int too
             int aby = tsy + tsh - ANIM_SZ - 2;
             if (abx > tsx + 14 + 2 && aby > tsy + 14) {
                 if (!t.action->destroyAnimPath.empty()) {
-                    DrawRect(screen, {abx-1, aby-1, ANIM_SZ+2, ANIM_SZ+2}, {120, 0, 200, 200});
-                    SDL_Surface* animThumb = cache.GetDestroyAnimThumb(t.action->destroyAnimPath);
+                    FillRect({abx-1, aby-1, ANIM_SZ+2, ANIM_SZ+2}, {120, 0, 200, 200});
+                    SDL_Texture* animThumb = SurfaceTexture(
+                        mCache->GetDestroyAnimThumb(t.action->destroyAnimPath));
                     if (animThumb) {
-                        SDL_Rect d2 = {abx, aby, ANIM_SZ, ANIM_SZ};
-                        SDL_BlitSurfaceScaled(animThumb, nullptr, screen, &d2, SDL_SCALEMODE_LINEAR);
+                        SDL_FRect d2 = ToF({abx, aby, ANIM_SZ, ANIM_SZ});
+                        SDL_SetTextureScaleMode(animThumb, SDL_SCALEMODE_LINEAR);
+                        SDL_RenderTexture(mRen, animThumb, nullptr, &d2);
                     }
-                    DrawOutline(screen, {abx-1, aby-1, ANIM_SZ+2, ANIM_SZ+2}, {200, 80, 255, 255});
+                    Outline({abx-1, aby-1, ANIM_SZ+2, ANIM_SZ+2}, {200, 80, 255, 255});
                 } else if (activeToolId == ToolId::Action && tsw >= 24 && tsh >= 24) {
-                    DrawRect(screen, {abx, aby, ANIM_SZ, ANIM_SZ}, {60, 20, 80, 140});
-                    DrawOutline(screen, {abx, aby, ANIM_SZ, ANIM_SZ}, {140, 60, 180, 160});
-                    blitBadge(badge("+", {180, 100, 220, 200}), abx + 4, aby + 3);
+                    FillRect({abx, aby, ANIM_SZ, ANIM_SZ}, {60, 20, 80, 140});
+                    Outline({abx, aby, ANIM_SZ, ANIM_SZ}, {140, 60, 180, 160});
+                    DrawBadge("+", {180, 100, 220, 200}, abx + 4, aby + 3);
                 }
                 if (activeToolId == ToolId::Action && tsw >= 40) {
                     std::string gs  = (t.action->group == 0) ? "G-" : ("G" + std::to_string(t.action->group));
                     SDL_Color   gc  = (t.action->group == 0)
                                     ? SDL_Color{120, 120, 140, 200}
                                     : SDL_Color{255, 220,  60, 255};
-                    SDL_Surface* gb = badge(gs, gc);
-                    if (gb) {
-                        int gx = abx - gb->w - 3;
-                        int gy = aby + ANIM_SZ / 2 - gb->h / 2;
-                        blitBadge(gb, gx, gy);
+                    SDL_Point gsz = BadgeSize(gs, gc);
+                    if (gsz.x > 0) {
+                        int gx = abx - gsz.x - 3;
+                        int gy = aby + ANIM_SZ / 2 - gsz.y / 2;
+                        DrawBadge(gs, gc, gx, gy);
                     }
                 }
             }
             // Drop-hover highlight
             if (ti == actionAnimDropHover) {
-                DrawRect(screen, {tsx, tsy, tsw, tsh}, {140, 0, 220, 70});
-                DrawOutline(screen, {tsx, tsy, tsw, tsh}, {200, 80, 255, 255}, 2);
-                blitBadge(badge("Drop anim here", {255, 200, 255, 255}),
+                FillRect({tsx, tsy, tsw, tsh}, {140, 0, 220, 70});
+                Outline({tsx, tsy, tsw, tsh}, {200, 80, 255, 255}, 2);
+                DrawBadge("Drop anim here", {255, 200, 255, 255},
                           tsx + tsw / 2 - 42, tsy + tsh / 2 - 5);
             }
         }
@@ -312,16 +396,10 @@ void EditorCanvasRenderer::RenderTiles(SDL_Surface* screen, int canvasW, int too
                 lx0 = tsx;       ly0 = highY;
                 lx1 = tsx + tsw; ly1 = lowY;
             }
-            int ddx = lx1 - lx0, ddy = ly1 - ly0;
-            int steps = std::max(std::abs(ddx), std::abs(ddy));
-            if (steps > 0) {
-                float ssx = (float)ddx / steps, ssy = (float)ddy / steps;
-                float ccx = (float)lx0,         ccy = (float)ly0;
-                for (int s = 0; s <= steps; ++s) {
-                    DrawRect(screen, {(int)ccx, (int)ccy, 2, 2}, {255, 220, 50, 220});
-                    ccx += ssx; ccy += ssy;
-                }
-            }
+            // 2px wide: the line plus a copy offset by one pixel.
+            SDL_SetRenderDrawColor(mRen, 255, 220, 50, 220);
+            SDL_RenderLine(mRen, (float)lx0, (float)ly0, (float)lx1, (float)ly1);
+            SDL_RenderLine(mRen, (float)lx0 + 1, (float)ly0 + 1, (float)lx1 + 1, (float)ly1 + 1);
         }
 
         // ── Rotation badge (bottom-right) ────────────────────────────────────
@@ -330,27 +408,23 @@ void EditorCanvasRenderer::RenderTiles(SDL_Surface* screen, int canvasW, int too
             int         rbw = 22;
             int         rbx = tsx + tsw - rbw - 2;
             int         rby = tsy + tsh - 14 - 2;
-            DrawRect(screen, {rbx, rby, rbw, 14}, {60, 60, 180, 200});
-            blitBadge(badge(rb, {200, 220, 255, 255}), rbx + 2, rby + 1);
+            FillRect({rbx, rby, rbw, 14}, {60, 60, 180, 200});
+            DrawBadge(rb, {200, 220, 255, 255}, rbx + 2, rby + 1);
         }
     }
 }
 
 // ── Moving-platform overlay ───────────────────────────────────────────────────
+// World-space paths and markers go to the GPU; the param bar is a screen-space
+// widget and goes into the overlay surface.
 void EditorCanvasRenderer::RenderMovingPlatOverlay(
-    SDL_Surface* screen, int canvasW, int toolbarH,
-    const Level& level, const EditorCamera& cam,
-    EditorSurfaceCache& cache, int grid, const MovPlatState& mp)
+    SDL_Surface* overlay, int canvasW, int toolbarH,
+    const Level& level, const EditorCamera& cam, int grid, const MovPlatState& mp)
 {
     const float zoom = cam.Zoom();
     const float camX = cam.X();
     const float camY = cam.Y();
 
-    auto blitBadge = [&](SDL_Surface* b, int bx, int by) { BlitBadge(screen, b, bx, by); };
-    auto badge = [&](const std::string& t, SDL_Color c) -> SDL_Surface* {
-        return cache.GetBadge(t, c);
-    };
-
     for (int ti = 0; ti < (int)level.tiles.size(); ti++) {
         const auto& t = level.tiles[ti];
         if (!t.HasMoving()) continue;
@@ -362,8 +436,8 @@ void EditorCanvasRenderer::RenderMovingPlatOverlay(
 
         SDL_Color fill   = inCur ? SDL_Color{0, 200, 200, 60} : SDL_Color{160, 80, 220, 40};
         SDL_Color border = inCur ? SDL_Color{0, 255, 255, 220}: SDL_Color{180, 100, 255, 160};
-        DrawRect(screen, {tsx, tsy, tsw, tsh}, fill);
-        DrawOutline(screen, {tsx, tsy, tsw, tsh}, border, 2);
+        FillRect({tsx, tsy, tsw, tsh}, fill);
+        Outline({tsx, tsy, tsw, tsh}, border, 2);
 
         int cx = tsx + tsw / 2, cy = tsy + tsh / 2;
         int sw = (int)(t.w * zoom), sh = (int)(t.h * zoom);
@@ -375,12 +449,12 @@ void EditorCanvasRenderer::RenderMovingPlatOverlay(
             lineStartX = tsx;
             int endWXSnapped = ((int)(t.x + mv.range) / grid) * grid;
             lineEndX = (int)std::round((endWXSnapped - camX) * zoom);
-            DrawRect(screen, {lineStartX, cy - 1, lineEndX - lineStartX, 2}, {0,255,255,100});
+            FillRect({lineStartX, cy - 1, lineEndX - lineStartX, 2}, {0,255,255,100});
         } else {
             lineStartY = tsy;
             int endWYSnapped = ((int)(t.y + mv.range) / grid) * grid;
             lineEndY = (int)std::round((endWYSnapped - camY) * zoom);
-            DrawRect(screen, {cx-1, lineStartY, 2, lineEndY-lineStartY}, {0,255,255,100});
+            FillRect({cx-1, lineStartY, 2, lineEndY-lineStartY}, {0,255,255,100});
         }
 
         // Direction arrow
@@ -391,21 +465,21 @@ void EditorCanvasRenderer::RenderMovingPlatOverlay(
             for (int row = 0; row < 7; row++) {
                 int half = row;
                 int rx   = (dir > 0) ? tipX + row - 7 : tipX - row + 1;
-                DrawRect(screen, {rx, acy - half, 1, half * 2 + 1}, {255,220,0,220});
+                FillRect({rx, acy - half, 1, half * 2 + 1}, {255,220,0,220});
             }
             if (mv.range > 0.0f) {
-                DrawRectAlpha(screen, {tsx, tsy, sw, sh}, {0,200,80,60});
-                DrawOutline(screen, {tsx, tsy, sw, sh}, {0,255,100,200}, 2);
-                blitBadge(badge("S", {0,255,120,255}), tsx+2, tsy+2);
+                FillRect({tsx, tsy, sw, sh}, {0,200,80,60});
+                Outline({tsx, tsy, sw, sh}, {0,255,100,200}, 2);
+                DrawBadge("S", {0,255,120,255}, tsx+2, tsy+2);
                 int endWXSnapped = ((int)(t.x + mv.range) / grid) * grid;
                 int endSX = (int)std::round((endWXSnapped - camX) * zoom);
-                DrawRectAlpha(screen, {endSX, tsy, sw, sh}, {220,60,60,60});
-                DrawOutline(screen, {endSX, tsy, sw, sh}, {255,80,80,200}, 2);
-                blitBadge(badge("E", {255,100,100,255}), endSX+2, tsy+2);
+                FillRect({endSX, tsy, sw, sh}, {220,60,60,60});
+                Outline({endSX, tsy, sw, sh}, {255,80,80,200}, 2);
+                DrawBadge("E", {255,100,100,255}, endSX+2, tsy+2);
                 lineEndX = endSX;
                 int phasePx = tsx + (int)((lineEndX - tsx) * mv.phase);
-                DrawRect(screen, {phasePx-1, cy-12, 2, 24}, {255,255,0,200});
-                blitBadge(badge(std::to_string((int)(mv.phase*100))+"%",{255,255,180,255}),
+                FillRect({phasePx-1, cy-12, 2, 24}, {255,255,0,200});
+                DrawBadge(std::to_string((int)(mv.phase*100))+"%", {255,255,180,255},
                           phasePx-8, cy-24);
             }
         } else {
@@ -415,28 +489,28 @@ void EditorCanvasRenderer::RenderMovingPlatOverlay(
             for (int row = 0; row < 7; row++) {
                 int half = row;
                 int ry   = (dir > 0) ? tipY + row - 7 : tipY - row + 1;
-                DrawRect(screen, {acx - half, ry, half*2+1, 1}, {255,220,0,220});
+                FillRect({acx - half, ry, half*2+1, 1}, {255,220,0,220});
             }
             if (mv.range > 0.0f) {
-                DrawRectAlpha(screen, {tsx, tsy, sw, sh}, {0,200,80,60});
-                DrawOutline(screen, {tsx, tsy, sw, sh}, {0,255,100,200}, 2);
-                blitBadge(badge("S", {0,255,120,255}), tsx+2, tsy+2);
+                FillRect({tsx, tsy, sw, sh}, {0,200,80,60});
+                Outline({tsx, tsy, sw, sh}, {0,255,100,200}, 2);
+                DrawBadge("S", {0,255,120,255}, tsx+2, tsy+2);
                 int endWYSnapped = ((int)(t.y + mv.range) / grid) * grid;
                 int endSY = (int)std::round((endWYSnapped - camY) * zoom);
-                DrawRectAlpha(screen, {tsx, endSY, sw, sh}, {220,60,60,60});
-                DrawOutline(screen, {tsx, endSY, sw, sh}, {255,80,80,200}, 2);
-                blitBadge(badge("E", {255,100,100,255}), tsx+2, endSY+2);
+                FillRect({tsx, endSY, sw, sh}, {220,60,60,60});
+                Outline({tsx, endSY, sw, sh}, {255,80,80,200}, 2);
+                DrawBadge("E", {255,100,100,255}, tsx+2, endSY+2);
                 lineEndY = endSY;
                 int phasePy = tsy + (int)((lineEndY - tsy) * mv.phase);
-                DrawRect(screen, {acx-12, phasePy-1, 24, 2}, {255,255,0,200});
-                blitBadge(badge(std::to_string((int)(mv.phase*100))+"%",{255,255,180,255}),
+                FillRect({acx-12, phasePy-1, 24, 2}, {255,255,0,200});
+                DrawBadge(std::to_string((int)(mv.phase*100))+"%", {255,255,180,255},
                           acx+8, phasePy-6);
             }
         }
 
-        blitBadge(badge("M", {0,255,255,255}), tsx+2, tsy+2);
+        DrawBadge("M", {0,255,255,255}, tsx+2, tsy+2);
         if (mv.groupId != 0)
-            blitBadge(badge(std::to_string(mv.groupId), {200,255,255,255}), tsx+12, tsy+2);
+            DrawBadge(std::to_string(mv.groupId), {200,255,255,255}, tsx+12, tsy+2);
     }
 
     // Cursor preview of travel path before placing tiles
@@ -448,13 +522,13 @@ void EditorCanvasRenderer::RenderMovingPlatOverlay(
             int       r           = (int)mp.range;
             SDL_Color previewCol  = {0, 255, 200, 160};
             if (mp.horiz) {
-                DrawRect(screen, {mx-r, my-1, r*2, 2}, previewCol);
-                DrawRect(screen, {mx-r-4, my-4, 4, 8}, previewCol);
-                DrawRect(screen, {mx+r, my-4, 4, 8}, previewCol);
+                FillRect({mx-r, my-1, r*2, 2}, previewCol);
+                FillRect({mx-r-4, my-4, 4, 8}, previewCol);
+                FillRect({mx+r, my-4, 4, 8}, previewCol);
             } else {
-                DrawRect(screen, {mx-1, my-r, 2, r*2}, previewCol);
-                DrawRect(screen, {mx-4, my-r-4, 8, 4}, previewCol);
-                DrawRect(screen, {mx-4, my+r, 8, 4}, previewCol);
+                FillRect({mx-1, my-r, 2, r*2}, previewCol);
+                FillRect({mx-4, my-r-4, 8, 4}, previewCol);
+                FillRect({mx-4, my+r, 8, 4}, previewCol);
             }
         }
     }
@@ -469,12 +543,12 @@ void EditorCanvasRenderer::RenderMovingPlatOverlay(
         "  grp=" + std::to_string(mp.curGroupId) +
         "  tiles=" + std::to_string(mp.indices ? (int)mp.indices->size() : 0) +
         "  LClick=add  RClick=cycle preset";
-    DrawRect(screen, {0, toolbarH + 20, canvasW, 18}, {10, 30, 50, 210});
-    BlitBadge(screen, badge(paramStr, {0, 230, 230, 255}), 6, toolbarH + 23);
+    DrawRect(overlay, {0, toolbarH + 20, canvasW, 18}, {10, 30, 50, 210});
+    BlitBadge(overlay, mCache->GetBadge(paramStr, {0, 230, 230, 255}), 6, toolbarH + 23);
 }
 
 // ── Moving-platform config popup ─────────────────────────────────────────────
-void EditorCanvasRenderer::RenderMovPlatPopup(SDL_Surface* screen, int canvasW,
+void EditorCanvasRenderer::RenderMovPlatPopup(SDL_Surface* overlay, int canvasW,
                                                int toolbarH, EditorSurfaceCache& cache,
                                                const MovPlatState& mp)
 {
@@ -489,53 +563,53 @@ void EditorCanvasRenderer::RenderMovPlatPopup(SDL_Surface* screen, int canvasW,
     int py = toolbarH + 42;
     mMovPlatPopupRect = {px, py, PW, PH};
 
-    auto blitBadge = [&](SDL_Surface* b, int bx, int by) { BlitBadge(screen, b, bx, by); };
+    auto blitBadge = [&](SDL_Surface* b, int bx, int by) { BlitBadge(overlay, b, bx, by); };
     auto badge = [&](const std::string& t, SDL_Color c) -> SDL_Surface* {
         return cache.GetBadge(t, c);
     };
 
-    DrawRect(screen, {px, py, PW, PH}, {14, 22, 40, 245});
-    DrawOutline(screen, {px, py, PW, PH}, {0, 200, 160, 255}, 2);
-    DrawRect(screen, {px+1, py+1, PW-2, 3}, {0, 200, 160, 255});
+    DrawRect(overlay, {px, py, PW, PH}, {14, 22, 40, 245});
+    DrawOutline(overlay, {px, py, PW, PH}, {0, 200, 160, 255}, 2);
+    DrawRect(overlay, {px+1, py+1, PW-2, 3}, {0, 200, 160, 255});
 
     {
         std::string title = "Platform Config  (grp " + std::to_string(mp.curGroupId) + ")";
         auto [tx, ty] = Text::CenterInRect(title, 12, {px, py+4, PW, TITLE_H-4});
         Text tt(title, {0,230,200,255}, tx, ty, 12);
-        tt.RenderToSurface(screen);
+        tt.RenderToSurface(overlay);
     }
 
     int ry = py + TITLE_H;
 
     // Row 0: Speed field
     {
-        DrawRect(screen, {px+PAD, ry, PW-PAD*2, ROW_H}, {20,32,55,200});
+        DrawRect(overlay, {px+PAD, ry, PW-PAD*2, ROW_H}, {20,32,55,200});
         blitBadge(badge("Speed (px/s)", {160,200,220,255}), px+PAD+4, ry+(ROW_H-10)/2);
         int      fw      = PW - PAD*2 - 90 - 44;
         SDL_Rect field   = {px+PAD+90, ry+(ROW_H-20)/2, fw, 20};
         SDL_Color fBg    = mp.speedInput ? SDL_Color{40,80,160,255} : SDL_Color{25,40,70,255};
         SDL_Color fBd    = mp.speedInput ? SDL_Color{100,180,255,255} : SDL_Color{60,100,140,255};
-        DrawRect(screen, field, fBg);
-        DrawOutline(screen, field, fBd);
+        DrawRect(overlay, field, fBg);
+        DrawOutline(overlay, field, fBd);
         std::string disp = mp.speedInput ? mp.speedStr + "|" : std::to_string((int)mp.speed);
         blitBadge(badge(disp, {220,240,255,255}), field.x+4, field.y+(20-10)/2);
         SDL_Rect closeBtn = {px+PW-PAD-36, ry+(ROW_H-20)/2, 36, 20};
-        DrawRect(screen, closeBtn, {60,30,30,220});
-        DrawOutline(screen, closeBtn, {180,80,80,255});
+        DrawRect(overlay, closeBtn, {60,30,30,220});
+        DrawOutline(overlay, closeBtn, {180,80,80,255});
         blitBadge(badge("close",{220,140,140,255}), closeBtn.x+4, closeBtn.y+4);
     }
     ry += ROW_H + PAD;
 
     // Row 1: Direction
     {
-        DrawRect(screen, {px+PAD, ry, PW-PAD*2, ROW_H}, {20,32,55,200});
+        DrawRect(overlay, {px+PAD, ry, PW-PAD*2, ROW_H}, {20,32,55,200});
         blitBadge(badge("Direction",{160,200,220,255}), px+PAD+4, ry+(ROW_H-10)/2);
         SDL_Rect btnH = {px+PAD+90, ry+2, 48, ROW_H-4};
         SDL_Rect btnV = {px+PAD+90+54, ry+2, 48, ROW_H-4};
-        DrawRect(screen, btnH, mp.horiz ? SDL_Color{0,160,255,255} : SDL_Color{30,40,60,220});
-        DrawRect(screen, btnV, !mp.horiz? SDL_Color{0,160,255,255} : SDL_Color{30,40,60,220});
-        DrawOutline(screen, btnH, {0,120,200,255});
-        DrawOutline(screen, btnV, {0,120,200,255});
+        DrawRect(overlay, btnH, mp.horiz ? SDL_Color{0,160,255,255} : SDL_Color{30,40,60,220});
+        DrawRect(overlay, btnV, !mp.horiz? SDL_Color{0,160,255,255} : SDL_Color{30,40,60,220});
+        DrawOutline(overlay, btnH, {0,120,200,255});
+        DrawOutline(overlay, btnV, {0,120,200,255});
         {
             auto [hx,hy] = Text::CenterInRect("Horiz",10,btnH);
             blitBadge(badge("Horiz", mp.horiz?SDL_Color{255,255,255,255}:SDL_Color{120,160,200,255}),hx,hy);
@@ -547,22 +621,22 @@ void EditorCanvasRenderer::RenderMovPlatPopup(SDL_Surface* screen, int canvasW,
 
     // Row 2: Loop checkbox
     {
-        DrawRect(screen, {px+PAD, ry, PW-PAD*2, ROW_H}, {20,32,55,200});
+        DrawRect(overlay, {px+PAD, ry, PW-PAD*2, ROW_H}, {20,32,55,200});
         blitBadge(badge("Ping-pong loop",{160,200,220,255}), px+PAD+4, ry+(ROW_H-10)/2);
         SDL_Rect cb = {px+PAD+90, ry+(ROW_H-16)/2, 16, 16};
-        DrawRect(screen, cb, mp.loop?SDL_Color{0,180,120,255}:SDL_Color{30,40,60,255});
-        DrawOutline(screen, cb, {0,160,100,255});
+        DrawRect(overlay, cb, mp.loop?SDL_Color{0,180,120,255}:SDL_Color{30,40,60,255});
+        DrawOutline(overlay, cb, {0,160,100,255});
         if (mp.loop) blitBadge(badge("x",{255,255,255,255}), cb.x+3, cb.y+2);
     }
     ry += ROW_H + PAD;
 
     // Row 3: Move on touch
     {
-        DrawRect(screen, {px+PAD, ry, PW-PAD*2, ROW_H}, {20,32,55,200});
+        DrawRect(overlay, {px+PAD, ry, PW-PAD*2, ROW_H}, {20,32,55,200});
         blitBadge(badge("Move on touch",{160,200,220,255}), px+PAD+4, ry+(ROW_H-10)/2);
         SDL_Rect cb = {px+PAD+90, ry+(ROW_H-16)/2, 16, 16};
-        DrawRect(screen, cb, mp.trigger?SDL_Color{255,160,0,255}:SDL_Color{30,40,60,255});
-        DrawOutline(screen, cb, {200,140,0,255});
+        DrawRect(overlay, cb, mp.trigger?SDL_Color{255,160,0,255}:SDL_Color{30,40,60,255});
+        DrawOutline(overlay, cb, {200,140,0,255});
         if (mp.trigger) blitBadge(badge("x",{255,255,255,255}), cb.x+3, cb.y+2);
         blitBadge(badge("(waits for player to land)",
                         mp.trigger?SDL_Color{255,200,80,255}:SDL_Color{80,100,120,255}),
@@ -570,44 +644,38 @@ void EditorCanvasRenderer::RenderMovPlatPopup(SDL_Surface* screen, int canvasW,
     }
 }
 
+
 // ── Entities (coins, enemies) ─────────────────────────────────────────────────
-void EditorCanvasRenderer::RenderEntities(SDL_Surface* screen, int canvasW, int toolbarH,
-                                          int winH, const Level& level,
-                                          const EditorCamera& cam,
-                                          EditorSurfaceCache& cache,
-                                          SpriteSheet* coinSheet, SpriteSheet* enemySheet,
-                                          int grid)
+void EditorCanvasRenderer::RenderEntities(int canvasW, int toolbarH, int winH,
+                                          const Level& level, const EditorCamera& cam,
+                                          EditorEnemyTypes& enemyTypes,
+                                          SpriteSheet* coinSheet, SpriteSheet* enemySheet)
 {
     const float zoom  = cam.Zoom();
     const float camX  = cam.X();
     const float camY  = cam.Y();
     const int   iconS = std::max(4, (int)(40 * zoom));
 
-    if (coinSheet) {
+    if (SDL_Texture* coinTex = SheetTexture(coinSheet)) {
         auto frames = coinSheet->GetAnimation("Gold_");
         if (!frames.empty())
             for (const auto& c : level.coins) {
                 int cx = (int)((c.x - camX) * zoom), cy = (int)((c.y - camY) * zoom);
                 if (cx+iconS<=0||cx>=canvasW||cy+iconS<=toolbarH||cy>=winH) continue;
                 SDL_Rect s = frames[0], d = {cx, cy, iconS, iconS};
-                SDL_ScaleMode csm = (d.w < s.w || d.h < s.h)
-                                   ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_PIXELART;
-                SDL_BlitSurfaceScaled(coinSheet->GetSurface(), &s, screen, &d, csm);
-                DrawOutline(screen, d, {255,215,0,255});
+                SetScaleFor(coinTex, d, (float)s.w, (float)s.h);
+                SDL_FRect sf = ToF(s), df = ToF(d);
+                SDL_RenderTexture(mRen, coinTex, &sf, &df);
+                Outline(d, {255,215,0,255});
             }
     }
 
     // Enemies: render each enemy with its profile sprite if available,
-    // otherwise fall back to the generic slime sheet.
-    // Cache loaded profile data so we only parse JSON once per type per frame.
-    struct EnemyRenderInfo {
-        std::string previewPath;
-        int spriteW = 40, spriteH = 40;
-    };
-    static std::unordered_map<std::string, EnemyRenderInfo> sEnemyRenderCache;
-
+    // otherwise fall back to the generic slime sheet. Sizes and preview paths
+    // come from the editor's enemy-type cache, so nothing is read from disk here.
     std::vector<SDL_Rect> slimeFrames;
-    if (enemySheet)
+    SDL_Texture*          slimeTex = SheetTexture(enemySheet);
+    if (slimeTex)
         slimeFrames = enemySheet->GetAnimation("slimeWalk");
 
     for (const auto& en : level.enemies) {
@@ -615,21 +683,10 @@ void EditorCanvasRenderer::RenderEntities(SDL_Surface* screen, int canvasW, int
         int enW = 40, enH = 40;  // default slime size
         std::string previewImg;
 
-        if (!en.enemyType.empty()) {
-            auto cacheIt = sEnemyRenderCache.find(en.enemyType);
-            if (cacheIt != sEnemyRenderCache.end()) {
-                enW = cacheIt->second.spriteW;
-                enH = cacheIt->second.spriteH;
-                previewImg = cacheIt->second.previewPath;
-            } else {
-                EnemyProfile prof;
-                if (LoadEnemyProfile("enemies/" + en.enemyType + ".json", prof)) {
-                    enW = (prof.spriteW > 0) ? prof.spriteW : 40;
-                    enH = (prof.spriteH > 0) ? prof.spriteH : 40;
-                    previewImg = EnemyPreviewImagePath(prof);
-                    sEnemyRenderCache[en.enemyType] = {previewImg, enW, enH};
-                }
-            }
+        if (const auto* info = enemyTypes.Find(en.enemyType)) {
+            enW        = (info->spriteW > 0) ? info->spriteW : 40;
+            enH        = (info->spriteH > 0) ? info->spriteH : 40;
+            previewImg = info->previewPath;
         }
 
         int drawW = std::max(4, (int)(enW * zoom));
@@ -641,72 +698,67 @@ void EditorCanvasRenderer::RenderEntities(SDL_Surface* screen, int canvasW, int
         if (ex + drawW <= 0 || ex >= canvasW || ey + drawH <= toolbarH || ey >= winH)
             continue;
 
-        SDL_Rect d = {ex, ey, drawW, drawH};
-        bool rendered = false;
+        SDL_Rect  d        = {ex, ey, drawW, drawH};
+        SDL_FRect df       = ToF(d);
+        bool      rendered = false;
 
         // Try to render using the enemy's profile sprite
         if (!previewImg.empty()) {
-            SDL_Surface* thumb = cache.LoadAndCache(previewImg);
-            if (thumb) {
-                SDL_ScaleMode esm = (d.w < thumb->w || d.h < thumb->h)
-                                   ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_PIXELART;
-                SDL_BlitSurfaceScaled(thumb, nullptr, screen, &d, esm);
+            SDL_Surface* thumb = mCache->LoadAndCache(previewImg);
+            if (SDL_Texture* tex = SurfaceTexture(thumb)) {
+                SetScaleFor(tex, d, (float)thumb->w, (float)thumb->h);
+                SDL_RenderTexture(mRen, tex, nullptr, &df);
                 rendered = true;
             }
         }
 
         // Fallback: generic slime
-        if (!rendered && enemySheet && !slimeFrames.empty()) {
-            SDL_Rect s = slimeFrames[0];
-            SDL_ScaleMode esm = (d.w < s.w || d.h < s.h)
-                               ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_PIXELART;
-            SDL_BlitSurfaceScaled(enemySheet->GetSurface(), &s, screen, &d, esm);
+        if (!rendered && slimeTex && !slimeFrames.empty()) {
+            SDL_Rect  s  = slimeFrames[0];
+            SDL_FRect sf = ToF(s);
+            SetScaleFor(slimeTex, d, (float)s.w, (float)s.h);
+            SDL_RenderTexture(mRen, slimeTex, &sf, &df);
         }
 
         SDL_Color ec = en.antiGravity ? SDL_Color{0,220,220,255} : SDL_Color{255,80,80,255};
-        DrawOutline(screen, d, ec);
+        Outline(d, ec);
 
         // Speed + direction badge (bottom-left)
         {
             std::string dir = en.startLeft ? "<" : ">";
             std::string spdStr = dir + std::to_string((int)en.speed);
-            BlitBadge(screen, cache.GetBadge(spdStr, {255, 200, 120, 255}),
-                      ex + 2, ey + drawH - 12);
+            DrawBadge(spdStr, {255, 200, 120, 255}, ex + 2, ey + drawH - 12);
         }
 
         // Enemy type name badge (above sprite)
         if (!en.enemyType.empty()) {
             std::string typeName = en.enemyType;
             if ((int)typeName.size() > 8) typeName = typeName.substr(0, 6) + "..";
-            BlitBadge(screen, cache.GetBadge(typeName, {255, 160, 100, 255}),
-                      ex + 2, ey - 12);
+            DrawBadge(typeName, {255, 160, 100, 255}, ex + 2, ey - 12);
         }
 
         if (en.antiGravity) {
-            DrawRect(screen, {ex+drawW/2-4, ey-10, 8, 8}, {0,200,220,220});
-            Text fb("F", {255,255,255,255}, ex+drawW/2-3, ey-11, 8);
-            fb.RenderToSurface(screen);
+            FillRect({ex+drawW/2-4, ey-10, 8, 8}, {0,200,220,220});
+            DrawBadge("F", {255,255,255,255}, ex+drawW/2-3, ey-11);
         }
     }
 }
 
 // ── Player marker ─────────────────────────────────────────────────────────────
-void EditorCanvasRenderer::RenderPlayerMarker(SDL_Surface* screen, const Level& level,
-                                               const EditorCamera& cam)
+void EditorCanvasRenderer::RenderPlayerMarker(const Level& level, const EditorCamera& cam)
 {
     int pmx = (int)((level.player.x - cam.X()) * cam.Zoom());
     int pmy = (int)((level.player.y - cam.Y()) * cam.Zoom());
     int pmw = (int)(PLAYER_STAND_WIDTH  * cam.Zoom());
     int pmh = (int)(PLAYER_STAND_HEIGHT * cam.Zoom());
-    DrawRect(screen, {pmx, pmy, pmw, pmh}, {0, 200, 80, 180});
-    DrawOutline(screen, {pmx, pmy, pmw, pmh}, {0, 255, 100, 255}, 2);
+    FillRect({pmx, pmy, pmw, pmh}, {0, 200, 80, 180});
+    Outline({pmx, pmy, pmw, pmh}, {0, 255, 100, 255}, 2);
 }
 
 // ── Tile ghost (placement preview) ───────────────────────────────────────────
-void EditorCanvasRenderer::RenderGhost(SDL_Surface* screen, int canvasW, int toolbarH,
+void EditorCanvasRenderer::RenderGhost(int canvasW, int toolbarH,
                                         const EditorCamera& cam,
-                                        const EditorPalette& palette,
-                                        EditorSurfaceCache& cache, ToolId activeToolId,
+                                        const EditorPalette& palette, ToolId activeToolId,
                                         EditorTool* activeTool, int grid)
 {
     if (activeToolId != ToolId::Tile) return;
@@ -735,29 +787,30 @@ void EditorCanvasRenderer::RenderGhost(SDL_Surface* screen, int canvasW, int too
     int gsh = (int)(tileH * cam.Zoom());
     SDL_Rect ghostDst = {gsx, gsy, gsw, gsh};
 
-    SDL_Surface* ghostSurf = cache.FindTileSurface(selItem->path);
-    if (!ghostSurf) ghostSurf = selItem->full;
+    SDL_Surface* ghostSurf = mCache->LoadAndCache(selItem->path);
+    SDL_Texture* ghostTex = nullptr;
     if (ghostSurf) {
         SDL_Surface* drawSurf = (ghostRot != 0)
-            ? cache.GetRotated(selItem->path, ghostSurf, ghostRot)
+            ? mCache->GetRotated(selItem->path, ghostSurf, ghostRot)
             : ghostSurf;
         if (!drawSurf) drawSurf = ghostSurf;
-        SDL_SetSurfaceAlphaMod(drawSurf, 140);
-        SDL_ScaleMode gsm = (ghostDst.w < drawSurf->w || ghostDst.h < drawSurf->h)
-                          ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_PIXELART;
-        SDL_BlitSurfaceScaled(drawSurf, nullptr, screen, &ghostDst, gsm);
-        SDL_SetSurfaceAlphaMod(drawSurf, 255);
-    } else {
-        DrawRectAlpha(screen, ghostDst, {100, 180, 255, 60});
+        ghostTex = SurfaceTexture(drawSurf);
+        if (ghostTex) {
+            SDL_FRect d = ToF(ghostDst);
+            SDL_SetTextureAlphaMod(ghostTex, 140);
+            SetScaleFor(ghostTex, ghostDst, (float)drawSurf->w, (float)drawSurf->h);
+            SDL_RenderTexture(mRen, ghostTex, nullptr, &d);
+            SDL_SetTextureAlphaMod(ghostTex, 255);
+        }
     }
+    if (!ghostTex)
+        FillRect(ghostDst, {100, 180, 255, 60});
 
     if (ghostRot != 0) {
-        std::string  rb  = std::to_string(ghostRot) + "\xc2\xb0";
-        SDL_Surface* rbs = cache.GetBadge(rb, {255, 220, 80, 255});
-        if (rbs) {
-            SDL_Rect bd = {gsx + gsw - rbs->w - 3, gsy + 3, rbs->w, rbs->h};
-            SDL_BlitSurface(rbs, nullptr, screen, &bd);
-        }
+        std::string rb  = std::to_string(ghostRot) + "\xc2\xb0";
+        SDL_Point   rbs = BadgeSize(rb, {255, 220, 80, 255});
+        if (rbs.x > 0)
+            DrawBadge(rb, {255, 220, 80, 255}, gsx + gsw - rbs.x - 3, gsy + 3);
     }
-    DrawOutline(screen, ghostDst, {100, 180, 255, 200});
+    Outline(ghostDst, {100, 180, 255, 200});
 }
@@ -0,0 +1,33 @@
+#include "EditorDamage.hpp"
+
+void EditorDamage::Add(SDL_Rect r) {
+    if (r.w <= 0 || r.h <= 0)
+        return;
+    if (!mHasRect) {
+        mRect    = r;
+        mHasRect = true;
+        return;
+    }
+    SDL_GetRectUnion(&mRect, &r, &mRect);
+}
+
+void EditorDamage::Track(int screenW, int screenH, const EditorCamera& camera) {
+    if (screenW != mW || screenH != mH || camera.X() != mCamX || camera.Y() != mCamY ||
+        camera.Zoom() != mZoom)
+        mFull = true;
+    mW    = screenW;
+    mH    = screenH;
+    mCamX = camera.X();
+    mCamY = camera.Y();
+    mZoom = camera.Zoom();
+}
+
+SDL_Rect EditorDamage::Take() {
+    const SDL_Rect screen = {0, 0, mW, mH};
+    SDL_Rect       out    = screen;
+    if (!mFull && !SDL_GetRectIntersection(&mRect, &screen, &out))
+        out = {0, 0, 0, 0};
+    mFull    = false;
+    mHasRect = false;
+    return out;
+}
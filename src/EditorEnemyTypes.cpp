@@ -0,0 +1,50 @@
+#include "EditorEnemyTypes.hpp"
+#include "EnemyProfile.hpp"
+#include "ProfileCache.hpp"
+
+EditorEnemyTypes::Stamp EditorEnemyTypes::StampOf(const std::string& path) {
+    Stamp           s;
+    std::error_code ec;
+    s.mtime = std::filesystem::last_write_time(path, ec);
+    if (ec)
+        return {};
+    s.size   = std::filesystem::file_size(path, ec);
+    s.exists = true;
+    return s;
+}
+
+EditorEnemyTypes::Entry EditorEnemyTypes::Load(const std::string& type) {
+    const std::string path = EnemyProfilePath(type);
+    Entry             e;
+    e.stamp = StampOf(path);
+    if (!e.stamp.exists)
+        return e;
+    if (auto prof = GetEnemyProfile(path)) {
+        e.ok               = true;
+        e.info.spriteW     = prof->spriteW;
+        e.info.spriteH     = prof->spriteH;
+        e.info.speed       = prof->speed;
+        e.info.previewPath = EnemyPreviewImagePath(*prof);
+    }
+    return e;
+}
+
+const EditorEnemyTypes::Info* EditorEnemyTypes::Find(const std::string& type) {
+    if (type.empty())
+        return nullptr;
+    auto it = mEntries.find(type);
+    if (it == mEntries.end())
+        it = mEntries.emplace(type, Load(type)).first;
+    return it->second.ok ? &it->second.info : nullptr;
+}
+
+bool EditorEnemyTypes::Refresh() {
+    bool changed = false;
+    for (auto& [type, entry] : mEntries) {
+        if (StampOf(EnemyProfilePath(type)) == entry.stamp)
+            continue;
+        entry   = Load(type);
+        changed = true;
+    }
+    return changed;
+}
@@ -54,7 +54,7 @@ bool EditorFileOps::ImportPath(const std::string& srcPath, Ctx& ctx) {
             return false;
         }
         // Reload the tile view to the newly-created folder
-        ctx.palette.LoadTileView(baseDestDir.string(), ctx.level);
+        ctx.palette.LoadTileView(baseDestDir.string());
         ctx.setStatus("Imported \"" + src.filename().string() + "\" into " +
                       fs::path(ctx.palette.CurrentDir()).filename().string() + " (" +
                       std::to_string(count) + " files)");
@@ -120,7 +120,7 @@ bool EditorFileOps::ImportPath(const std::string& srcPath, Ctx& ctx) {
             SDL_DestroySurface(thumb);
         SDL_DestroySurface(full);
 
-        ctx.palette.LoadTileView(ctx.palette.CurrentDir(), ctx.level);
+        ctx.palette.LoadTileView(ctx.palette.CurrentDir());
         auto& items = ctx.palette.Items();
         for (int i = 0; i < (int)items.size(); i++) {
             if (items[i].path == dest.string()) {
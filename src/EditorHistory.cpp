@@ -0,0 +1,474 @@
+#include "EditorHistory.hpp"
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+namespace {
+// Steps closer together than this merge when both ask to coalesce.
+constexpr Uint64 COALESCE_WINDOW_MS = 1000;
+
+const std::string kEmpty;
+
+// Calls f(vec) on the entity vector for `kind`; the player has none.
+template <class F> void WithVector(Level& level, EditorHistory::Kind kind, F&& f) {
+    switch (kind) {
+        case EditorHistory::Kind::Tile:   f(level.tiles);   break;
+        case EditorHistory::Kind::Coin:   f(level.coins);   break;
+        case EditorHistory::Kind::Enemy:  f(level.enemies); break;
+        case EditorHistory::Kind::Player: break;
+    }
+}
+
+int CountOf(const Level& level, EditorHistory::Kind kind) {
+    switch (kind) {
+        case EditorHistory::Kind::Tile:   return (int)level.tiles.size();
+        case EditorHistory::Kind::Coin:   return (int)level.coins.size();
+        case EditorHistory::Kind::Enemy:  return (int)level.enemies.size();
+        case EditorHistory::Kind::Player: return 0;
+    }
+    return 0;
+}
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Entity access
+// ─────────────────────────────────────────────────────────────────────────────
+std::uint64_t EditorHistory::PendingKey(Kind kind, int index) {
+    return (static_cast<std::uint64_t>(kind) << 32) | static_cast<std::uint32_t>(index);
+}
+
+EditorHistory::Entity EditorHistory::Read(const Level& level, Kind kind, int index) {
+    switch (kind) {
+        case Kind::Tile:   return level.tiles[index];
+        case Kind::Coin:   return level.coins[index];
+        case Kind::Enemy:  return level.enemies[index];
+        case Kind::Player: return level.player;
+    }
+    return level.player;
+}
+
+void EditorHistory::Write(Level& level, Kind kind, int index, const Entity& e) {
+    switch (kind) {
+        case Kind::Tile:   level.tiles[index]   = std::get<TileSpawn>(e);   break;
+        case Kind::Coin:   level.coins[index]   = std::get<CoinSpawn>(e);   break;
+        case Kind::Enemy:  level.enemies[index] = std::get<EnemySpawn>(e);  break;
+        case Kind::Player: level.player         = std::get<PlayerSpawn>(e); break;
+    }
+}
+
+void EditorHistory::InsertAt(Level& level, Kind kind, int index, const Entity& e) {
+    switch (kind) {
+        case Kind::Tile:
+            level.tiles.insert(level.tiles.begin() + index, std::get<TileSpawn>(e));
+            break;
+        case Kind::Coin:
+            level.coins.insert(level.coins.begin() + index, std::get<CoinSpawn>(e));
+            break;
+        case Kind::Enemy:
+            level.enemies.insert(level.enemies.begin() + index, std::get<EnemySpawn>(e));
+            break;
+        case Kind::Player: break;
+    }
+}
+
+void EditorHistory::EraseAt(Level& level, Kind kind, int index) {
+    switch (kind) {
+        case Kind::Tile:   level.tiles.erase(level.tiles.begin() + index);     break;
+        case Kind::Coin:   level.coins.erase(level.coins.begin() + index);     break;
+        case Kind::Enemy:  level.enemies.erase(level.enemies.begin() + index); break;
+        case Kind::Player: break;
+    }
+}
+
+void EditorHistory::InsertRange(Level& level, Kind kind, int index, const Batch& b) {
+    WithVector(level, kind, [&](auto& v) {
+        using T = typename std::decay_t<decltype(v)>::value_type;
+        std::vector<T> items;
+        items.reserve(b.entities.size());
+        for (const auto& e : b.entities)
+            items.push_back(std::get<T>(e));
+        v.insert(v.begin() + index, std::make_move_iterator(items.begin()),
+                 std::make_move_iterator(items.end()));
+    });
+}
+
+void EditorHistory::EraseRange(Level& level, Kind kind, int index, int count) {
+    WithVector(level, kind,
+               [&](auto& v) { v.erase(v.begin() + index, v.begin() + index + count); });
+}
+
+// Merge pass: rebuilds the vector once with the erased entities back at their
+// original (ascending) indices.
+void EditorHistory::InsertSet(Level& level, Kind kind, const Batch& b) {
+    WithVector(level, kind, [&](auto& v) {
+        using T        = typename std::decay_t<decltype(v)>::value_type;
+        const size_t n = v.size() + b.indices.size();
+        std::vector<T> out;
+        out.reserve(n);
+        size_t k = 0, r = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (k < b.indices.size() && b.indices[k] == (int)i)
+                out.push_back(std::get<T>(b.entities[k++]));
+            else
+                out.push_back(std::move(v[r++]));
+        }
+        v = std::move(out);
+    });
+}
+
+// Compaction pass: survivors slide down over the erased (ascending) indices.
+void EditorHistory::EraseSet(Level& level, Kind kind, const std::vector<int>& indices) {
+    if (indices.empty())
+        return;
+    WithVector(level, kind, [&](auto& v) {
+        size_t w = (size_t)indices.front(), k = 0;
+        for (size_t r = w; r < v.size(); ++r) {
+            if (k < indices.size() && indices[k] == (int)r) {
+                ++k;
+                continue;
+            }
+            v[w++] = std::move(v[r]);
+        }
+        v.erase(v.begin() + w, v.end());
+    });
+}
+
+void EditorHistory::SetPos(Level& level, Kind kind, int index, SDL_FPoint p) {
+    float* x = nullptr;
+    float* y = nullptr;
+    switch (kind) {
+        case Kind::Tile:   x = &level.tiles[index].x;   y = &level.tiles[index].y;   break;
+        case Kind::Coin:   x = &level.coins[index].x;   y = &level.coins[index].y;   break;
+        case Kind::Enemy:  x = &level.enemies[index].x; y = &level.enemies[index].y; break;
+        case Kind::Player: x = &level.player.x;         y = &level.player.y;         break;
+    }
+    *x = p.x;
+    *y = p.y;
+}
+
+SDL_FPoint EditorHistory::PosOf(const Entity& e) {
+    return std::visit([](const auto& v) { return SDL_FPoint{v.x, v.y}; }, e);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Size accounting
+// ─────────────────────────────────────────────────────────────────────────────
+std::size_t EditorHistory::EntityBytes(const Entity& e) {
+    std::size_t n = sizeof(Entity);
+    if (const auto* t = std::get_if<TileSpawn>(&e)) {
+        n += t->imagePath.capacity();
+        if (t->action)
+            n += t->action->destroyAnimPath.capacity();
+        if (t->powerUp)
+            n += t->powerUp->type.capacity();
+    } else if (const auto* en = std::get_if<EnemySpawn>(&e)) {
+        n += en->enemyType.capacity();
+    }
+    return n;
+}
+
+std::size_t EditorHistory::CommandBytes(const Command& c) {
+    std::size_t n = sizeof(Command) + c.label.capacity() + c.ops.capacity() * sizeof(Op);
+    for (const auto& op : c.ops) {
+        if (op.before)
+            n += EntityBytes(*op.before);
+        if (op.after)
+            n += EntityBytes(*op.after);
+        if (op.batch) {
+            n += sizeof(Batch) + op.batch->indices.capacity() * sizeof(int);
+            for (const auto& e : op.batch->entities)
+                n += EntityBytes(e);
+        }
+    }
+    return n;
+}
+
+bool EditorHistory::InPlaceOnly(const Command& c) {
+    return std::all_of(c.ops.begin(), c.ops.end(), [](const Op& op) {
+        return op.type == OpType::Modify || op.type == OpType::Move;
+    });
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Recording
+// ─────────────────────────────────────────────────────────────────────────────
+void EditorHistory::Begin(const std::string& label, bool coalesce) {
+    if (mOpen)
+        return;
+    mOpen.emplace();
+    mOpen->cmd.label    = label;
+    mOpen->cmd.coalesce = coalesce;
+}
+
+// Every recording call comes through here: the level is about to change.
+EditorHistory::Open& EditorHistory::Ensure() {
+    ++mEdits;
+    if (!mOpen)
+        Begin("Edit");
+    return *mOpen;
+}
+
+void EditorHistory::Touch(const Level& level, Kind kind, int index) {
+    Open& open = Ensure();
+    if (open.pending.count(PendingKey(kind, index)))
+        return; // already captured "before" for this entity in this step
+
+    Op op;
+    op.type    = OpType::Modify;
+    op.kind    = kind;
+    op.index   = index;
+    op.pending = true;
+    op.before  = std::make_unique<Entity>(Read(level, kind, index));
+    open.pending[PendingKey(kind, index)] = (int)open.cmd.ops.size();
+    open.cmd.ops.push_back(std::move(op));
+}
+
+void EditorHistory::Erasing(const Level& level, Kind kind, int index) {
+    Open& open = Ensure();
+    // Indices of pending ops are only valid up to this structural change.
+    FinalizeKind(level, kind);
+
+    Op op;
+    op.type   = OpType::Erase;
+    op.kind   = kind;
+    op.index  = index;
+    op.before = std::make_unique<Entity>(Read(level, kind, index));
+    open.cmd.ops.push_back(std::move(op));
+}
+
+void EditorHistory::Appended(const Level& level, Kind kind) {
+    Open& open = Ensure();
+    FinalizeKind(level, kind);
+
+    int count = 0;
+    switch (kind) {
+        case Kind::Tile:   count = (int)level.tiles.size();   break;
+        case Kind::Coin:   count = (int)level.coins.size();   break;
+        case Kind::Enemy:  count = (int)level.enemies.size(); break;
+        case Kind::Player: return;
+    }
+    Op op;
+    op.type    = OpType::Insert;
+    op.kind    = kind;
+    op.index   = count - 1;
+    op.pending = true; // value read at commit, after any follow-up edits
+    open.pending[PendingKey(kind, op.index)] = (int)open.cmd.ops.size();
+    open.cmd.ops.push_back(std::move(op));
+}
+
+// Batches are captured immediately rather than at commit: a pending op per
+// entity would cost as much as the per-entity recording this replaces.
+void EditorHistory::AppendedRange(const Level& level, Kind kind, int first) {
+    const int count = CountOf(level, kind);
+    if (kind == Kind::Player || first >= count)
+        return;
+    Open& open = Ensure();
+    FinalizeKind(level, kind);
+
+    Op op;
+    op.type  = OpType::InsertRange;
+    op.kind  = kind;
+    op.index = first;
+    op.batch = std::make_unique<Batch>();
+    op.batch->entities.reserve(count - first);
+    for (int i = first; i < count; ++i)
+        op.batch->entities.push_back(Read(level, kind, i));
+    open.cmd.ops.push_back(std::move(op));
+}
+
+void EditorHistory::ErasingMany(const Level& level, Kind kind,
+                                const std::vector<int>& indices) {
+    if (kind == Kind::Player || indices.empty())
+        return;
+    Open& open = Ensure();
+    FinalizeKind(level, kind);
+
+    Op op;
+    op.type           = OpType::EraseSet;
+    op.kind           = kind;
+    op.index          = indices.front();
+    op.batch          = std::make_unique<Batch>();
+    op.batch->indices = indices;
+    op.batch->entities.reserve(indices.size());
+    for (int i : indices)
+        op.batch->entities.push_back(Read(level, kind, i));
+    open.cmd.ops.push_back(std::move(op));
+}
+
+void EditorHistory::Finalize(const Level& level, Op& op) {
+    op.pending = false;
+    if (op.type == OpType::Insert) {
+        op.after = std::make_unique<Entity>(Read(level, op.kind, op.index));
+        return;
+    }
+    // Modify: drop no-ops, shrink position-only edits to a Move.
+    Entity now = Read(level, op.kind, op.index);
+    if (now == *op.before) {
+        op.dead = true;
+        op.before.reset();
+        return;
+    }
+    Entity moved = *op.before;
+    std::visit([&](auto& v) {
+        SDL_FPoint p = PosOf(now);
+        v.x          = p.x;
+        v.y          = p.y;
+    }, moved);
+    if (moved == now) {
+        op.type = OpType::Move;
+        op.from = PosOf(*op.before);
+        op.to   = PosOf(now);
+        op.before.reset();
+        return;
+    }
+    op.after = std::make_unique<Entity>(std::move(now));
+}
+
+void EditorHistory::FinalizeKind(const Level& level, Kind kind) {
+    if (!mOpen)
+        return;
+    for (auto it = mOpen->pending.begin(); it != mOpen->pending.end();) {
+        Op& op = mOpen->cmd.ops[it->second];
+        if (op.kind == kind) {
+            Finalize(level, op);
+            it = mOpen->pending.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void EditorHistory::Commit(const Level& level) {
+    if (!mOpen)
+        return;
+    Command cmd = std::move(mOpen->cmd);
+    for (auto& [key, idx] : mOpen->pending)
+        Finalize(level, cmd.ops[idx]);
+    mOpen.reset();
+
+    std::erase_if(cmd.ops, [](const Op& op) { return op.dead; });
+    if (cmd.ops.empty())
+        return;
+    cmd.ops.shrink_to_fit();
+    cmd.timeMs = SDL_GetTicks();
+
+    // Any new edit forks history: the redo branch is gone.
+    for (const auto& r : mRedo)
+        mBytes -= r.bytes;
+    mRedo.clear();
+
+    if (MergeIntoTop(cmd))
+        return;
+    Push(std::move(cmd));
+}
+
+bool EditorHistory::MergeIntoTop(Command& cmd) {
+    if (!cmd.coalesce || mUndo.empty())
+        return false;
+    Command& top = mUndo.back();
+    if (!top.coalesce || top.label != cmd.label ||
+        cmd.timeMs - top.timeMs > COALESCE_WINDOW_MS || !InPlaceOnly(top) ||
+        !InPlaceOnly(cmd))
+        return false;
+
+    for (auto& op : cmd.ops) {
+        // Latest op on the same entity in the previous step.
+        auto it = std::find_if(top.ops.rbegin(), top.ops.rend(), [&](const Op& o) {
+            return o.kind == op.kind && o.index == op.index;
+        });
+        if (it != top.ops.rend() && it->type == op.type) {
+            if (op.type == OpType::Move)
+                it->to = op.to;
+            else
+                it->after = std::move(op.after);
+        } else {
+            top.ops.push_back(std::move(op));
+        }
+    }
+    mBytes -= top.bytes;
+    top.bytes  = CommandBytes(top);
+    top.timeMs = cmd.timeMs;
+    mBytes += top.bytes;
+    Trim();
+    return true;
+}
+
+void EditorHistory::Push(Command&& cmd) {
+    cmd.bytes = CommandBytes(cmd);
+    mBytes += cmd.bytes;
+    mUndo.push_back(std::move(cmd));
+    Trim();
+}
+
+void EditorHistory::Trim() {
+    // Always keep the newest step, however large.
+    while (mBytes > mBudget && mUndo.size() > 1) {
+        mBytes -= mUndo.front().bytes;
+        mUndo.pop_front();
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Undo / redo
+// ─────────────────────────────────────────────────────────────────────────────
+bool EditorHistory::Undo(Level& level) {
+    Commit(level);
+    if (mUndo.empty())
+        return false;
+    Command cmd = std::move(mUndo.back());
+    mUndo.pop_back();
+
+    for (auto it = cmd.ops.rbegin(); it != cmd.ops.rend(); ++it) {
+        const Op& op = *it;
+        switch (op.type) {
+            case OpType::Modify: Write(level, op.kind, op.index, *op.before);    break;
+            case OpType::Move:   SetPos(level, op.kind, op.index, op.from);      break;
+            case OpType::Insert: EraseAt(level, op.kind, op.index);              break;
+            case OpType::Erase:  InsertAt(level, op.kind, op.index, *op.before); break;
+            case OpType::InsertRange:
+                EraseRange(level, op.kind, op.index, (int)op.batch->entities.size());
+                break;
+            case OpType::EraseSet: InsertSet(level, op.kind, *op.batch); break;
+        }
+    }
+    mRedo.push_back(std::move(cmd));
+    ++mEdits;
+    return true;
+}
+
+bool EditorHistory::Redo(Level& level) {
+    Commit(level);
+    if (mRedo.empty())
+        return false;
+    Command cmd = std::move(mRedo.back());
+    mRedo.pop_back();
+
+    for (const Op& op : cmd.ops) {
+        switch (op.type) {
+            case OpType::Modify: Write(level, op.kind, op.index, *op.after);    break;
+            case OpType::Move:   SetPos(level, op.kind, op.index, op.to);       break;
+            case OpType::Insert: InsertAt(level, op.kind, op.index, *op.after); break;
+            case OpType::Erase:  EraseAt(level, op.kind, op.index);             break;
+            case OpType::InsertRange: InsertRange(level, op.kind, op.index, *op.batch); break;
+            case OpType::EraseSet:    EraseSet(level, op.kind, op.batch->indices);      break;
+        }
+    }
+    mUndo.push_back(std::move(cmd));
+    ++mEdits;
+    return true;
+}
+
+const std::string& EditorHistory::UndoLabel() const {
+    return mUndo.empty() ? kEmpty : mUndo.back().label;
+}
+
+const std::string& EditorHistory::RedoLabel() const {
+    return mRedo.empty() ? kEmpty : mRedo.back().label;
+}
+
+void EditorHistory::Clear() {
+    mOpen.reset();
+    mUndo.clear();
+    mRedo.clear();
+    mBytes = 0;
+}
@@ -1,12 +1,9 @@
 #include "EditorPalette.hpp"
 #include "AnimatedTile.hpp"
-#include "EditorSurfaceCache.hpp"
+#include "EditorThumbLoader.hpp"
 #include "LevelData.hpp"
 #include "Text.hpp"
-#include <SDL3_image/SDL_image.h>
 #include <algorithm>
-#include <print>
-#include <unordered_map>
 
 namespace fs = std::filesystem;
 
@@ -19,24 +16,24 @@ EditorPalette::~EditorPalette() {
 }
 
 void EditorPalette::Clear() {
+    mThumbs.reset(); // joins the worker; finished-but-undrained thumbs are freed
     FreeTileItems();
     FreeBgItems();
     mCellLabels.clear();
 }
 
 void EditorPalette::FreeTileItems() {
-    for (auto& item : mPaletteItems) {
-        if (!item.isFolder) {
-            if (item.thumb)
-                SDL_DestroySurface(item.thumb);
-            if (item.full)
-                SDL_DestroySurface(item.full);
-        }
-    }
+    if (mThumbs)
+        mThumbs->Cancel(THUMBS_TILES);
+    for (auto& item : mPaletteItems)
+        if (!item.isFolder && item.thumb)
+            SDL_DestroySurface(item.thumb);
     mPaletteItems.clear();
 }
 
 void EditorPalette::FreeBgItems() {
+    if (mThumbs)
+        mThumbs->Cancel(THUMBS_BG);
     for (auto& item : mBgItems)
         if (item.thumb)
             SDL_DestroySurface(item.thumb);
@@ -47,9 +44,40 @@ void EditorPalette::FreeBgItems() {
 // Initialization
 // ═══════════════════════════════════════════════════════════════════════════════
 
-void EditorPalette::Init(EditorSurfaceCache& cache, SDL_Surface* folderIcon) {
-    mCache      = &cache;
+void EditorPalette::Init(SDL_Surface* folderIcon) {
     mFolderIcon = folderIcon;
+    if (!mThumbs)
+        mThumbs = std::make_unique<EditorThumbLoader>();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Thumbnails
+// ═══════════════════════════════════════════════════════════════════════════════
+
+bool EditorPalette::PumpThumbnails() {
+    if (!mThumbs)
+        return false;
+    bool changed = false;
+    for (const auto& done : mThumbs->Drain()) {
+        SDL_Surface** slot    = nullptr;
+        bool*         pending = nullptr;
+        if (done.channel == THUMBS_TILES && done.slot < (int)mPaletteItems.size()) {
+            slot    = &mPaletteItems[done.slot].thumb;
+            pending = &mPaletteItems[done.slot].thumbPending;
+        } else if (done.channel == THUMBS_BG && done.slot < (int)mBgItems.size()) {
+            slot    = &mBgItems[done.slot].thumb;
+            pending = &mBgItems[done.slot].thumbPending;
+        }
+        if (!slot || !*pending) {
+            if (done.thumb)
+                SDL_DestroySurface(done.thumb);
+            continue;
+        }
+        *slot    = done.thumb;
+        *pending = false;
+        changed  = true;
+    }
+    return changed;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -62,7 +90,7 @@ const EditorPalette::PaletteItem* EditorPalette::SelectedItem() const {
     return &mPaletteItems[mSelectedTile];
 }
 
-void EditorPalette::LoadTileView(const std::string& dir, const Level& level) {
+void EditorPalette::LoadTileView(const std::string& dir) {
     FreeTileItems();
     mPaletteScroll  = 0;
     mSelectedTile   = 0;
@@ -81,7 +109,6 @@ void EditorPalette::LoadTileView(const std::string& dir, const Level& level) {
         back.label    = "\xe2\x97\x80 Back"; // UTF-8 for "◀ Back" without literal Unicode
         back.isFolder = true;
         back.thumb    = mFolderIcon;
-        back.full     = nullptr;
         mPaletteItems.push_back(std::move(back));
     }
 
@@ -97,7 +124,6 @@ void EditorPalette::LoadTileView(const std::string& dir, const Level& level) {
             anim.label    = "Animated Tiles (" + std::to_string(count) + ")";
             anim.isFolder = true;
             anim.thumb    = mFolderIcon;
-            anim.full     = nullptr;
             mPaletteItems.push_back(std::move(anim));
         }
     }
@@ -131,68 +157,42 @@ void EditorPalette::LoadTileView(const std::string& dir, const Level& level) {
         item.label    = p.filename().string() + " (" + std::to_string(count) + ")";
         item.isFolder = true;
         item.thumb    = mFolderIcon;
-        item.full     = nullptr;
         mPaletteItems.push_back(std::move(item));
     }
 
-    // Then individual PNG files
+    // Then individual PNG files — listed now, thumbnails requested below
     for (const auto& p : files) {
-        SDL_Surface* full = EditorSurfaceCache::LoadPNG(p);
-        if (!full)
-            continue;
-        SDL_SetSurfaceBlendMode(full, SDL_BLENDMODE_BLEND);
-        SDL_Surface* thumb = EditorSurfaceCache::MakeThumb(full, PAL_ICON, PAL_ICON);
-
         PaletteItem item;
         item.path     = p.string();
         item.label    = p.stem().string();
         item.isFolder = false;
-        item.thumb    = thumb;
-        item.full     = full;
         mPaletteItems.push_back(std::move(item));
     }
 
     // ── Animated tile manifests (inside ANIMATED_TILE_DIR) ───────────────────
+    // The manifest itself is small; only the frame decode is deferred.
     for (const auto& p : manifests) {
         AnimatedTileDef def;
         if (!LoadAnimatedTileDef(p.string(), def) || def.framePaths.empty())
             continue;
 
-        SDL_Surface* firstFrame = nullptr;
-        SDL_Surface* thumb      = nullptr;
-        for (const auto& fp : def.framePaths) {
-            SDL_Surface* raw = IMG_Load(fp.c_str());
-            if (!raw)
-                continue;
-            firstFrame = SDL_ConvertSurface(raw, SDL_PIXELFORMAT_ARGB8888);
-            SDL_DestroySurface(raw);
-            if (firstFrame) {
-                SDL_SetSurfaceBlendMode(firstFrame, SDL_BLENDMODE_BLEND);
-                break;
-            }
-        }
-        if (firstFrame) {
-            thumb = EditorSurfaceCache::MakeThumb(firstFrame, PAL_ICON, PAL_ICON);
-            SDL_DestroySurface(firstFrame);
-        }
-
         PaletteItem item;
         item.path     = p.string();
         item.label    = def.name + " [~" + std::to_string(def.framePaths.size()) + "f]";
         item.isFolder = false;
-        item.thumb    = thumb;
-        item.full     = thumb ? SDL_DuplicateSurface(thumb) : nullptr;
         mPaletteItems.push_back(std::move(item));
     }
 
-    // ── Rebuild path->surface cache ─────────────────────────────────────────
-    mCache->ClearTileSurfaceCache();
-    for (const auto& item : mPaletteItems)
-        if (!item.isFolder && item.full)
-            mCache->InsertTileSurface(item.path, item.full);
-
-    // ── Seed cache for level tiles from other directories ───────────────────
-    SeedCacheForLevel(level);
+    // ── Queue thumbnails in display order, so the first screenful lands first
+    for (int i = 0; i < (int)mPaletteItems.size(); ++i) {
+        auto& item = mPaletteItems[i];
+        if (item.isFolder)
+            continue;
+        auto src = IsAnimatedTile(item.path) ? EditorThumbLoader::Source::AnimatedTile
+                                             : EditorThumbLoader::Source::Image;
+        mThumbs->Request(THUMBS_TILES, i, item.path, src, PAL_ICON, PAL_ICON);
+        item.thumbPending = true;
+    }
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -216,15 +216,14 @@ void EditorPalette::LoadBgPalette(const Level& level) {
     const int thumbH = thumbW / 2;
 
     for (const auto& p : paths) {
-        SDL_Surface* full = EditorSurfaceCache::LoadPNG(p);
-        if (!full)
-            continue;
-        SDL_Surface* thumb = EditorSurfaceCache::MakeThumb(full, thumbW, thumbH);
-        SDL_DestroySurface(full);
-        mBgItems.push_back({p.string(), p.stem().string(), thumb});
+        int slot = static_cast<int>(mBgItems.size());
+        mThumbs->Request(THUMBS_BG, slot, p.string(), EditorThumbLoader::Source::Image,
+                         thumbW, thumbH);
+        mBgItems.push_back({p.string(), p.stem().string(), nullptr});
+        mBgItems.back().thumbPending = true;
 
         if (p.string() == level.background)
-            mSelectedBg = static_cast<int>(mBgItems.size()) - 1;
+            mSelectedBg = slot;
     }
 }
 
@@ -248,97 +247,3 @@ bool EditorPalette::CheckDoubleClick(int index) {
     mLastClickIndex = index;
     return isDbl;
 }
-
-// ═══════════════════════════════════════════════════════════════════════════════
-// Cache seeding — ensures every tile in the level has a renderable surface
-// ═══════════════════════════════════════════════════════════════════════════════
-
-void EditorPalette::SeedCacheForLevel(const Level& level) {
-    // Deduplicate: collect unique (path -> first seen w,h,animated) tuples
-    struct TileLoad {
-        std::string path;
-        int         w;
-        int         h;
-        bool        animated;
-    };
-    std::unordered_map<std::string, TileLoad> needed;
-    for (const auto& ts : level.tiles) {
-        if (ts.imagePath.empty() || mCache->HasTileSurface(ts.imagePath))
-            continue;
-        if (!needed.contains(ts.imagePath))
-            needed[ts.imagePath] = {ts.imagePath, ts.w, ts.h, IsAnimatedTile(ts.imagePath)};
-    }
-
-    for (auto& [path, info] : needed) {
-        if (info.animated) {
-            SeedAnimatedTile(info.path, info.w, info.h);
-        } else {
-            SeedStaticTile(info.path, info.w, info.h);
-        }
-    }
-}
-
-void EditorPalette::SeedAnimatedTile(const std::string& path, int w, int h) {
-    AnimatedTileDef def;
-    if (!LoadAnimatedTileDef(path, def) || def.framePaths.empty())
-        return;
-
-    SDL_Surface* firstFrame = nullptr;
-    for (const auto& fp : def.framePaths) {
-        SDL_Surface* raw = IMG_Load(fp.c_str());
-        if (!raw)
-            continue;
-        firstFrame = SDL_ConvertSurface(raw, SDL_PIXELFORMAT_ARGB8888);
-        SDL_DestroySurface(raw);
-        if (firstFrame) {
-            SDL_SetSurfaceBlendMode(firstFrame, SDL_BLENDMODE_BLEND);
-            break;
-        }
-    }
-    if (!firstFrame)
-        return;
-
-    SDL_Surface* scaled = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_ARGB8888);
-    if (scaled) {
-        SDL_SetSurfaceBlendMode(firstFrame, SDL_BLENDMODE_NONE);
-        SDL_ScaleMode sm = (w < firstFrame->w || h < firstFrame->h)
-                         ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_PIXELART;
-        SDL_BlitSurfaceScaled(firstFrame, nullptr, scaled, nullptr, sm);
-        SDL_SetSurfaceBlendMode(scaled, SDL_BLENDMODE_BLEND);
-    }
-    SDL_DestroySurface(firstFrame);
-    if (!scaled)
-        return;
-
-    mCache->InsertTileSurface(path, scaled);
-    mCache->AddExtraTileSurface(scaled);
-}
-
-void EditorPalette::SeedStaticTile(const std::string& path, int w, int h) {
-    SDL_Surface* raw = IMG_Load(path.c_str());
-    if (!raw)
-        return;
-    SDL_Surface* conv = SDL_ConvertSurface(raw, SDL_PIXELFORMAT_ARGB8888);
-    SDL_DestroySurface(raw);
-    if (!conv)
-        return;
-
-    SDL_Surface* result = conv;
-    if (conv->w != w || conv->h != h) {
-        SDL_Surface* scaled = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_ARGB8888);
-        if (scaled) {
-            SDL_SetSurfaceBlendMode(conv, SDL_BLENDMODE_NONE);
-            SDL_ScaleMode sm = (w < conv->w || h < conv->h)
-                             ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_PIXELART;
-            SDL_BlitSurfaceScaled(conv, nullptr, scaled, nullptr, sm);
-            SDL_SetSurfaceBlendMode(scaled, SDL_BLENDMODE_BLEND);
-            SDL_DestroySurface(conv);
-            result = scaled;
-        }
-    } else {
-        SDL_SetSurfaceBlendMode(conv, SDL_BLENDMODE_BLEND);
-    }
-
-    mCache->InsertTileSurface(path, result);
-    mCache->AddExtraTileSurface(result);
-}
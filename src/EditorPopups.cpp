@@ -12,6 +12,15 @@ static bool HitTest(const SDL_Rect& r, int x, int y) {
     return x >= r.x && x <= r.x + r.w && y >= r.y && y <= r.y + r.h;
 }
 
+static void TouchTile(EditorPopups::Ctx& ctx, int idx) {
+    ctx.history.Touch(ctx.level, EditorHistory::Kind::Tile, idx);
+}
+
+static void TouchTiles(EditorPopups::Ctx& ctx, const std::vector<int>& indices) {
+    for (int idx : indices)
+        TouchTile(ctx, idx);
+}
+
 // ─── OpenDeleteConfirm ────────────────────────────────────────────────────────
 void EditorPopups::OpenDeleteConfirm(const std::string& path, bool isDir,
                                      const std::string& name) {
@@ -219,6 +228,7 @@ bool EditorPopups::HandleAnimPickerEvent(const SDL_Event& e, Ctx& ctx) {
             const auto& entry = animPickerEntries[i];
             // Write back through the level reference
             if (animPickerTile < (int)ctx.level.tiles.size()) {
+                TouchTile(ctx, animPickerTile);
                 ctx.level.tiles[animPickerTile].action->destroyAnimPath = entry.path;
                 if (!entry.path.empty())
                     ctx.getAnimThumb(entry.path); // warm the cache
@@ -259,6 +269,7 @@ bool EditorPopups::HandlePowerUpPickerEvent(const SDL_Event& e, Ctx& ctx) {
         SDL_Rect row = {powerUpRect.x + PAD, py + i * (ROW_H + 2),
                         powerUpRect.w - PAD * 2, ROW_H};
         if (HitTest(row, mx, my)) {
+            TouchTile(ctx, powerUpTileIdx);
             auto& t           = ctx.level.tiles[powerUpTileIdx];
             t.powerUp         = PowerUpData{reg[i].id, reg[i].defaultDuration};
             ctx.setStatus("Tile " + std::to_string(powerUpTileIdx) +
@@ -273,6 +284,7 @@ bool EditorPopups::HandlePowerUpPickerEvent(const SDL_Event& e, Ctx& ctx) {
                         py + (int)reg.size() * (ROW_H + 2),
                         powerUpRect.w - PAD * 2, ROW_H};
     if (HitTest(noneRow, mx, my)) {
+        TouchTile(ctx, powerUpTileIdx);
         ctx.level.tiles[powerUpTileIdx].powerUp.reset();
         ctx.setStatus("Tile " + std::to_string(powerUpTileIdx) + " -> PowerUp removed");
         ClosePowerUpPicker();
@@ -350,12 +362,14 @@ bool EditorPopups::HandleMovPlatPopupEvent(const SDL_Event& e, Ctx& ctx,
     SDL_Rect btnV = {px + PAD + 90 + 54, ry, 48, ROW_H - 4};
     if (HitTest(btnH, mx, my)) {
         movPlatHoriz = true;
+        TouchTiles(ctx, movPlatIndices);
         for (int idx : movPlatIndices)
             ctx.level.tiles[idx].moving->horiz = true;
         return true;
     }
     if (HitTest(btnV, mx, my)) {
         movPlatHoriz = false;
+        TouchTiles(ctx, movPlatIndices);
         for (int idx : movPlatIndices)
             ctx.level.tiles[idx].moving->horiz = false;
         return true;
@@ -368,6 +382,7 @@ bool EditorPopups::HandleMovPlatPopupEvent(const SDL_Event& e, Ctx& ctx,
         movPlatLoop = !movPlatLoop;
         if (!movPlatLoop)
             movPlatTrigger = false;
+        TouchTiles(ctx, movPlatIndices);
         for (int idx : movPlatIndices) {
             ctx.level.tiles[idx].moving->loop    = movPlatLoop;
             ctx.level.tiles[idx].moving->trigger = movPlatTrigger;
@@ -380,6 +395,7 @@ bool EditorPopups::HandleMovPlatPopupEvent(const SDL_Event& e, Ctx& ctx,
     SDL_Rect trigRow = {px + PAD, ry, PW - PAD * 2, ROW_H};
     if (HitTest(trigRow, mx, my)) {
         movPlatTrigger = !movPlatTrigger;
+        TouchTiles(ctx, movPlatIndices);
         for (int idx : movPlatIndices)
             ctx.level.tiles[idx].moving->trigger = movPlatTrigger;
         return true;
@@ -398,6 +414,7 @@ void EditorPopups::CommitSpeedField(Ctx& ctx, std::vector<int>& movPlatIndices)
     movPlatSpeedStr = std::to_string(v);
 
     // Apply to current session tiles
+    TouchTiles(ctx, movPlatIndices);
     for (int idx : movPlatIndices)
         ctx.level.tiles[idx].moving->speed = movPlatSpeed;
 
@@ -409,7 +426,9 @@ void EditorPopups::CommitSpeedField(Ctx& ctx, std::vector<int>& movPlatIndices)
             (movPlatGroupId != 0 && t.moving->groupId == movPlatGroupId) ||
             std::any_of(movPlatIndices.begin(), movPlatIndices.end(),
                         [&](int i) { return &t == &ctx.level.tiles[i]; });
-        if (inGroup)
+        if (inGroup) {
+            TouchTile(ctx, (int)(&t - ctx.level.tiles.data()));
             t.moving->speed = movPlatSpeed;
+        }
     }
 }
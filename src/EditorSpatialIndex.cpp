@@ -0,0 +1,143 @@
+#include "EditorSpatialIndex.hpp"
+#include <algorithm>
+
+namespace {
+// Inclusive-edge point test, same as EditorToolContext::HitTest.
+bool Contains(const SDL_Rect& r, int x, int y) {
+    return x >= r.x && x <= r.x + r.w && y >= r.y && y <= r.y + r.h;
+}
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Build
+// ─────────────────────────────────────────────────────────────────────────────
+int EditorSpatialIndex::CellOf(int v) {
+    // Floor division so negative world coordinates land in the right cell.
+    return (v >= 0) ? v / CELL : -((-v + CELL - 1) / CELL);
+}
+
+std::int64_t EditorSpatialIndex::Key(int cx, int cy) {
+    return (static_cast<std::int64_t>(cx) << 32) ^ static_cast<std::uint32_t>(cy);
+}
+
+void EditorSpatialIndex::Insert(Layer& layer, int idx, SDL_Rect r) {
+    layer.rects.push_back(r);
+    const int cx0 = CellOf(r.x), cx1 = CellOf(r.x + std::max(0, r.w));
+    const int cy0 = CellOf(r.y), cy1 = CellOf(r.y + std::max(0, r.h));
+    for (int cy = cy0; cy <= cy1; ++cy)
+        for (int cx = cx0; cx <= cx1; ++cx)
+            layer.cells[Key(cx, cy)].push_back(idx);
+}
+
+void EditorSpatialIndex::Sync(const Level& level, int grid) {
+    if (!mDirty && mLevel == &level && mGrid == grid &&
+        mTiles.rects.size() == level.tiles.size() &&
+        mCoins.rects.size() == level.coins.size() &&
+        mEnemies.rects.size() == level.enemies.size())
+        return;
+
+    for (Layer* l : {&mTiles, &mCoins, &mEnemies}) {
+        l->cells.clear();
+        l->rects.clear();
+    }
+    mTiles.rects.reserve(level.tiles.size());
+    mCoins.rects.reserve(level.coins.size());
+    mEnemies.rects.reserve(level.enemies.size());
+
+    for (int i = 0; i < static_cast<int>(level.tiles.size()); ++i) {
+        const auto& t = level.tiles[i];
+        Insert(mTiles, i, {static_cast<int>(t.x), static_cast<int>(t.y), t.w, t.h});
+    }
+    for (int i = 0; i < static_cast<int>(level.coins.size()); ++i) {
+        const auto& c = level.coins[i];
+        Insert(mCoins, i, {static_cast<int>(c.x), static_cast<int>(c.y), grid, grid});
+    }
+    for (int i = 0; i < static_cast<int>(level.enemies.size()); ++i) {
+        // Profile sprite size if the type has one, otherwise one grid cell.
+        const auto& en = level.enemies[i];
+        int         ew = grid, eh = grid;
+        if (const auto* info = mEnemyTypes.Find(en.enemyType)) {
+            ew = (info->spriteW > 0) ? info->spriteW : grid;
+            eh = (info->spriteH > 0) ? info->spriteH : grid;
+        }
+        Insert(mEnemies, i, {static_cast<int>(en.x), static_cast<int>(en.y), ew, eh});
+    }
+
+    mLevel = &level;
+    mGrid  = grid;
+    mDirty = false;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Queries
+// ─────────────────────────────────────────────────────────────────────────────
+int EditorSpatialIndex::Pick(const Layer& layer, int wx, int wy, bool topMost) {
+    auto it = layer.cells.find(Key(CellOf(wx), CellOf(wy)));
+    if (it == layer.cells.end())
+        return -1;
+    const Bucket& b = it->second;
+    if (topMost) {
+        for (auto r = b.rbegin(); r != b.rend(); ++r)
+            if (Contains(layer.rects[*r], wx, wy))
+                return *r;
+    } else {
+        for (int idx : b)
+            if (Contains(layer.rects[idx], wx, wy))
+                return idx;
+    }
+    return -1;
+}
+
+int EditorSpatialIndex::HitTile(const Level& level, int grid, int wx, int wy) {
+    Sync(level, grid);
+    return Pick(mTiles, wx, wy, true);
+}
+
+int EditorSpatialIndex::HitCoin(const Level& level, int grid, int wx, int wy) {
+    Sync(level, grid);
+    return Pick(mCoins, wx, wy, false);
+}
+
+int EditorSpatialIndex::HitEnemy(const Level& level, int grid, int wx, int wy) {
+    Sync(level, grid);
+    return Pick(mEnemies, wx, wy, false);
+}
+
+void EditorSpatialIndex::TilesInRect(const Level&      level,
+                                     int               grid,
+                                     SDL_Rect          r,
+                                     std::vector<int>& out) {
+    Sync(level, grid);
+    out.clear();
+    if (r.w <= 0 || r.h <= 0)
+        return;
+
+    const int x1 = r.x + r.w, y1 = r.y + r.h;
+    auto overlaps = [&](const SDL_Rect& t) {
+        return t.x + t.w > r.x && t.x < x1 && t.y + t.h > r.y && t.y < y1;
+    };
+
+    // A marquee wider than the level touches more (mostly empty) buckets than
+    // there are tiles; scanning the rects directly is cheaper then.
+    const std::int64_t cellCount = std::int64_t(CellOf(x1) - CellOf(r.x) + 1) *
+                                   std::int64_t(CellOf(y1) - CellOf(r.y) + 1);
+    if (cellCount > static_cast<std::int64_t>(mTiles.rects.size())) {
+        for (int i = 0; i < static_cast<int>(mTiles.rects.size()); ++i)
+            if (overlaps(mTiles.rects[i]))
+                out.push_back(i);
+        return;
+    }
+
+    for (int cy = CellOf(r.y); cy <= CellOf(y1); ++cy)
+        for (int cx = CellOf(r.x); cx <= CellOf(x1); ++cx) {
+            auto it = mTiles.cells.find(Key(cx, cy));
+            if (it == mTiles.cells.end())
+                continue;
+            for (int idx : it->second)
+                if (overlaps(mTiles.rects[idx]))
+                    out.push_back(idx);
+        }
+    // A tile spanning several cells is found once per cell.
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
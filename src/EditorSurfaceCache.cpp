@@ -4,6 +4,9 @@
 #include "Text.hpp"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -11,6 +14,7 @@ namespace fs = std::filesystem;
 // Destructor — frees all owned surfaces
 // ---------------------------------------------------------------------------
 EditorSurfaceCache::~EditorSurfaceCache() {
+    mOnFree = nullptr; // the listener may already be gone
     Clear();
 }
 
@@ -51,39 +55,114 @@ SDL_Surface* EditorSurfaceCache::LoadPNG(const fs::path& p) {
 }
 
 // ---------------------------------------------------------------------------
-// Tile surface cache
+// Byte accounting / LRU eviction
 // ---------------------------------------------------------------------------
 
-SDL_Surface* EditorSurfaceCache::FindTileSurface(const std::string& path) const {
-    auto it = mTileSurfaceCache.find(path);
-    return (it != mTileSurfaceCache.end()) ? it->second : nullptr;
+std::size_t EditorSurfaceCache::SurfaceBytes(const SDL_Surface* s) {
+    return s ? sizeof(SDL_Surface) + static_cast<std::size_t>(s->pitch) * s->h : 0;
+}
+
+void EditorSurfaceCache::Free(SDL_Surface* s) {
+    if (!s)
+        return;
+    if (mOnFree)
+        mOnFree(s);
+    SDL_DestroySurface(s);
+}
+
+void EditorSurfaceCache::FreeTile(TileEntry& e) {
+    Free(e.surf);
+    for (auto* r : e.rot)
+        Free(r);
+    for (auto& chain : e.mips)
+        for (auto* m : chain)
+            Free(m);
+    e = {};
 }
 
-void EditorSurfaceCache::InsertTileSurface(const std::string& path, SDL_Surface* surf) {
-    mTileSurfaceCache[path] = surf;
+void EditorSurfaceCache::BeginFrame() {
+    ++mFrame;
+    if (mBytes > mBudget)
+        Evict();
 }
 
-bool EditorSurfaceCache::HasTileSurface(const std::string& path) const {
-    return mTileSurfaceCache.count(path) > 0;
+// Oldest first, down to 90% of the budget so a cache hovering at the limit
+// doesn't sort on every frame. Entries used last frame are the working set
+// and stay, budget or not.
+void EditorSurfaceCache::Evict() {
+    std::vector<std::pair<std::uint64_t, const std::string*>> lru;
+    for (const auto& [path, e] : mTiles)
+        if (e.bytes > 0 && e.lastUse + 1 < mFrame)
+            lru.push_back({e.lastUse, &path});
+    std::ranges::sort(lru);
+
+    const std::size_t target = mBudget / 10 * 9;
+    for (const auto& [use, path] : lru) {
+        if (mBytes <= target)
+            break;
+        auto it = mTiles.find(*path);
+        mBytes -= it->second.bytes;
+        FreeTile(it->second);
+        mTiles.erase(it);
+        ++mEvictions;
+    }
 }
 
-void EditorSurfaceCache::ClearTileSurfaceCache() {
-    mTileSurfaceCache.clear();
+EditorSurfaceCache::Stats EditorSurfaceCache::GetStats() const {
+    Stats st;
+    st.hits          = mHits;
+    st.misses        = mMisses;
+    st.evictions     = mEvictions;
+    st.residentBytes = mBytes;
+    st.budgetBytes   = mBudget;
+    for (const auto& [path, e] : mTiles) {
+        st.tiles += e.surf ? 1 : 0;
+        for (auto* r : e.rot)
+            st.rotations += r ? 1 : 0;
+        for (const auto& chain : e.mips)
+            for (auto* m : chain)
+                st.mips += m ? 1 : 0;
+    }
+    return st;
 }
 
 // ---------------------------------------------------------------------------
-// Extra tile surfaces
+// Tile surface cache
 // ---------------------------------------------------------------------------
 
-void EditorSurfaceCache::AddExtraTileSurface(SDL_Surface* surf) {
-    mExtraTileSurfaces.push_back(surf);
+SDL_Surface* EditorSurfaceCache::FindTileSurface(const std::string& path) const {
+    auto it = mTiles.find(path);
+    return (it != mTiles.end()) ? it->second.surf : nullptr;
 }
 
-void EditorSurfaceCache::ClearExtraTileSurfaces() {
-    for (auto* s : mExtraTileSurfaces)
-        if (s)
-            SDL_DestroySurface(s);
-    mExtraTileSurfaces.clear();
+SDL_Surface* EditorSurfaceCache::LoadAndCache(const std::string& path) {
+    // Already cached (or already known to be missing)? Renderers call this
+    // every frame for every visible tile, so failures must not retry.
+    auto it = mTiles.find(path);
+    if (it != mTiles.end()) {
+        it->second.lastUse = mFrame;
+        ++mHits;
+        return it->second.surf;
+    }
+    ++mMisses;
+
+    SDL_Surface* surf = nullptr;
+    if (IsAnimatedTile(path)) {
+        AnimatedTileDef def;
+        if (LoadAnimatedTileDef(path, def))
+            for (const auto& fp : def.framePaths)
+                if ((surf = LoadPNG(fp)))
+                    break;
+    } else {
+        surf = LoadPNG(path);
+    }
+
+    TileEntry& e = mTiles[path];
+    e.surf       = surf;
+    e.bytes      = SurfaceBytes(surf);
+    e.lastUse    = mFrame;
+    mBytes += e.bytes;
+    return surf;
 }
 
 // ---------------------------------------------------------------------------
@@ -93,11 +172,92 @@ void EditorSurfaceCache::ClearExtraTileSurfaces() {
 SDL_Surface* EditorSurfaceCache::GetRotated(const std::string& path,
                                             SDL_Surface*       src,
                                             int                deg) {
-    int   slot  = (deg / 90) - 1;  // 90->0, 180->1, 270->2
-    auto& entry = mRotCache[path]; // default-init: {nullptr,nullptr,nullptr}
-    if (!entry[slot])
-        entry[slot] = RotateSurfaceDeg(src, deg);
-    return entry[slot];
+    auto it = mTiles.find(path);
+    if (it == mTiles.end())
+        return nullptr;
+    TileEntry& e    = it->second;
+    int        slot = (deg / 90) - 1; // 90->0, 180->1, 270->2
+    e.lastUse       = mFrame;
+    if (e.rot[slot]) {
+        ++mHits;
+        return e.rot[slot];
+    }
+    ++mMisses;
+    e.rot[slot]            = RotateSurfaceDeg(src, deg);
+    const std::size_t size = SurfaceBytes(e.rot[slot]);
+    e.bytes += size;
+    mBytes += size;
+    return e.rot[slot];
+}
+
+// ---------------------------------------------------------------------------
+// Mip levels
+// ---------------------------------------------------------------------------
+
+int EditorSurfaceCache::MipLevelFor(int srcW, int srcH, int dstW, int dstH) {
+    dstW      = std::max(dstW, 1);
+    dstH      = std::max(dstH, 1);
+    int level = 0;
+    while (level < MAX_MIP && (srcW >> (level + 1)) >= dstW &&
+           (srcH >> (level + 1)) >= dstH)
+        ++level;
+    return level;
+}
+
+// Exact 2:1 LINEAR blit: every destination pixel samples the centre of a
+// 2x2 source block, i.e. a box filter.
+SDL_Surface* EditorSurfaceCache::Halve(SDL_Surface* src) {
+    const int    w   = std::max(src->w / 2, 1);
+    const int    h   = std::max(src->h / 2, 1);
+    SDL_Surface* dst = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_ARGB8888);
+    if (!dst)
+        return nullptr;
+    SDL_BlendMode srcMode;
+    SDL_GetSurfaceBlendMode(src, &srcMode);
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE); // copy alpha as-is
+    SDL_BlitSurfaceScaled(src, nullptr, dst, nullptr, SDL_SCALEMODE_LINEAR);
+    SDL_SetSurfaceBlendMode(src, srcMode);
+    SDL_SetSurfaceBlendMode(dst, SDL_BLENDMODE_BLEND);
+    return dst;
+}
+
+SDL_Surface* EditorSurfaceCache::GetMip(const std::string& path,
+                                        SDL_Surface*       src,
+                                        int                rotation,
+                                        int                level) {
+    if (level <= 0 || !src)
+        return src;
+    auto it = mTiles.find(path);
+    if (it == mTiles.end())
+        return nullptr;
+    TileEntry& e     = it->second;
+    MipChain&  chain = e.mips[(rotation / 90) & 3];
+    level            = std::min(level, MAX_MIP);
+    e.lastUse        = mFrame;
+    if (chain[level - 1]) {
+        ++mHits;
+        return chain[level - 1];
+    }
+    ++mMisses;
+
+    // Build down from the deepest level we already have.
+    int          have = level - 1;
+    SDL_Surface* from = src;
+    while (have > 0 && !chain[have - 1])
+        --have;
+    if (have > 0)
+        from = chain[have - 1];
+    for (int l = have + 1; l <= level; ++l) {
+        SDL_Surface* half = Halve(from);
+        if (!half)
+            return from;
+        chain[l - 1]           = half;
+        const std::size_t size = SurfaceBytes(half);
+        e.bytes += size;
+        mBytes += size;
+        from = half;
+    }
+    return from;
 }
 
 // ---------------------------------------------------------------------------
@@ -118,6 +278,7 @@ SDL_Surface* EditorSurfaceCache::GetBadge(const std::string& text, SDL_Color col
     }
     SDL_Surface* owned = SDL_DuplicateSurface(surf);
     mBadgeCache[key]   = owned;
+    mBytes += SurfaceBytes(owned);
     return owned;
 }
 
@@ -155,54 +316,29 @@ SDL_Surface* EditorSurfaceCache::GetDestroyAnimThumb(const std::string& jsonPath
         break;
     }
     mDestroyAnimThumbCache[jsonPath] = result;
+    mBytes += SurfaceBytes(result);
     return result;
 }
 
-// ---------------------------------------------------------------------------
-// LoadAndCache — load a PNG and insert into the tile surface cache
-// ---------------------------------------------------------------------------
-
-SDL_Surface* EditorSurfaceCache::LoadAndCache(const std::string& path) {
-    // Already cached?
-    SDL_Surface* existing = FindTileSurface(path);
-    if (existing) return existing;
-
-    SDL_Surface* surf = LoadPNG(path);
-    if (!surf) return nullptr;
-
-    // Store in both the tile cache (for fast lookup) and extra surfaces (for ownership)
-    InsertTileSurface(path, surf);
-    AddExtraTileSurface(surf);
-    return surf;
-}
-
 // ---------------------------------------------------------------------------
 // Bulk cleanup
 // ---------------------------------------------------------------------------
 
 void EditorSurfaceCache::Clear() {
-    // Rotation cache
-    for (auto& [path, arr] : mRotCache)
-        for (auto* s : arr)
-            if (s)
-                SDL_DestroySurface(s);
-    mRotCache.clear();
+    // Tile surfaces + rotations
+    for (auto& [path, e] : mTiles)
+        FreeTile(e);
+    mTiles.clear();
 
     // Badge cache
     for (auto& [key, s] : mBadgeCache)
-        if (s)
-            SDL_DestroySurface(s);
+        Free(s);
     mBadgeCache.clear();
 
     // Destroy-anim thumbnail cache
     for (auto& [path, s] : mDestroyAnimThumbCache)
-        if (s)
-            SDL_DestroySurface(s);
+        Free(s);
     mDestroyAnimThumbCache.clear();
 
-    // Extra tile surfaces (owned)
-    ClearExtraTileSurfaces();
-
-    // Tile surface cache (non-owning pointers — just clear the map)
-    mTileSurfaceCache.clear();
+    mBytes = 0;
 }
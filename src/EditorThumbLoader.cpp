@@ -0,0 +1,247 @@
+#include "EditorThumbLoader.hpp"
+#include "AnimatedTile.hpp"
+#include "EditorSurfaceCache.hpp"
+#include "TraceRecorder.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <print>
+
+namespace fs = std::filesystem;
+
+namespace {
+// On-disk layout: ThumbHeader, the source path (pathLen bytes, guards against
+// hash collisions), then w*h ARGB8888 pixels with no row padding.
+constexpr char          THUMB_MAGIC[4] = {'F', '2', 'T', 'H'};
+constexpr std::uint32_t THUMB_VERSION  = 1;
+
+struct ThumbHeader {
+    char          magic[4];
+    std::uint32_t version;
+    std::int64_t  stamp;
+    std::int32_t  w, h;
+    std::uint32_t pathLen;
+};
+
+std::int64_t MTime(const std::string& path) {
+    std::error_code ec;
+    auto            t = fs::last_write_time(path, ec);
+    return ec ? 0 : static_cast<std::int64_t>(t.time_since_epoch().count());
+}
+
+// FNV-1a — stable across runs, unlike std::hash.
+std::uint64_t Fnv1a(const std::string& s) {
+    std::uint64_t h = 1469598103934665603ull;
+    for (unsigned char c : s) {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+} // namespace
+
+EditorThumbLoader::EditorThumbLoader() {
+    std::error_code ec;
+    fs::create_directories(CACHE_DIR, ec);
+    if (ec)
+        std::print("EditorThumbLoader: cannot create {} ({}), thumbnails won't persist\n",
+                   CACHE_DIR, ec.message());
+    mWorker = std::thread(&EditorThumbLoader::WorkerLoop, this);
+}
+
+EditorThumbLoader::~EditorThumbLoader() {
+    {
+        std::lock_guard lock(mMutex);
+        mQuit = true;
+        mRequests.clear();
+    }
+    mCv.notify_all();
+    if (mWorker.joinable())
+        mWorker.join();
+
+    for (auto& f : mReady)
+        if (f.done.thumb)
+            SDL_DestroySurface(f.done.thumb);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Main-thread API
+// ─────────────────────────────────────────────────────────────────────────────
+void EditorThumbLoader::Request(int channel, int slot, const std::string& path, Source src,
+                                int w, int h) {
+    {
+        std::lock_guard lock(mMutex);
+        mRequests.push_back({channel, slot, mGeneration[channel], path, src, w, h});
+    }
+    mCv.notify_one();
+}
+
+void EditorThumbLoader::Cancel(int channel) {
+    std::lock_guard lock(mMutex);
+    ++mGeneration[channel];
+    std::erase_if(mRequests, [&](const Job& j) { return j.channel == channel; });
+}
+
+std::vector<EditorThumbLoader::Done> EditorThumbLoader::Drain() {
+    std::vector<Finished> ready;
+    std::vector<Done>     out;
+    {
+        std::lock_guard lock(mMutex);
+        if (mReady.empty())
+            return out;
+        ready.swap(mReady);
+        for (auto& f : ready) {
+            if (f.generation == mGeneration[f.done.channel])
+                out.push_back(f.done);
+            else if (f.done.thumb)
+                SDL_DestroySurface(f.done.thumb); // folder was left while in flight
+        }
+    }
+    return out;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Worker thread
+// ─────────────────────────────────────────────────────────────────────────────
+void EditorThumbLoader::WorkerLoop() {
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock lock(mMutex);
+            mCv.wait(lock, [&] { return mQuit || !mRequests.empty(); });
+            if (mQuit)
+                return;
+            job = std::move(mRequests.front());
+            mRequests.pop_front();
+        }
+
+        SDL_Surface* thumb = Generate(job);
+
+        std::lock_guard lock(mMutex);
+        if (mQuit) {
+            if (thumb)
+                SDL_DestroySurface(thumb);
+            return;
+        }
+        mReady.push_back({{job.channel, job.slot, thumb}, job.generation});
+    }
+}
+
+SDL_Surface* EditorThumbLoader::Generate(const Job& job) {
+    const std::int64_t stamp = SourceStamp(job);
+    const std::string  file  = CacheFile(job);
+    if (SDL_Surface* cached = ReadCached(file, job, stamp))
+        return cached;
+
+    SDL_Surface* thumb = Decode(job);
+    if (thumb)
+        WriteCached(file, job, stamp, thumb);
+    return thumb;
+}
+
+SDL_Surface* EditorThumbLoader::Decode(const Job& job) {
+    TRACE_SCOPE("asset", "Thumbnail decode", job.path);
+    SDL_Surface* full = nullptr;
+    if (job.src == Source::Image) {
+        full = EditorSurfaceCache::LoadPNG(job.path);
+    } else {
+        AnimatedTileDef def;
+        if (!LoadAnimatedTileDef(job.path, def))
+            return nullptr;
+        for (const auto& fp : def.framePaths)
+            if ((full = EditorSurfaceCache::LoadPNG(fp)))
+                break;
+    }
+    if (!full)
+        return nullptr;
+    SDL_Surface* thumb = EditorSurfaceCache::MakeThumb(full, job.w, job.h);
+    SDL_DestroySurface(full);
+    return thumb;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// On-disk cache
+// ─────────────────────────────────────────────────────────────────────────────
+
+// A manifest thumbnail depends on the manifest and its frame images, so the
+// stamp is the newest of them.
+std::int64_t EditorThumbLoader::SourceStamp(const Job& job) {
+    std::int64_t stamp = MTime(job.path);
+    if (job.src == Source::AnimatedTile) {
+        AnimatedTileDef def;
+        if (LoadAnimatedTileDef(job.path, def))
+            for (const auto& fp : def.framePaths)
+                stamp = std::max(stamp, MTime(fp));
+    }
+    return stamp;
+}
+
+std::string EditorThumbLoader::CacheFile(const Job& job) {
+    char name[48];
+    std::snprintf(name, sizeof(name), "%016llx_%dx%d.thumb",
+                  static_cast<unsigned long long>(Fnv1a(job.path)), job.w, job.h);
+    return (fs::path(CACHE_DIR) / name).string();
+}
+
+SDL_Surface* EditorThumbLoader::ReadCached(const std::string& file, const Job& job,
+                                           std::int64_t stamp) {
+    std::ifstream in(file, std::ios::binary);
+    if (!in)
+        return nullptr;
+    ThumbHeader hdr{};
+    if (!in.read(reinterpret_cast<char*>(&hdr), sizeof(hdr)) ||
+        std::memcmp(hdr.magic, THUMB_MAGIC, 4) != 0 || hdr.version != THUMB_VERSION ||
+        hdr.stamp != stamp || hdr.w != job.w || hdr.h != job.h ||
+        hdr.pathLen != job.path.size())
+        return nullptr;
+    std::string path(hdr.pathLen, '\0');
+    if (!in.read(path.data(), hdr.pathLen) || path != job.path)
+        return nullptr;
+
+    SDL_Surface* thumb = SDL_CreateSurface(job.w, job.h, SDL_PIXELFORMAT_ARGB8888);
+    if (!thumb)
+        return nullptr;
+    for (int y = 0; y < job.h; ++y) {
+        auto* row = static_cast<char*>(thumb->pixels) + y * thumb->pitch;
+        if (!in.read(row, job.w * 4)) {
+            SDL_DestroySurface(thumb);
+            return nullptr;
+        }
+    }
+    SDL_SetSurfaceBlendMode(thumb, SDL_BLENDMODE_BLEND);
+    return thumb;
+}
+
+// Written to a temp file and renamed into place, so an editor killed mid-write
+// never leaves a truncated entry behind.
+void EditorThumbLoader::WriteCached(const std::string& file, const Job& job,
+                                    std::int64_t stamp, SDL_Surface* thumb) {
+    if (thumb->format != SDL_PIXELFORMAT_ARGB8888)
+        return;
+    const std::string tmp = file + ".tmp";
+    bool              ok  = false;
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return;
+        ThumbHeader hdr{};
+        std::memcpy(hdr.magic, THUMB_MAGIC, 4);
+        hdr.version = THUMB_VERSION;
+        hdr.stamp   = stamp;
+        hdr.w       = job.w;
+        hdr.h       = job.h;
+        hdr.pathLen = static_cast<std::uint32_t>(job.path.size());
+        out.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+        out.write(job.path.data(), static_cast<std::streamsize>(job.path.size()));
+        for (int y = 0; y < job.h; ++y)
+            out.write(static_cast<const char*>(thumb->pixels) + y * thumb->pitch, job.w * 4);
+        ok = static_cast<bool>(out);
+    }
+    std::error_code ec;
+    if (ok)
+        fs::rename(tmp, file, ec);
+    if (!ok || ec)
+        fs::remove(tmp, ec);
+}
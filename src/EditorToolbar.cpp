@@ -16,6 +16,8 @@ EditorToolbar::Defs() {
         {ButtonId::Enemy,       Group::Place,    "Enemy",    12, "2", true},
         {ButtonId::Tile,        Group::Place,    "Tile",     12, "3", true},
         {ButtonId::Erase,       Group::Place,    "Erase",    12, "4", true},
+        {ButtonId::Fill,        Group::Place,    "Fill",     12, "B", true},
+        {ButtonId::Stamp,       Group::Place,    "Stamp",    12, "N", true},
         {ButtonId::PlayerStart, Group::Place,    "Player",   12, "5", true},
         {ButtonId::Select,      Group::Place,    "Select",   11, "Q", true},
         {ButtonId::MoveCam,     Group::Place,    "Pan",      11, "T", true},
@@ -141,6 +141,8 @@ void EditorUIRenderer::RenderToolbar(SDL_Surface* screen, int winW, int toolbarH
             case ToolId::Enemy:       return TBBtn::Enemy;
             case ToolId::Tile:        return TBBtn::Tile;
             case ToolId::Erase:       return TBBtn::Erase;
+            case ToolId::Fill:        return TBBtn::Fill;
+            case ToolId::Stamp:       return TBBtn::Stamp;
             case ToolId::PlayerStart: return TBBtn::PlayerStart;
             case ToolId::Select:      return TBBtn::Select;
             case ToolId::MoveCam:     return TBBtn::MoveCam;
@@ -410,12 +412,15 @@ void EditorUIRenderer::RenderPalettePanel(
             } else {
                 DrawRect(screen, cell, sel?SDL_Color{50,100,200,220}:SDL_Color{35,35,55,220});
                 DrawOutline(screen, cell, sel?SDL_Color{100,180,255,255}:SDL_Color{55,55,80,255});
-                SDL_Surface* ts = item.thumb ? item.thumb : item.full;
-                if (ts) {
+                if (item.thumb) {
                     SDL_Rect imgDst = {ix+1, iy+1, cellW-2, cellW-2};
-                    SDL_BlitSurfaceScaled(ts, nullptr, screen, &imgDst, SDL_SCALEMODE_LINEAR);
+                    SDL_BlitSurfaceScaled(item.thumb, nullptr, screen, &imgDst, SDL_SCALEMODE_LINEAR);
                 } else {
                     DrawRect(screen, {ix+1, iy+1, cellW-2, cellW-2}, {60,40,80,255});
+                    if (item.thumbPending) {
+                        SDL_Surface* ps = cache.GetBadge("...",{150,130,180,255});
+                        if (ps) blitBadge(ps, ix+(cellW-ps->w)/2, iy+(cellW-ps->h)/2);
+                    }
                 }
                 std::string lbl = item.label;
                 if ((int)lbl.size() > 9) lbl = lbl.substr(0,8)+"~";
@@ -488,10 +493,15 @@ void EditorUIRenderer::RenderPalettePanel(
             DrawOutline(screen, cell, sel?SDL_Color{100,220,255,255}:SDL_Color{55,55,80,255},
                         sel?2:1);
             SDL_Rect imgDst = {canvasW+PAD+1, iy+1, thumbW-2, thumbH-2};
-            if (palette.BgItems()[i].thumb)
+            if (palette.BgItems()[i].thumb) {
                 SDL_BlitSurfaceScaled(palette.BgItems()[i].thumb,nullptr,screen,&imgDst,SDL_SCALEMODE_LINEAR);
-            else
+            } else {
                 DrawRect(screen, imgDst, {40,40,70,255});
+                if (palette.BgItems()[i].thumbPending) {
+                    SDL_Surface* ps = cache.GetBadge("...",{150,130,180,255});
+                    if (ps) blitBadge(ps, imgDst.x+(imgDst.w-ps->w)/2, imgDst.y+(imgDst.h-ps->h)/2);
+                }
+            }
 
             std::string lbl = palette.BgItems()[i].label;
             if ((int)lbl.size()>14) lbl=lbl.substr(0,13)+"~";
@@ -527,7 +537,7 @@ void EditorUIRenderer::RenderBottomBar(
     int& lastCamX, int& lastCamY)
 {
     int W = window.GetWidth(), H = window.GetHeight();
-    DrawRect(screen, {0, H-22, canvasW, 22}, {16,16,24,220});
+    DrawRect(screen, {0, H-BOTTOM_BAR_H, canvasW, BOTTOM_BAR_H}, {16,16,24,220});
 
     int tc=(int)level.tiles.size(), cc=(int)level.coins.size(), ec=(int)level.enemies.size();
     if (tc!=lastTileCount||cc!=lastCoinCount||ec!=lastEnemyCount) {
@@ -554,8 +564,14 @@ void EditorUIRenderer::RenderBottomBar(
         else
             hint = "RClick:rotate  MMB:pan  Ctrl+Scroll:zoom("+
                    std::to_string((int)(camera.Zoom()*100))+"%)  G:Mode  Ctrl+S:Save  Ctrl+Z:Undo";
-        lblBottomHint = std::make_unique<Text>(
-            hint, SDL_Color{70,70,90,255}, canvasW/2-200, H-18, 11);
+        SDL_Point pos = {canvasW/2-200, H-18};
+        if (!lblBottomHint || hint != mLastHint || pos.x != mLastHintPos.x ||
+            pos.y != mLastHintPos.y) {
+            lblBottomHint = std::make_unique<Text>(
+                hint, SDL_Color{70,70,90,255}, pos.x, pos.y, 11);
+            mLastHint    = std::move(hint);
+            mLastHintPos = pos;
+        }
     }
     if (lblBottomHint) lblBottomHint->RenderToSurface(screen);
 }
@@ -1,4 +1,6 @@
 #include "EnemyCreatorScene.hpp"
+#include "ProfileCache.hpp"
+#include "TextureRegistry.hpp"
 #include "TitleScene.hpp"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
@@ -688,11 +690,11 @@ void EnemyCreatorScene::Render(Window& window, float /*alpha*/) {
     }
 
     // Upload surface to texture and render
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(ren, s);
+    SDL_Texture* tex = TextureRegistry::Get().CreateFromSurface(ren, s, "enemy-creator");
     SDL_DestroySurface(s);
     if (tex) {
         SDL_RenderTexture(ren, tex, nullptr, nullptr);
-        SDL_DestroyTexture(tex);
+        TextureRegistry::Get().Destroy(tex);
     }
     window.Update();
 }
@@ -968,8 +970,9 @@ void EnemyCreatorScene::refreshRoster() {
 
 void EnemyCreatorScene::loadRosterEntry(int idx) {
     if (idx < 0 || idx >= (int)mRoster.size()) return;
-    EnemyProfile loaded;
-    if (LoadEnemyProfile(mRoster[idx].path, loaded)) {
+    // Shared cached parse; the creator edits its own copy.
+    if (auto shared = GetEnemyProfile(mRoster[idx].path)) {
+        EnemyProfile loaded = *shared;
         if (mHBInitialised && mPreviewCellRect.w > 0)
             commitHBToProfile(mSelectedSlot);
         for (int i = 0; i < ENEMY_ANIM_SLOT_COUNT; ++i) mPreviews[i].reset();
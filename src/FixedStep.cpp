@@ -0,0 +1,137 @@
+#include "FixedStep.hpp"
+#include "TraceRecorder.hpp"
+#include <algorithm>
+#include <print>
+
+namespace {
+// Degrade only when ticks are this much of the frame; below it the frame is
+// render-bound and a slower tick would not help.
+constexpr double DEGRADE_TICK_SHARE = 0.25;
+// Step back up only if the ticks would stay under this share at the higher
+// rate (twice the current tick time).
+constexpr double RECOVER_TICK_SHARE = 0.5;
+} // namespace
+
+FixedStep& FixedStep::Get() {
+    static FixedStep instance;
+    return instance;
+}
+
+void FixedStep::SetRate(float hz) {
+    if (hz <= 0.0f)
+        return;
+    mBaseHz      = hz;
+    mHz          = hz;
+    mDt          = 1.0f / hz;
+    mMinHz       = std::min(mMinHz, hz);
+    mCalmWindows = 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Per frame
+// ─────────────────────────────────────────────────────────────────────────────
+void FixedStep::BeginFrame(float frameSeconds) {
+    mFrameSeconds = frameSeconds;
+    mFrameTicks   = 0;
+    mFrameTickCtr = 0;
+    mTickStart    = 0;
+    mSaturated    = false;
+
+    if (frameSeconds > HITCH_SECONDS) {
+        // One long stall, not sustained load: skip it rather than replay it.
+        frameSeconds  = mDt;
+        mFrameSeconds = 0.0f; // keep it out of the tick-share average
+    }
+    mAccum += frameSeconds;
+    if (mAccum > MAX_SIM_PER_FRAME) {
+        mLostMs += (mAccum - MAX_SIM_PER_FRAME) * 1000.0f;
+        mAccum     = MAX_SIM_PER_FRAME;
+        mSaturated = true;
+    }
+}
+
+bool FixedStep::Step() {
+    const Uint64 now = SDL_GetPerformanceCounter();
+    if (mTickStart)
+        mFrameTickCtr += now - mTickStart;
+    if (mAccum < mDt) {
+        mTickStart = 0;
+        return false;
+    }
+    mAccum -= mDt;
+    mTickStart = now;
+    ++mFrameTicks;
+    return true;
+}
+
+void FixedStep::EndUpdate() {
+    if (mTickStart) // the loop broke out before Step() returned false
+        mFrameTickCtr += SDL_GetPerformanceCounter() - mTickStart;
+    mTickStart = 0;
+
+    // A tick that switched scenes carries the whole load; like a hitch, it
+    // says nothing about sustained cost.
+    const double tickSec = (double)mFrameTickCtr / (double)SDL_GetPerformanceFrequency();
+    if (tickSec < HITCH_SECONDS) {
+        mWinTickSec += tickSec;
+        mWinFrameSec += mFrameSeconds;
+        mWinTicks += mFrameTicks;
+    }
+    mWinSaturated += mSaturated ? 1 : 0;
+    if (++mWinFrames >= EVAL_FRAMES)
+        Evaluate();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Adapting the rate
+// ─────────────────────────────────────────────────────────────────────────────
+void FixedStep::Evaluate() {
+    const double share = mWinFrameSec > 0.0 ? mWinTickSec / mWinFrameSec : 0.0;
+    mLast.hz            = mHz;
+    mLast.baseHz        = mBaseHz;
+    mLast.avgTickMs     = mWinTicks ? (float)(mWinTickSec * 1000.0 / mWinTicks) : 0.0f;
+    mLast.ticksPerFrame = (float)mWinTicks / (float)mWinFrames;
+    mLast.tickShare     = (float)share;
+    mLast.saturated     = mWinSaturated;
+
+    if (mAdaptive) {
+        if (mWinSaturated >= EVAL_FRAMES / 4 && share >= DEGRADE_TICK_SHARE &&
+            mHz > mMinHz) {
+            mCalmWindows = 0;
+            ChangeRate(std::max(mMinHz, mHz * 0.5f), "cannot keep up");
+        } else if (mHz < mBaseHz && mWinSaturated == 0 && share * 2.0 < RECOVER_TICK_SHARE) {
+            if (++mCalmWindows >= RECOVER_WINDOWS) {
+                mCalmWindows = 0;
+                ChangeRate(std::min(mBaseHz, mHz * 2.0f), "has headroom again");
+            }
+        } else {
+            mCalmWindows = 0;
+        }
+    }
+
+    mWinFrames = mWinTicks = mWinSaturated = 0;
+    mWinTickSec = mWinFrameSec = 0.0;
+}
+
+void FixedStep::ChangeRate(float hz, const char* why) {
+    std::print("[Tick] {:.0f} Hz {} ({:.3f} ms/tick, {:.0f}% of frame time, {} of {} "
+               "frames saturated); now {:.0f} Hz\n",
+               mHz, why, mLast.avgTickMs, mLast.tickShare * 100.0f, mLast.saturated,
+               EVAL_FRAMES, hz);
+    if (hz < mHz)
+        ++mDrops;
+    TRACE_INSTANT("tick", hz < mHz ? "Tick rate down" : "Tick rate up");
+    // The accumulator stays in seconds; Alpha() just rescales to the new
+    // tick, so interpolation carries straight across the change.
+    mHz = hz;
+    mDt = 1.0f / hz;
+}
+
+FixedStep::Stats FixedStep::GetStats() const {
+    Stats s  = mLast;
+    s.hz     = mHz;
+    s.baseHz = mBaseHz;
+    s.drops  = mDrops;
+    s.lostMs = mLostMs;
+    return s;
+}
@@ -0,0 +1,239 @@
+#include "FramePacer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <print>
+
+namespace {
+constexpr Uint64 SPIN_GUARD_NS = 100'000;   // added on top of the measured p95 oversleep
+constexpr Uint64 MAX_SPIN_NS   = 4'000'000; // beyond this, sleeping is not worth it
+constexpr int    SPIN_REFRESH  = 8;         // recompute the margin every N sleeps
+constexpr int    VSYNC_RECHECK = 30;        // frames between "is vsync still blocking?"
+constexpr float  IDLE_HZ       = 60.0f;     // idle iterations when there is no target
+
+// Presents count as vsync-paced when the natural interval is this close to
+// the refresh period.
+constexpr float VSYNC_MIN = 0.85f;
+constexpr float VSYNC_MAX = 1.15f;
+
+Uint64 HzToNs(float hz) { return hz > 0.0f ? (Uint64)(1e9 / hz) : 0; }
+} // namespace
+
+FramePacer& FramePacer::Get() {
+    static FramePacer instance;
+    return instance;
+}
+
+void FramePacer::SetTargetHz(float hz) {
+    hz = std::max(hz, 0.0f);
+    if (hz == mTargetHz)
+        return;
+    mTargetHz = hz;
+    mDeadline = 0;
+}
+
+void FramePacer::SetDisplayHz(float hz) {
+    if (std::fabs(hz - mDisplayHz) < 0.5f)
+        return;
+    mDisplayHz = hz;
+    Reprobe();
+}
+
+void FramePacer::SetVSyncRequested(bool on) {
+    if (on == mVSyncRequested)
+        return;
+    mVSyncRequested = on;
+    Reprobe();
+}
+
+void FramePacer::Reprobe() {
+    mVSync     = false;
+    mProbeLeft = mVSyncRequested ? PROBE_FRAMES : 0;
+    mDeadline  = 0;
+}
+
+Uint64 FramePacer::PeriodNs() const { return HzToNs(mTargetHz); }
+
+bool FramePacer::ShouldWait() const {
+    if (mTargetHz <= 0.0f || mProbeLeft > 0)
+        return false;
+    // Vsync already holds us to the display rate; only a lower target needs
+    // the pacer on top.
+    return !(mVSync && mDisplayHz <= mTargetHz * 1.02f);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Per frame
+// ─────────────────────────────────────────────────────────────────────────────
+void FramePacer::EndFrame(bool presented) {
+    if (!presented) {
+        IdleFrame();
+        return;
+    }
+    if (mIdleFrames > 0) {
+        // A long pause (the editor sat idle, the window may have been hidden
+        // or moved): whatever the probe concluded before may no longer hold.
+        if (mIdleFrames >= PROBE_FRAMES)
+            Reprobe();
+        mIdleFrames = 0;
+    }
+
+    if (ShouldWait()) {
+        const Uint64 period = PeriodNs();
+        const Uint64 now    = SDL_GetTicksNS();
+        if (mDeadline == 0)
+            mDeadline = (mFrameStart ? mFrameStart : now) + period;
+        if (now > mDeadline + period) {
+            // A hitch (load, breakpoint, slow frame): start a fresh cadence
+            // instead of rushing the next frames to catch up.
+            ++mMissed;
+            mDeadline = now;
+        } else if (now < mDeadline) {
+            WaitUntil(mDeadline);
+        }
+        mDeadline += period;
+    } else {
+        mDeadline = 0;
+    }
+
+    const Uint64 end = SDL_GetTicksNS();
+    if (mFrameStart) {
+        mIntervalMs[mHead] = (float)((end - mFrameStart) / 1e6);
+        mHead              = (mHead + 1) % HISTORY;
+        mFrames            = std::min(mFrames + 1, HISTORY);
+
+        if (mProbeLeft > 0 && --mProbeLeft == 0)
+            FinishProbe();
+        else if (mVSync && mHead % VSYNC_RECHECK == 0 &&
+                 RecentIntervalMs(VSYNC_RECHECK) < 1000.0f / mDisplayHz * VSYNC_MIN) {
+            std::print("[Pacing] presents stopped waiting for vsync; re-probing\n");
+            Reprobe();
+        }
+    }
+    mFrameStart = end;
+}
+
+void FramePacer::IdleFrame() {
+    // Nothing was presented, so nothing blocked on vsync: sleep out a period
+    // so the loop does not spin. Precision does not matter here, and the
+    // iteration stays out of the interval history and the vsync checks.
+    Uint64 period = PeriodNs();
+    if (period == 0)
+        period = HzToNs(mDisplayHz > 0.0f ? mDisplayHz : IDLE_HZ);
+    const Uint64 now   = SDL_GetTicksNS();
+    const Uint64 start = mFrameStart ? mFrameStart : now;
+    if (now < start + period)
+        SDL_DelayNS(start + period - now);
+
+    ++mIdleFrames;
+    mDeadline   = 0; // the next present starts a fresh cadence
+    mFrameStart = SDL_GetTicksNS();
+}
+
+void FramePacer::FinishProbe() {
+    // The first half of the probe absorbs whatever caused it (startup, a
+    // display move); judge the settled half.
+    const float median = RecentIntervalMs(PROBE_FRAMES / 2);
+    const float refMs  = mDisplayHz > 0.0f ? 1000.0f / mDisplayHz : 0.0f;
+    mVSync = refMs > 0.0f && median >= refMs * VSYNC_MIN && median <= refMs * VSYNC_MAX;
+    if (mVSync)
+        std::print("[Pacing] vsync effective at {:.0f} Hz\n", mDisplayHz);
+    else
+        std::print("[Pacing] vsync not effective ({:.2f} ms/frame unpaced, display {:.0f} "
+                   "Hz); pacing in software\n",
+                   median, mDisplayHz);
+}
+
+float FramePacer::RecentIntervalMs(int frames) const {
+    frames = std::min(frames, mFrames);
+    if (frames == 0)
+        return 0.0f;
+    std::array<float, HISTORY> v;
+    for (int k = 0; k < frames; ++k)
+        v[k] = mIntervalMs[(mHead - 1 - k + HISTORY) % HISTORY];
+    std::nth_element(v.begin(), v.begin() + frames / 2, v.begin() + frames);
+    return v[frames / 2];
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Waiting
+// ─────────────────────────────────────────────────────────────────────────────
+void FramePacer::WaitUntil(Uint64 deadlineNs) {
+    const Uint64 now = SDL_GetTicksNS();
+    if (deadlineNs > now + mSpinNs) {
+        const Uint64 asked = deadlineNs - now - mSpinNs;
+        SDL_DelayNS(asked);
+        const Uint64 woke = SDL_GetTicksNS();
+        const Uint64 over = woke > now + asked ? woke - (now + asked) : 0;
+
+        mOvershootNs[mOvershootHead] = (Uint32)std::min<Uint64>(over, 0xFFFFFFFFu);
+        mOvershootHead               = (mOvershootHead + 1) % OVERSHOOT_SAMPLES;
+        mOvershootCount              = std::min(mOvershootCount + 1, OVERSHOOT_SAMPLES);
+        if (mOvershootHead % SPIN_REFRESH == 0)
+            UpdateSpin();
+    }
+    // The last stretch: short enough that spinning costs little, and exact.
+    while (SDL_GetTicksNS() < deadlineNs)
+        SDL_CPUPauseInstruction();
+}
+
+void FramePacer::UpdateSpin() {
+    std::array<Uint32, OVERSHOOT_SAMPLES> v = mOvershootNs;
+    const int p95 = std::min(mOvershootCount - 1, mOvershootCount * 95 / 100);
+    std::nth_element(v.begin(), v.begin() + p95, v.begin() + mOvershootCount);
+    mOvershootP95 = v[p95];
+    mSpinNs       = std::min(mOvershootP95 + SPIN_GUARD_NS, MAX_SPIN_NS);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Stats
+// ─────────────────────────────────────────────────────────────────────────────
+FramePacer::Stats FramePacer::GetStats() const {
+    Stats s;
+    s.targetHz    = mTargetHz;
+    s.displayHz   = mDisplayHz;
+    s.vsync       = mVSync;
+    s.probing     = mProbeLeft > 0;
+    s.sleeping    = ShouldWait();
+    s.spinUs      = (float)(mSpinNs / 1e3);
+    s.overshootUs = (float)(mOvershootP95 / 1e3);
+    s.missed      = mMissed;
+    if (mFrames == 0)
+        return s;
+
+    double sum = 0.0;
+    for (int k = 0; k < mFrames; ++k)
+        sum += mIntervalMs[k];
+    const double mean = sum / mFrames;
+    double       var  = 0.0;
+    for (int k = 0; k < mFrames; ++k)
+        var += (mIntervalMs[k] - mean) * (mIntervalMs[k] - mean);
+    s.intervalMs = (float)mean;
+    s.jitterMs   = (float)std::sqrt(var / mFrames);
+
+    // Error against the period the frames were meant to have.
+    float intended = (float)mean;
+    if (s.sleeping)
+        intended = 1000.0f / mTargetHz;
+    else if (mVSync)
+        intended = 1000.0f / mDisplayHz;
+    std::array<float, HISTORY> err;
+    for (int k = 0; k < mFrames; ++k)
+        err[k] = std::fabs(mIntervalMs[k] - intended);
+    const int p99 = std::min(mFrames - 1, (int)(mFrames * 0.99f));
+    std::nth_element(err.begin(), err.begin() + p99, err.begin() + mFrames);
+    s.p99ErrorMs = err[p99];
+    return s;
+}
+
+void FramePacer::PrintSummary() const {
+    const Stats s = GetStats();
+    char        target[16];
+    if (s.targetHz > 0.0f)
+        SDL_snprintf(target, sizeof(target), "%.0f Hz", s.targetHz);
+    else
+        SDL_snprintf(target, sizeof(target), "uncapped");
+    std::print("[Pacing] target {}, display {:.0f} Hz, vsync {} | {:.2f} ms/frame, jitter "
+               "{:.2f} ms, p99 error {:.2f} ms | spin {:.0f} us, {} missed\n",
+               target, s.displayHz, s.vsync ? "effective" : "off", s.intervalMs, s.jitterMs,
+               s.p99ErrorMs, s.spinUs, s.missed);
+}
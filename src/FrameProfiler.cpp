@@ -0,0 +1,281 @@
+#include "FrameProfiler.hpp"
+#include "FixedStep.hpp"
+#include "FramePacer.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+constexpr int   CHAR_PX   = SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE; // 8x8 debug font
+constexpr int   LINE_PX   = CHAR_PX + 4;
+constexpr int   PAD       = 8;
+constexpr int   GRAPH_H   = 64;
+constexpr float GRAPH_MAX = 33.3f; // ms at the top of the graph
+constexpr float BUDGET_MS = 1000.0f / 60.0f;
+
+void FillRect(SDL_Renderer* ren, float x, float y, float w, float h) {
+    SDL_FRect r{x, y, w, h};
+    SDL_RenderFillRect(ren, &r);
+}
+
+// "512B", "3.4K", "1.2M" — fits the 6-column bytes field.
+void FormatBytes(char* out, size_t n, float bytes) {
+    if (bytes < 1024.0f)
+        SDL_snprintf(out, n, "%.0fB", bytes);
+    else if (bytes < 1024.0f * 1024.0f)
+        SDL_snprintf(out, n, "%.1fK", bytes / 1024.0f);
+    else
+        SDL_snprintf(out, n, "%.1fM", bytes / (1024.0f * 1024.0f));
+}
+
+// Allocation columns to the right of a stats row: allocations and bytes per
+// frame, red when a zone allocates at all.
+constexpr int STATS_COLS = 45; // width of the "%-18.18s %6.3f ..." row
+constexpr int ALLOC_COLS = 13;
+
+void DrawAllocCols(SDL_Renderer* ren, float x, float y, float allocs, float bytes) {
+    char b[16], buf[32];
+    FormatBytes(b, sizeof(b), bytes);
+    SDL_snprintf(buf, sizeof(buf), " %5.1f %6s", allocs, b);
+    if (allocs > 0.0f)
+        SDL_SetRenderDrawColor(ren, 255, 110, 110, 255);
+    else
+        SDL_SetRenderDrawColor(ren, 120, 130, 150, 255);
+    SDL_RenderDebugText(ren, x + STATS_COLS * CHAR_PX, y, buf);
+}
+} // namespace
+
+FrameProfiler& FrameProfiler::Get() {
+    static FrameProfiler instance;
+    return instance;
+}
+
+FrameProfiler::FrameProfiler()
+    : mMsPerTick(1000.0 / (double)SDL_GetPerformanceFrequency()),
+      mZoneMs((size_t)MAX_ZONES * HISTORY, 0.0f),
+      mZoneCalls((size_t)MAX_ZONES * HISTORY, 0),
+      mFrameMs(HISTORY, 0.0f) {
+    if (AllocTracker::Enabled()) {
+        mZoneAllocs.assign((size_t)MAX_ZONES * HISTORY, 0.0f);
+        mZoneBytes.assign((size_t)MAX_ZONES * HISTORY, 0.0f);
+        mFrameAllocs.assign(HISTORY, 0.0f);
+        mFrameBytes.assign(HISTORY, 0.0f);
+    }
+}
+
+int FrameProfiler::RegisterZone(const char* name) {
+    for (int i = 0; i < mZoneCount; ++i)
+        if (std::strcmp(mNames[i], name) == 0)
+            return i;
+    if (mZoneCount >= MAX_ZONES)
+        return -1;
+    mNames[mZoneCount] = name;
+    return mZoneCount++;
+}
+
+void FrameProfiler::EndFrame() {
+    const Uint64 now = SDL_GetPerformanceCounter();
+    mFrameMs[mHead]  = mLastFrame ? (float)((now - mLastFrame) * mMsPerTick) : 0.0f;
+    if (mLastFrame && TraceRecorder::Active())
+        TraceRecorder::Get().Complete("frame", "Frame", mLastFrame, now);
+    mLastFrame = now;
+
+    for (int z = 0; z < mZoneCount; ++z) {
+        const size_t i = (size_t)z * HISTORY + mHead;
+        mZoneMs[i]     = (float)(mAccum[z] * mMsPerTick);
+        mZoneCalls[i]  = mCalls[z];
+        mAccum[z]      = 0;
+        mCalls[z]      = 0;
+    }
+    if (AllocTracker::Enabled()) {
+        for (int z = 0; z < mZoneCount; ++z) {
+            const size_t i = (size_t)z * HISTORY + mHead;
+            mZoneAllocs[i] = (float)mAllocAccum[z];
+            mZoneBytes[i]  = (float)mByteAccum[z];
+            mAllocAccum[z] = 0;
+            mByteAccum[z]  = 0;
+        }
+        const AllocCounts now   = AllocTracker::Thread();
+        const AllocCounts spent = now - mFrameAllocStart;
+        mFrameAllocs[mHead]     = (float)spent.count;
+        mFrameBytes[mHead]      = (float)spent.bytes;
+        mFrameAllocStart        = now;
+    }
+    mHead   = (mHead + 1) % HISTORY;
+    mFrames = std::min(mFrames + 1, HISTORY);
+}
+
+FrameProfiler::ZoneStats FrameProfiler::Summarise(const char* name, const float* samples,
+                                                  const Uint16* calls, const float* allocs,
+                                                  const float* bytes) const {
+    ZoneStats s;
+    s.name = name;
+    if (mFrames == 0)
+        return s;
+
+    // Copy the valid window out of the ring; nth_element needs a scratch
+    // buffer anyway and HISTORY floats fit on the stack.
+    std::array<float, HISTORY> v;
+    double sum = 0.0, callSum = 0.0, allocSum = 0.0, byteSum = 0.0;
+    for (int k = 0; k < mFrames; ++k) {
+        v[k] = samples[Slot(k)];
+        sum += v[k];
+        if (calls)
+            callSum += calls[Slot(k)];
+        if (allocs) {
+            allocSum += allocs[Slot(k)];
+            byteSum += bytes[Slot(k)];
+        }
+    }
+    const int p99 = std::min(mFrames - 1, (int)(mFrames * 0.99f));
+    std::nth_element(v.begin(), v.begin() + p99, v.begin() + mFrames);
+    s.p99Ms          = v[p99];
+    s.maxMs          = *std::max_element(v.begin() + p99, v.begin() + mFrames);
+    s.avgMs          = (float)(sum / mFrames);
+    s.callsPerFrame  = (float)(callSum / mFrames);
+    s.allocsPerFrame = (float)(allocSum / mFrames);
+    s.bytesPerFrame  = (float)(byteSum / mFrames);
+    return s;
+}
+
+FrameProfiler::ZoneStats FrameProfiler::Zone(int zone) const {
+    if (zone < 0 || zone >= mZoneCount)
+        return {};
+    const size_t base = (size_t)zone * HISTORY;
+    if (!AllocTracker::Enabled())
+        return Summarise(mNames[zone], mZoneMs.data() + base, mZoneCalls.data() + base);
+    return Summarise(mNames[zone], mZoneMs.data() + base, mZoneCalls.data() + base,
+                     mZoneAllocs.data() + base, mZoneBytes.data() + base);
+}
+
+FrameProfiler::ZoneStats FrameProfiler::Frame() const {
+    if (!AllocTracker::Enabled())
+        return Summarise("frame", mFrameMs.data(), nullptr);
+    return Summarise("frame", mFrameMs.data(), nullptr, mFrameAllocs.data(),
+                     mFrameBytes.data());
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Overlay
+// ─────────────────────────────────────────────────────────────────────────────
+void FrameProfiler::DrawOverlay(SDL_Renderer* ren, int windowW) const {
+    if (!ren)
+        return;
+
+    // Zones sorted by average cost, most expensive first.
+    std::array<ZoneStats, MAX_ZONES> zones;
+    for (int z = 0; z < mZoneCount; ++z)
+        zones[z] = Zone(z);
+    std::sort(zones.begin(), zones.begin() + mZoneCount,
+              [](const ZoneStats& a, const ZoneStats& b) { return a.avgMs > b.avgMs; });
+    const ZoneStats frame = Frame();
+
+    const bool  allocs  = AllocTracker::Enabled();
+    const int   cols    = allocs ? STATS_COLS + ALLOC_COLS : 48;
+    const int   lines   = mZoneCount + (allocs ? 6 : 5);
+    const float panelW  = (float)(cols * CHAR_PX + PAD * 2);
+    const float panelH  = (float)(PAD * 3 + LINE_PX * lines + GRAPH_H);
+    const float x0      = (float)windowW - panelW - PAD;
+    const float y0      = (float)PAD;
+    float       y       = y0 + PAD;
+    char        buf[96] = {};
+
+    SDL_SetRenderDrawBlendMode(ren, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(ren, 10, 12, 18, 210);
+    FillRect(ren, x0, y0, panelW, panelH);
+
+    SDL_snprintf(buf, sizeof(buf), "frame %6.2f avg %6.2f p99 %6.2f max  %4.0f fps",
+                 frame.avgMs, frame.p99Ms, frame.maxMs,
+                 frame.avgMs > 0.0f ? 1000.0f / frame.avgMs : 0.0f);
+    SDL_SetRenderDrawColor(ren, 255, 255, 255, 255);
+    SDL_RenderDebugText(ren, x0 + PAD, y, buf);
+    y += LINE_PX;
+
+    // Who is pacing the frames, and how evenly.
+    const FramePacer::Stats pace = FramePacer::Get().GetStats();
+    char                    mode[16];
+    if (pace.probing)
+        SDL_snprintf(mode, sizeof(mode), "probing");
+    else if (pace.sleeping)
+        SDL_snprintf(mode, sizeof(mode), "sleep %.0f", pace.targetHz);
+    else if (pace.vsync)
+        SDL_snprintf(mode, sizeof(mode), "vsync %.0f", pace.displayHz);
+    else
+        SDL_snprintf(mode, sizeof(mode), "uncapped");
+    SDL_snprintf(buf, sizeof(buf), "pace %-9s jitter %5.2f p99 %5.2f spin %4.0fus", mode,
+                 pace.jitterMs, pace.p99ErrorMs, pace.spinUs);
+    SDL_SetRenderDrawColor(ren, 170, 200, 255, 255);
+    SDL_RenderDebugText(ren, x0 + PAD, y, buf);
+    y += LINE_PX;
+
+    // Physics tick rate; orange while degraded below the configured rate.
+    const FixedStep::Stats tick = FixedStep::Get().GetStats();
+    SDL_snprintf(buf, sizeof(buf), "tick %3.0f/%-3.0fHz %6.3f ms x%3.1f drop %d lost %4.0f",
+                 tick.hz, tick.baseHz, tick.avgTickMs, tick.ticksPerFrame, tick.drops,
+                 tick.lostMs);
+    if (tick.hz < tick.baseHz)
+        SDL_SetRenderDrawColor(ren, 255, 170, 80, 255);
+    SDL_RenderDebugText(ren, x0 + PAD, y, buf);
+    y += LINE_PX;
+
+    // Main-thread heap traffic, the number "zero allocations per tick" is
+    // about. Other threads (chunk loads, thumbnails) are not included.
+    if (allocs) {
+        char bytes[16];
+        FormatBytes(bytes, sizeof(bytes), frame.bytesPerFrame);
+        SDL_snprintf(buf, sizeof(buf), "heap %7.1f allocs %7s per frame (main thread)",
+                     frame.allocsPerFrame, bytes);
+        if (frame.allocsPerFrame > 0.0f)
+            SDL_SetRenderDrawColor(ren, 255, 110, 110, 255);
+        else
+            SDL_SetRenderDrawColor(ren, 255, 255, 255, 255);
+        SDL_RenderDebugText(ren, x0 + PAD, y, buf);
+        y += LINE_PX;
+    }
+    y += LINE_PX * 0.5f;
+
+    SDL_SetRenderDrawColor(ren, 140, 150, 170, 255);
+    SDL_snprintf(buf, sizeof(buf), "%-18s %6s %6s %6s %5s", "zone (ms/frame)", "avg", "p99",
+                 "max", "n");
+    SDL_RenderDebugText(ren, x0 + PAD, y, buf);
+    if (allocs)
+        SDL_RenderDebugText(ren, x0 + PAD + STATS_COLS * CHAR_PX, y, " alloc  bytes");
+    y += LINE_PX;
+
+    for (int i = 0; i < mZoneCount; ++i) {
+        const ZoneStats& z = zones[i];
+        // Highlight zones that eat a quarter of the 60 Hz budget at p99.
+        if (z.p99Ms > BUDGET_MS * 0.25f)
+            SDL_SetRenderDrawColor(ren, 255, 170, 80, 255);
+        else
+            SDL_SetRenderDrawColor(ren, 220, 225, 235, 255);
+        SDL_snprintf(buf, sizeof(buf), "%-18.18s %6.3f %6.3f %6.3f %5.1f", z.name, z.avgMs,
+                     z.p99Ms, z.maxMs, z.callsPerFrame);
+        SDL_RenderDebugText(ren, x0 + PAD, y, buf);
+        if (allocs)
+            DrawAllocCols(ren, x0 + PAD, y, z.allocsPerFrame, z.bytesPerFrame);
+        y += LINE_PX;
+    }
+
+    // ── Frame-time graph, oldest on the left ────────────────────────────────
+    y += PAD * 0.5f;
+    const float gx = x0 + PAD, gw = panelW - PAD * 2;
+    SDL_SetRenderDrawColor(ren, 30, 34, 44, 255);
+    FillRect(ren, gx, y, gw, GRAPH_H);
+
+    const float barW = gw / HISTORY;
+    for (int k = 0; k < mFrames; ++k) {
+        const float ms = mFrameMs[Slot(k)];
+        const float h  = std::min(ms / GRAPH_MAX, 1.0f) * GRAPH_H;
+        if (ms <= BUDGET_MS * 1.05f)
+            SDL_SetRenderDrawColor(ren, 90, 200, 110, 255);
+        else if (ms <= BUDGET_MS * 2.0f)
+            SDL_SetRenderDrawColor(ren, 230, 200, 70, 255);
+        else
+            SDL_SetRenderDrawColor(ren, 230, 80, 70, 255);
+        FillRect(ren, gx + gw - (k + 1) * barW, y + GRAPH_H - h, std::max(barW, 1.0f), h);
+    }
+    // 60 Hz budget line.
+    SDL_SetRenderDrawColor(ren, 255, 255, 255, 110);
+    const float budgetY = y + GRAPH_H - (BUDGET_MS / GRAPH_MAX) * GRAPH_H;
+    SDL_RenderLine(ren, gx, budgetY, gx + gw, budgetY);
+}
@@ -1,9 +1,14 @@
 #include "GameScene.hpp"
 #include "AnimatedTile.hpp"
+#include "ChunkStreamer.hpp"
 #include "EnemyProfile.hpp"
+#include "FrameProfiler.hpp"
 #include "GameConfig.hpp"
 #include "GameEvents.hpp"
 #include "LevelEditorScene.hpp"
+#include "LevelSpawn.hpp"
+#include "LevelStreamLoader.hpp"
+#include "LoadReport.hpp"
 
 #include "SurfaceUtils.hpp"
 #include "TitleScene.hpp"
@@ -16,56 +21,6 @@
 #include <unordered_map>
 #include <unordered_set>
 namespace fs = std::filesystem;
-// ─────────────────────────────────────────────────────────────────────────────
-// Level-scoped tile texture cache
-//
-// Key: "<path>|<w>x<h>|r<rotation>"  Value: non-owning ptr into tileScaledTextures
-// Populated during Spawn(); cleared in Unload() along with tileScaledTextures.
-// This avoids re-loading and re-uploading tile images on every Respawn().
-// ─────────────────────────────────────────────────────────────────────────────
-static std::string TileCacheKey(const std::string& path, int w, int h, int rot) {
-    return path + '|' + std::to_string(w) + 'x' + std::to_string(h) + "|r" +
-           std::to_string(rot);
-}
-
-// ─────────────────────────────────────────────────────────────────────────────
-// Helper: load a surface, scale it, convert to texture, free the surface.
-// Returns nullptr on failure. Caller owns the texture.
-// ─────────────────────────────────────────────────────────────────────────────
-static SDL_Texture* LoadScaledTexture(
-    SDL_Renderer* ren, const std::string& path, int tw, int th, int rotation = 0) {
-    SDL_Surface* raw = IMG_Load(path.c_str());
-    if (!raw) {
-        std::print("Failed to load tile: {}\n", path);
-        return nullptr;
-    }
-
-    SDL_Surface* conv = SDL_ConvertSurface(raw, SDL_PIXELFORMAT_ARGB8888);
-    SDL_DestroySurface(raw);
-    if (!conv)
-        return nullptr;
-
-    SDL_SetSurfaceBlendMode(conv, SDL_BLENDMODE_BLEND);
-
-    // Apply rotation on the CPU (must happen before GPU upload).
-    SDL_Surface* final = conv;
-    if (rotation != 0) {
-        SDL_Surface* rot = RotateSurfaceDeg(conv, rotation);
-        if (rot) {
-            SDL_DestroySurface(conv);
-            final = rot;
-        }
-    }
-
-    // Upload at native resolution — the GPU scales to tw x th at render time
-    // using PIXELART mode for crisp pixel art. No CPU pre-scaling.
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(ren, final);
-    SDL_DestroySurface(final);
-    if (tex)
-        SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_PIXELART);
-    return tex;
-}
-
 // ─────────────────────────────────────────────────────────────────────────────
 // Construction
 // ─────────────────────────────────────────────────────────────────────────────
@@ -84,12 +39,45 @@ void GameScene::Load(Window& window) {
     gameOver          = false;
     SDL_Renderer* ren = window.GetRenderer();
 
+    // Every load reports where its time went, by phase and asset class.
+    LoadReport& report = LoadReport::Get();
+    report.Begin(mLevelPath);
+    report.Phase("level file", "tiles");
+
+    // Stream the level file and warm the tile texture cache as each tile is
+    // parsed, so decode/upload overlaps the parse instead of waiting for it.
+    // Spawn() then finds every tile texture already resident.
     if (!mLevelPath.empty())
-        LoadLevel(mLevelPath, mLevel);
+        LoadLevelStreaming(mLevelPath, mLevel, [&](const TileSpawn& ts) {
+            if (IsAnimatedTile(ts.imagePath)) {
+                LoadReport::AssetClass anim("anim-tiles");
+                mAnimTiles.Acquire(ren, ts.imagePath, ts.rotation);
+                return;
+            }
+            mTileTextures.Get(ren, ts.imagePath, ts.rotation);
+        });
 
-    PlayerProfile profile;
-    bool useProfile = !mProfilePath.empty() && LoadPlayerProfile(mProfilePath, profile);
-    mHasProfile     = useProfile;
+    // Chunked level: tiles beyond mLevel.tiles stream in around the camera.
+    // Spawn() primes the first ring once the camera position is known.
+    if (mLevel.IsChunked()) {
+        mChunkStreamer = std::make_unique<ChunkStreamer>(
+            ren, reg, mAnimTiles, mLevelPath, *mLevel.chunking,
+            [this](const TileSpawn& ts, const ChunkStreamer::TextureFn& tex) {
+                return SpawnTile(ts, tex);
+            },
+            [this](entt::entity e) { reg.destroy(e); });
+    }
+
+    // Parsed once per process (ProfileCache) and held for Spawn()/Respawn(),
+    // which read hitboxes and slots from it without touching the file again.
+    report.Phase("player sprites", "player");
+    {
+        LoadReport::Timer parse(LoadReport::Parse);
+        mProfile = mProfilePath.empty() ? nullptr : GetPlayerProfile(mProfilePath);
+    }
+    static const PlayerProfile kNoProfile;
+    const bool                 useProfile = mProfile != nullptr;
+    const PlayerProfile&       profile    = useProfile ? *mProfile : kNoProfile;
 
     const int KW =
         (useProfile && profile.spriteW > 0) ? profile.spriteW : PLAYER_SPRITE_WIDTH;
@@ -105,9 +93,12 @@ void GameScene::Load(Window& window) {
         if (useProfile && profile.HasSlot(slot)) {
             const std::string&    dir = profile.Slot(slot).folderPath;
             std::vector<fs::path> pngs;
-            for (const auto& e : fs::directory_iterator(dir))
-                if (e.path().extension() == ".png")
-                    pngs.push_back(e.path());
+            {
+                LoadReport::Timer scan(LoadReport::Scan);
+                for (const auto& e : fs::directory_iterator(dir))
+                    if (e.path().extension() == ".png")
+                        pngs.push_back(e.path());
+            }
             if (!pngs.empty()) {
                 std::sort(pngs.begin(), pngs.end());
                 // Pass the explicit sorted path list to SpriteSheet so every
@@ -221,17 +212,21 @@ void GameScene::Load(Window& window) {
             slashFrames = idleFrames;
     }
 
+    report.Phase("enemy sheet", "enemies");
     enemySheet = std::make_unique<SpriteSheet>(
         "game_assets/base_pack/Enemies/enemies_spritesheet.png",
         "game_assets/base_pack/Enemies/enemies_spritesheet.txt");
     enemySheet->CreateTexture(ren);
     enemyWalkFrames = enemySheet->GetAnimation("slimeWalk");
 
+    // Image and Text upload on first draw, so these phases are CPU only.
+    report.Phase("background", "background");
     std::string bgPath = (!mLevelPath.empty() && !mLevel.background.empty())
                              ? mLevel.background
                              : "game_assets/backgrounds/deepspace_scene.png";
     background = std::make_unique<Image>(bgPath, FitModeFromString(mLevel.bgFitMode));
     background->SetRepeat(mLevel.bgRepeat);
+    report.Phase("ui text", "text");
     locationText = std::make_unique<Text>("You are in space!!", 20, 20);
     actionText   = std::make_unique<Text>(
         "Level 1: Collect ALL the coins!", SDL_Color{255, 255, 255, 0}, 20, 80, 20);
@@ -262,17 +257,27 @@ void GameScene::Load(Window& window) {
                                                window.GetWidth() / 2 - 160,
                                                window.GetHeight() / 2 - 40,
                                                64);
+    BeginLife();
     Spawn();
+
+    report.Count("total", reg.view<Transform>().size());
+    report.Count("tiles", mSortedTileRenderList.size());
+    report.Count("enemies", reg.view<EnemyTag>().size());
+    report.Count("coins", (size_t)totalCoins);
+    report.End();
 }
 
 void GameScene::Unload() {
+    SaveRecording();
+    // Joins the prefetch thread and frees streamed-chunk textures.
+    mChunkStreamer.reset();
     reg.clear();
-    for (auto* t : tileScaledTextures)
-        SDL_DestroyTexture(t);
-    tileScaledTextures.clear();
-    tileTextureCache.clear(); // non-owning refs — textures already freed above
-    tileAnimFrameMap.clear();
+    mTileTextures.Clear();
+    mAnimTiles.Clear();
     mSortedTileRenderList.clear();
+    mEnemyTypeCache.clear();
+    mEnemySpriteSheets.clear();
+    mProfile.reset();
     mWindow = nullptr;
 }
 
@@ -296,6 +301,22 @@ bool GameScene::HandleEvent(SDL_Event& e) {
     if (e.type == SDL_EVENT_QUIT)
         return false;
 
+#if FORGE2D_PROFILE
+    if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_F3 && !e.key.repeat) {
+        FrameProfiler::Get().ToggleOverlay();
+        return true;
+    }
+#endif
+
+    // Held keys are tracked through pauses and menus; edges are only queued
+    // below, where gameplay takes input.
+    mInput.Track(e);
+    if (mReplay && (e.type == SDL_EVENT_KEY_DOWN || e.type == SDL_EVENT_KEY_UP) &&
+        e.key.key == SDLK_TAB) {
+        mFastForward = e.type == SDL_EVENT_KEY_DOWN;
+        return true;
+    }
+
     if (mPaused) {
         if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_ESCAPE) {
             mPaused = false;
@@ -336,7 +357,7 @@ bool GameScene::HandleEvent(SDL_Event& e) {
                 BuildPauseUI(mWindow->GetWidth(), mWindow->GetHeight());
             return true;
         }
-        InputSystem(reg, e);
+        mInput.Queue(e); // applied by InputSystem at the start of the next tick
     } else {
         if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_R)
             Respawn();
@@ -352,6 +373,14 @@ bool GameScene::HandleEvent(SDL_Event& e) {
 }
 
 void GameScene::Update(float dt) {
+    // Hold Tab to fast-forward a replay.
+    const bool ff    = mFastForward && mReplay && !mReplay->Finished();
+    const int  steps = ff ? REPLAY_FAST_FORWARD : 1;
+    for (int i = 0; i < steps; ++i)
+        Tick(dt);
+}
+
+void GameScene::Tick(float dt) {
     if (mPaused)
         return;
     if (levelComplete) {
@@ -361,22 +390,60 @@ void GameScene::Update(float dt) {
     if (gameOver)
         return;
 
-    MovingPlatformTick(reg, dt);
-    FloatingResult floatResult = FloatingSystem(reg, dt);
-    LadderSystem(reg, dt);
-    PlayerStateSystem(reg);
-    MovementSystem(reg, dt, mWindow->GetWidth());
-    BoundsSystem(reg,
-                 dt,
-                 mWindow->GetWidth(),
-                 mWindow->GetHeight(),
-                 mLevel.gravityMode == GravityMode::WallRun,
-                 mLevelW,
-                 mLevelH);
-    AnimationSystem(reg, dt);
+    // One InputFrame per simulated tick: recorded with --record, checked
+    // against the recording's checksums when replaying.
+    const bool       replaying = mReplay && !mReplay->Finished();
+    const InputFrame input     = NextInput();
+    if (mRecording) {
+        if (mRecording->frames.empty())
+            mRecording->tickDt = dt;
+        mRecording->frames.push_back(input);
+    }
+
+    // Each system gets its own profiler zone (F3); the blocks only scope them.
+    {
+        PROFILE_ZONE("InputSystem");
+        InputSystem(reg, input);
+    }
+    {
+        PROFILE_ZONE("MovingPlatformTick");
+        MovingPlatformTick(reg, dt);
+    }
+    FloatingResult floatResult;
+    {
+        PROFILE_ZONE("FloatingSystem");
+        floatResult = FloatingSystem(reg, dt);
+    }
+    {
+        PROFILE_ZONE("LadderSystem");
+        LadderSystem(reg, dt, input);
+    }
+    {
+        PROFILE_ZONE("PlayerStateSystem");
+        PlayerStateSystem(reg);
+    }
+    {
+        PROFILE_ZONE("MovementSystem");
+        MovementSystem(reg, dt, mWindow->GetWidth(), input);
+    }
+    {
+        PROFILE_ZONE("BoundsSystem");
+        BoundsSystem(reg,
+                     dt,
+                     mWindow->GetWidth(),
+                     mWindow->GetHeight(),
+                     mLevel.gravityMode == GravityMode::WallRun,
+                     mLevelW,
+                     mLevelH);
+    }
+    {
+        PROFILE_ZONE("AnimationSystem");
+        AnimationSystem(reg, dt);
+    }
 
     // Recover enemies from hurt/attack animation back to move animation
     {
+        PROFILE_ZONE("EnemyAnimRecovery");
         // Hurt recovery: when the non-looping hurt animation reaches its last frame,
         // immediately snap back to move animation. No waiting for HitFlash.
         auto hurtView = reg.view<EnemyTag, EnemyAnimData, AnimationState, Renderable>(
@@ -426,52 +493,22 @@ void GameScene::Update(float dt) {
         });
     }
 
-    // Advance animated tile frames
-    for (auto& [ent, frames] : tileAnimFrameMap) {
-        if (!reg.valid(ent) || frames.empty())
-            continue;
-        auto* anim = reg.try_get<AnimationState>(ent);
-        auto* rend = reg.try_get<Renderable>(ent);
-        if (!anim || !rend)
-            continue;
-        float dur = (anim->fps > 0.0f) ? 1.0f / anim->fps : 0.125f;
-        anim->timer += dt;
-        while (anim->timer >= dur) {
-            anim->timer -= dur;
-            if (anim->looping) {
-                anim->currentFrame = (anim->currentFrame + 1) % (int)frames.size();
-            } else {
-                if (anim->currentFrame < (int)frames.size() - 1)
-                    anim->currentFrame++;
-                else
-                    anim->timer = 0.0f;
-            }
-        }
-        SDL_Texture* cur = frames[anim->currentFrame];
-        if (cur)
-            rend->sheet = cur;
-    }
+    // Animated tiles: one clock for all of them — each entity's frame is derived
+    // from it at render time, so there is nothing to tick per entity.
+    mAnimTiles.Advance(dt);
 
     // Destroy action tiles whose death animation finished
     {
+        PROFILE_ZONE("DestroyAnims");
         std::vector<entt::entity> toDestroy;
-        auto                      destroyView = reg.view<DestroyAnimTag, AnimationState>();
-        destroyView.each(
-            [&](entt::entity e, DestroyAnimTag& dat, const AnimationState& anim) {
-                if (!anim.looping && anim.currentFrame >= anim.totalFrames - 1) {
-                    if (dat.reachedEnd)
-                        toDestroy.push_back(e);
-                    else
-                        dat.reachedEnd = true;
-                }
-            });
+        auto                      destroyView = reg.view<DestroyAnimTag, AnimatedTileRef>();
+        for (auto e : destroyView)
+            if (mAnimTiles.Finished(destroyView.get<AnimatedTileRef>(e)))
+                toDestroy.push_back(e);
         for (entt::entity e : toDestroy) {
-            tileAnimFrameMap.erase(e);
-            if (reg.valid(e)) {
-                if (reg.all_of<Renderable>(e))
-                    reg.remove<Renderable>(e);
-                reg.destroy(e);
-            }
+            if (reg.all_of<Renderable>(e))
+                reg.remove<Renderable>(e);
+            reg.destroy(e);
         }
     }
 
@@ -488,16 +525,23 @@ void GameScene::Update(float dt) {
             reg.remove<HitFlash>(e);
     }
 
-    CollisionResult collision =
-        CollisionSystem(reg, dt, mWindow->GetWidth(), mWindow->GetHeight());
+    CollisionResult collision;
+    {
+        PROFILE_ZONE("CollisionSystem");
+        collision = CollisionSystem(reg, dt, mWindow->GetWidth(), mWindow->GetHeight());
+    }
     for (auto e : floatResult.actionTilesTriggered)
         collision.actionTilesTriggered.push_back(e);
-    MovingPlatformCarry(reg);
+    {
+        PROFILE_ZONE("MovingPlatformCarry");
+        MovingPlatformCarry(reg);
+    }
 
     // ── Power-up pickup detection ──────────────────────────────────────────
     // AABB overlap test: player vs any tile with PowerUpTag.
     // On overlap, apply the power-up to the player and destroy the tile.
     {
+        PROFILE_ZONE("PowerUps");
         entt::entity playerEnt = entt::null;
         SDL_Rect     playerRect{};
         {
@@ -587,7 +631,8 @@ void GameScene::Update(float dt) {
         gameOver = true;
 
     // Process triggered action tiles
-    SDL_Renderer* ren = mWindow->GetRenderer();
+    // Destroy anims were resolved into mAnimTiles at spawn (DestroyAnimRef), so
+    // this only swaps components — nothing here touches disk or the GPU.
     for (entt::entity e : collision.actionTilesTriggered) {
         if (!reg.valid(e))
             continue;
@@ -596,59 +641,36 @@ void GameScene::Update(float dt) {
         if (reg.all_of<Collider>(e))
             reg.remove<Collider>(e);
 
-        const ActionTag* atag = reg.try_get<ActionTag>(e);
-        if (atag && !atag->destroyAnimPath.empty()) {
-            AnimatedTileDef def;
-            std::print("[DestroyAnim] tile triggered, path='{}' ", atag->destroyAnimPath);
-            if (LoadAnimatedTileDef(atag->destroyAnimPath, def) && !def.framePaths.empty()) {
-                std::print("loaded {} frames at {}fps\n", def.framePaths.size(), def.fps);
-                int tw = 0, th = 0;
-                if (reg.all_of<Renderable>(e)) {
-                    const auto& rend = reg.get<Renderable>(e);
-                    if (!rend.frames.empty()) {
-                        tw = rend.frames[0].w;
-                        th = rend.frames[0].h;
-                    }
+        const auto* dar  = reg.try_get<DestroyAnimRef>(e);
+        const auto* anim = dar ? mAnimTiles.Get(dar->animId) : nullptr;
+        if (anim) {
+            const int animId = dar->animId;
+            // Play the anim at the size the tile was drawn at.
+            int drawW = 0, drawH = 0;
+            if (const auto* rend = reg.try_get<Renderable>(e)) {
+                drawW = rend->renderW;
+                drawH = rend->renderH;
+                if ((drawW <= 0 || drawH <= 0) && !rend->frames.empty()) {
+                    drawW = rend->frames[0].w;
+                    drawH = rend->frames[0].h;
                 }
-                if (tw <= 0 || th <= 0) {
-                    tw = 38;
-                    th = 38;
-                }
-
-                std::vector<SDL_Texture*> frameTex;
-                for (const auto& fp : def.framePaths) {
-                    SDL_Texture* t = LoadScaledTexture(ren, fp, tw, th);
-                    frameTex.push_back(t);
-                    if (t)
-                        tileScaledTextures.push_back(t);
-                }
-
-                if (!frameTex.empty() && frameTex[0]) {
-                    tileAnimFrameMap[e]        = std::move(frameTex);
-                    auto&                 fvec = tileAnimFrameMap[e];
-                    std::vector<SDL_Rect> animRects((int)fvec.size(),
-                                                    SDL_Rect{0, 0, tw, th});
-                    if (reg.all_of<Renderable>(e))
-                        reg.remove<Renderable>(e);
-                    reg.emplace<Renderable>(e, fvec[0], std::move(animRects), false);
-                    if (reg.all_of<AnimationState>(e))
-                        reg.remove<AnimationState>(e);
-                    reg.emplace<AnimationState>(
-                        e, 0, (int)fvec.size(), 0.0f, def.fps, false);
-                    if (!reg.all_of<TileAnimTag>(e))
-                        reg.emplace<TileAnimTag>(e);
-                    if (!reg.all_of<DestroyAnimTag>(e))
-                        reg.emplace<DestroyAnimTag>(e, (int)fvec.size(), def.fps, false);
-                    continue;
-                } else {
-                    std::print("[DestroyAnim] frame texture load failed\n");
-                    for (auto* t : frameTex)
-                        if (t)
-                            SDL_DestroyTexture(t);
-                }
-            } else {
-                std::print("def load failed or empty\n");
             }
+
+            if (reg.all_of<Renderable>(e))
+                reg.remove<Renderable>(e);
+            reg.emplace<Renderable>(
+                e, anim->atlas, std::vector<SDL_Rect>{anim->frames[0]}, false, drawW, drawH);
+            if (reg.all_of<AnimationState>(e))
+                reg.remove<AnimationState>(e);
+            reg.emplace<AnimationState>(e, 0, 1, 0.0f, 1.0f, false);
+            if (reg.all_of<AnimatedTileRef>(e))
+                reg.remove<AnimatedTileRef>(e);
+            reg.emplace<AnimatedTileRef>(e, animId, 0.0f, false, mAnimTiles.Clock());
+            if (!reg.all_of<TileAnimTag>(e))
+                reg.emplace<TileAnimTag>(e);
+            if (!reg.all_of<DestroyAnimTag>(e))
+                reg.emplace<DestroyAnimTag>(e);
+            continue;
         }
         if (reg.all_of<Renderable>(e))
             reg.remove<Renderable>(e);
@@ -656,6 +678,7 @@ void GameScene::Update(float dt) {
 
     // Hazard damage
     {
+        PROFILE_ZONE("Hazards");
         auto hView = reg.view<PlayerTag,
                               Health,
                               HazardState,
@@ -708,19 +731,8 @@ void GameScene::Update(float dt) {
         });
     }
 
-    if (mLevel.gravityMode != GravityMode::OpenWorld) {
-        auto jumpView = reg.view<PlayerTag, GravityState, AnimationSet>();
-        jumpView.each([](GravityState& g, const AnimationSet& set) {
-            // Respect slot capability: no jump frames = jumping disabled.
-            if (g.active && g.jumpHeld && g.isGrounded && !set.jump.empty()) {
-                g.velocity   = -JUMP_FORCE;
-                g.isGrounded = false;
-                g.jumpHeld   = false;
-            } else if (set.jump.empty()) {
-                g.jumpHeld = false; // drain the held flag so it doesn't queue
-            }
-        });
-    }
+    if (mLevel.gravityMode != GravityMode::OpenWorld)
+        JumpSystem(reg);
 
     if (totalCoins > 0 && coinCount >= totalCoins)
         levelComplete = true;
@@ -733,6 +745,24 @@ void GameScene::Update(float dt) {
                 cx, cy, mWindow->GetWidth(), mWindow->GetHeight(), mLevelW, mLevelH, dt);
         });
     }
+
+    // Stream chunks around the new camera position (chunked levels only).
+    // Recording or replaying streams synchronously, so chunks spawn on the
+    // same tick in both runs whatever the worker thread's timing.
+    if (mChunkStreamer) {
+        PROFILE_ZONE("ChunkStreamer");
+        const bool lockstep = mRecording || replaying;
+        const bool changed  = lockstep ? mChunkStreamer->Prime(CameraView())
+                                       : mChunkStreamer->Update(CameraView());
+        if (changed)
+            RebuildSortedTileRenderList();
+        UpdateDormantEnemies();
+    }
+
+    if (mRecording)
+        mRecording->Checkpoint(reg);
+    if (replaying)
+        mReplay->Verify(reg);
 }
 
 void GameScene::Render(Window& window, float alpha) {
@@ -748,16 +778,23 @@ void GameScene::Render(Window& window, float alpha) {
     const int W = window.GetWidth();
     const int H = window.GetHeight();
     if (levelComplete) {
-        RenderSystem(reg, ren, mCamera.x, mCamera.y, W, H, &mSortedTileRenderList, alpha);
-        HUDSystem(reg,
-                  ren,
-                  W,
-                  healthText.get(),
-                  gravityText.get(),
-                  coinText.get(),
-                  coinCount,
-                  stompText.get(),
-                  stompCount);
+        {
+            PROFILE_ZONE("RenderSystem");
+            RenderSystem(reg, ren, mCamera.x, mCamera.y, W, H, &mSortedTileRenderList, alpha,
+                         &mAnimTiles);
+        }
+        {
+            PROFILE_ZONE("HUDSystem");
+            HUDSystem(reg,
+                      ren,
+                      W,
+                      healthText.get(),
+                      gravityText.get(),
+                      coinText.get(),
+                      coinCount,
+                      stompText.get(),
+                      stompCount);
+        }
         if (levelCompleteText)
             levelCompleteText->Render(ren);
     } else if (gameOver) {
@@ -768,7 +805,11 @@ void GameScene::Render(Window& window, float alpha) {
     } else {
         locationText->Render(ren);
         actionText->Render(ren);
-        RenderSystem(reg, ren, mCamera.x, mCamera.y, W, H, &mSortedTileRenderList, alpha);
+        {
+            PROFILE_ZONE("RenderSystem");
+            RenderSystem(reg, ren, mCamera.x, mCamera.y, W, H, &mSortedTileRenderList, alpha,
+                         &mAnimTiles);
+        }
 
         // ── Debug hitbox overlay (F1) ─────────────────────────────────────
         if (mDebugHitboxes) {
@@ -877,19 +918,26 @@ void GameScene::Render(Window& window, float alpha) {
             hint.Render(ren);
         }
 
-        HUDSystem(reg,
-                  ren,
-                  W,
-                  healthText.get(),
-                  gravityText.get(),
-                  coinText.get(),
-                  coinCount,
-                  stompText.get(),
-                  stompCount);
+        {
+            PROFILE_ZONE("HUDSystem");
+            HUDSystem(reg,
+                      ren,
+                      W,
+                      healthText.get(),
+                      gravityText.get(),
+                      coinText.get(),
+                      coinCount,
+                      stompText.get(),
+                      stompCount);
+        }
     }
 
     if (mPaused)
         RenderPauseOverlay(window);
+#if FORGE2D_PROFILE
+    if (FrameProfiler::Get().OverlayVisible())
+        FrameProfiler::Get().DrawOverlay(ren, W);
+#endif
     window.Update();
 }
 
@@ -962,6 +1010,9 @@ void GameScene::RenderPauseOverlay(Window& window) {
 // ─────────────────────────────────────────────────────────────────────────────
 void GameScene::Spawn() {
     SDL_Renderer* ren = mWindow->GetRenderer();
+    // Phases only record during Load(); Respawn() passes through silently.
+    LoadReport& report = LoadReport::Get();
+    report.Phase("hud text", "text");
 
     healthText  = std::make_unique<Text>("100", SDL_Color{255, 255, 255, 255}, 0, 0, 16);
     gravityText = std::make_unique<Text>("", SDL_Color{100, 200, 255, 255}, 0, 0, 20);
@@ -970,6 +1021,7 @@ void GameScene::Spawn() {
     stompText = std::make_unique<Text>(
         "Enemies Stomped: 0", SDL_Color{255, 100, 100, 255}, 0, 0, 16);
 
+    report.Phase("coins", "coins");
     coinSheet =
         std::make_unique<SpriteSheet>("game_assets/gold_coins/", "Gold_", 30, 40, 40);
     coinSheet->CreateTexture(ren);
@@ -992,6 +1044,7 @@ void GameScene::Spawn() {
 
     totalCoins = (int)reg.view<CoinTag>().size();
 
+    report.Phase("player entity", "player");
     mLevelW = (float)mWindow->GetWidth();
     mLevelH = (float)mWindow->GetHeight();
     for (const auto& ts : mLevel.tiles) {
@@ -1007,6 +1060,10 @@ void GameScene::Spawn() {
         if (bottom > mLevelH)
             mLevelH = bottom;
     }
+    if (mLevel.IsChunked()) {
+        mLevelW = std::max(mLevelW, mLevel.chunking->boundsW);
+        mLevelH = std::max(mLevelH, mLevel.chunking->boundsH);
+    }
     mLevelW += (float)mWindow->GetWidth() * 0.25f;
     mLevelH += (float)mWindow->GetHeight() * 0.25f;
 
@@ -1015,11 +1072,8 @@ void GameScene::Spawn() {
     // actual collider rather than the hardcoded frost-knight defaults.
     int pColW, pColH, pROffX, pROffY;
     {
-        PlayerProfile tmpProfile;
-        bool          hasProfile =
-            !mProfilePath.empty() && LoadPlayerProfile(mProfilePath, tmpProfile);
         const AnimHitbox& idleHB =
-            hasProfile ? tmpProfile.Slot(PlayerAnimSlot::Idle).hitbox : AnimHitbox{};
+            mProfile ? mProfile->Slot(PlayerAnimSlot::Idle).hitbox : AnimHitbox{};
         if (!idleHB.IsDefault()) {
             pColW  = idleHB.w;
             pColH  = idleHB.h;
@@ -1089,13 +1143,11 @@ void GameScene::Spawn() {
         base.standRoffY = pROffY;
 
         // Load all per-animation hitboxes from the profile.
-        PlayerProfile hbProfile;
-        bool hasHBProfile =
-            !mProfilePath.empty() && LoadPlayerProfile(mProfilePath, hbProfile);
+        const bool hasHBProfile = mProfile != nullptr;
 
         // Crouch hitbox
         const AnimHitbox& crouchHB =
-            hasHBProfile ? hbProfile.Slot(PlayerAnimSlot::Crouch).hitbox : AnimHitbox{};
+            hasHBProfile ? mProfile->Slot(PlayerAnimSlot::Crouch).hitbox : AnimHitbox{};
         if (!crouchHB.IsDefault()) {
             base.duckW     = crouchHB.w;
             base.duckH     = crouchHB.h;
@@ -1115,11 +1167,11 @@ void GameScene::Spawn() {
         };
 
         if (hasHBProfile) {
-            base.walk  = toAnimCol(hbProfile.Slot(PlayerAnimSlot::Walk).hitbox);
-            base.jump  = toAnimCol(hbProfile.Slot(PlayerAnimSlot::Jump).hitbox);
-            base.fall  = toAnimCol(hbProfile.Slot(PlayerAnimSlot::Fall).hitbox);
-            base.slash = toAnimCol(hbProfile.Slot(PlayerAnimSlot::Slash).hitbox);
-            base.hurt  = toAnimCol(hbProfile.Slot(PlayerAnimSlot::Hurt).hitbox);
+            base.walk  = toAnimCol(mProfile->Slot(PlayerAnimSlot::Walk).hitbox);
+            base.jump  = toAnimCol(mProfile->Slot(PlayerAnimSlot::Jump).hitbox);
+            base.fall  = toAnimCol(mProfile->Slot(PlayerAnimSlot::Fall).hitbox);
+            base.slash = toAnimCol(mProfile->Slot(PlayerAnimSlot::Slash).hitbox);
+            base.hurt  = toAnimCol(mProfile->Slot(PlayerAnimSlot::Hurt).hitbox);
         }
 
         reg.emplace<PlayerBaseCollider>(player, base);
@@ -1156,27 +1208,24 @@ void GameScene::Spawn() {
     //     be idleT so the sheet and frames always refer to the same atlas.
     //   - If the profile does have custom sprites, use the loaded slot texture.
     //   - If no profile is active, use the frost-knight slot texture as-is.
-    // Pre-load profile once to know which slots have real custom sprites.
+    // Collect which slots have real custom sprites (from the profile held since Load()).
     // resolveSheet() uses this to decide whether a slot should use idleSheet
     // (no custom sprites -> frames were patched to idleFrames in Load()) or
     // the slot's own texture (custom sprites exist -> frames are custom).
     // This replaces the old pointer-identity check (&slotFrames==&idleFrames)
     // which broke because Load() patches by *copying* idleFrames, not aliasing.
     std::unordered_set<int> customSlots;
-    if (mHasProfile) {
-        PlayerProfile spawnProfile;
-        if (!mProfilePath.empty() && LoadPlayerProfile(mProfilePath, spawnProfile)) {
-            for (int i = 0; i < PLAYER_ANIM_SLOT_COUNT; ++i) {
-                auto s = static_cast<PlayerAnimSlot>(i);
-                if (spawnProfile.HasSlot(s))
-                    customSlots.insert(i);
-            }
+    if (mProfile) {
+        for (int i = 0; i < PLAYER_ANIM_SLOT_COUNT; ++i) {
+            auto s = static_cast<PlayerAnimSlot>(i);
+            if (mProfile->HasSlot(s))
+                customSlots.insert(i);
         }
     }
     auto resolveSheet = [&](SDL_Texture* slotTex, PlayerAnimSlot slot) -> SDL_Texture* {
         // If the profile has no custom sprites for this slot, its frames were
         // patched to idleFrames in Load() — return idleT so sheet+frames match.
-        if (mHasProfile && !customSlots.count(static_cast<int>(slot)))
+        if (mProfile && !customSlots.count(static_cast<int>(slot)))
             return idleT;
         return slotTex;
     };
@@ -1207,214 +1256,39 @@ void GameScene::Spawn() {
             .slashFps   = slotFps(PlayerAnimSlot::Slash),
         });
 
-    // Cache-aware tile texture helper.
-    // On first Spawn: loads from disk, uploads to GPU, caches the pointer.
-    // On subsequent Spawn() calls (Respawn): returns the cached GPU texture instantly.
-    auto getCachedTex =
-        [&](const std::string& path, int w, int h, int rot = 0) -> SDL_Texture* {
-        std::string key = TileCacheKey(path, w, h, rot);
-        auto        it  = tileTextureCache.find(key);
-        if (it != tileTextureCache.end())
-            return it->second;
-        SDL_Texture* tex = LoadScaledTexture(ren, path, w, h, rot);
-        if (tex) {
-            tileScaledTextures.push_back(tex);
-            tileTextureCache[key] = tex;
-        }
-        return tex;
+    // Level tile textures are normally already warm from the streaming parse
+    // in Load(); on Respawn() every lookup is a cache hit.
+    auto getCachedTex = [&](const std::string& path, int rot) -> SDL_Texture* {
+        return mTileTextures.Get(ren, path, rot);
     };
 
     // ── Spawn tiles ───────────────────────────────────────────────────────────
-    for (const auto& ts : mLevel.tiles) {
-        if (IsAnimatedTile(ts.imagePath)) {
-            AnimatedTileDef def;
-            if (!LoadAnimatedTileDef(ts.imagePath, def) || def.framePaths.empty()) {
-                std::print("Failed to load animated tile def: {}\n", ts.imagePath);
-                continue;
-            }
-
-            // Each animation frame gets its own cache entry so they're reused
-            // across Respawn() calls without hitting disk again.
-            std::vector<SDL_Texture*> frameTex;
-            for (const auto& fp : def.framePaths)
-                frameTex.push_back(getCachedTex(fp, ts.w, ts.h, ts.rotation));
-            if (frameTex.empty() || !frameTex[0])
-                continue;
-
-            // Build frame rects from the native-resolution textures.
-            // Each animated frame is its own texture, so src = full texture.
-            std::vector<SDL_Rect> frameRects;
-            frameRects.reserve(frameTex.size());
-            for (auto* ft : frameTex) {
-                float ftW = 0, ftH = 0;
-                if (ft) SDL_GetTextureSize(ft, &ftW, &ftH);
-                frameRects.push_back({0, 0, (int)ftW, (int)ftH});
-            }
-            auto                  tile = reg.create();
-            reg.emplace<Transform>(tile, ts.x, ts.y);
-
-            bool hasCustomHitbox = ts.HasHitbox();
-            int  colW = hasCustomHitbox ? (ts.hitbox->w > 0 ? ts.hitbox->w : ts.w) : ts.w;
-            int  colH = hasCustomHitbox ? (ts.hitbox->h > 0 ? ts.hitbox->h : ts.h) : ts.h;
-
-            if (ts.ladder)
-                reg.emplace<LadderTag>(tile);
-            else if (ts.HasSlope()) {
-                reg.emplace<TileTag>(tile);
-                reg.emplace<SlopeCollider>(tile, ts.slope->type, ts.slope->heightFrac);
-            } else if (ts.hazard) {
-                reg.emplace<HazardTag>(tile);
-                if (!ts.prop)
-                    reg.emplace<TileTag>(tile);
-            } else if (!ts.prop)
-                reg.emplace<TileTag>(tile);
-            if (ts.prop)
-                reg.emplace<PropTag>(tile);
-            if (ts.HasAction())
-                reg.emplace<ActionTag>(tile,
-                                       ts.action->group,
-                                       ts.action->hitsRequired,
-                                       ts.action->hitsRequired,
-                                       ts.action->destroyAnimPath);
-            if (!ts.prop || ts.hazard)
-                reg.emplace<Collider>(tile, colW, colH);
-            if (hasCustomHitbox)
-                reg.emplace<ColliderOffset>(tile, ts.hitbox->offX, ts.hitbox->offY);
-
-            reg.emplace<TileAnimTag>(tile);
-            reg.emplace<Renderable>(tile, frameTex[0], std::move(frameRects), false, ts.w, ts.h);
-            reg.emplace<AnimationState>(tile, 0, (int)frameTex.size(), 0.0f, def.fps, true);
-            tileAnimFrameMap[tile] = std::move(frameTex);
-            continue;
-        }
-
-        // ── Normal PNG tile ────────────────────────────────────────────────
-        // Use cache: on Respawn this returns the already-uploaded GPU texture
-        // without touching disk or the CPU scaling pipeline.
-        SDL_Texture* tex = getCachedTex(ts.imagePath, ts.w, ts.h, ts.rotation);
-        if (!tex)
-            continue;
-
-        auto tile = reg.create();
-        reg.emplace<Transform>(tile, ts.x, ts.y);
-
-        bool hasCustomHitbox = ts.HasHitbox();
-        int  colW            = hasCustomHitbox ? (ts.hitbox->w > 0 ? ts.hitbox->w : ts.w) : ts.w;
-        int  colH            = hasCustomHitbox ? (ts.hitbox->h > 0 ? ts.hitbox->h : ts.h) : ts.h;
-
-        if (ts.ladder) {
-            reg.emplace<LadderTag>(tile);
-            reg.emplace<Collider>(tile, colW, colH);
-        } else if (ts.HasSlope()) {
-            reg.emplace<TileTag>(tile);
-            reg.emplace<Collider>(tile, colW, colH);
-            reg.emplace<SlopeCollider>(tile, ts.slope->type, ts.slope->heightFrac);
-        } else if (ts.hazard) {
-            reg.emplace<HazardTag>(tile);
-            reg.emplace<Collider>(tile, colW, colH);
-            if (!ts.prop)
-                reg.emplace<TileTag>(tile);
-        } else {
-            reg.emplace<Collider>(tile, colW, colH);
-            if (!ts.prop)
-                reg.emplace<TileTag>(tile);
-        }
-        if (ts.prop)
-            reg.emplace<PropTag>(tile);
-        if (ts.HasAction())
-            reg.emplace<ActionTag>(
-                tile, ts.action->group, ts.action->hitsRequired, ts.action->hitsRequired, ts.action->destroyAnimPath);
-
-        if (ts.antiGravity) {
-            reg.emplace<FloatTag>(tile);
-            FloatState fs;
-            fs.baseY    = ts.y;
-            fs.bobAmp   = 4.0f + (rand() % 50) * 0.08f;
-            fs.bobSpeed = 1.4f + (rand() % 80) * 0.01f;
-            fs.bobPhase = (rand() % 628) * 0.01f;
-            reg.emplace<FloatState>(tile, fs);
-        }
-        if (ts.HasMoving()) {
-            const auto& mp = *ts.moving;
-            // Moving platforms need PrevTransform so RenderSystem can
-            // interpolate their draw position between physics ticks.
-            if (!reg.all_of<PrevTransform>(tile))
-                reg.emplace<PrevTransform>(tile, ts.x, ts.y);
-            reg.emplace<MovingPlatformTag>(tile);
-            MovingPlatformState mps;
-            mps.horiz     = mp.horiz;
-            mps.range     = mp.range;
-            mps.speed     = mp.speed;
-            mps.groupId   = mp.groupId;
-            mps.originX   = ts.x;
-            mps.originY   = ts.y;
-            mps.loop      = mp.loop;
-            mps.trigger   = mp.trigger;
-            mps.triggered = false;
-            if (mp.loop) {
-                mps.phase   = mp.phase * mp.range;
-                mps.loopDir = mp.loopDir;
-                if (mp.horiz)
-                    reg.get<Transform>(tile).x = ts.x + mps.phase;
-            } else {
-                mps.phase   = mp.phase * 6.28318f;
-                mps.loopDir = 1;
-            }
-            reg.emplace<MovingPlatformState>(tile, mps);
-        }
-        if (hasCustomHitbox)
-            reg.emplace<ColliderOffset>(tile, ts.hitbox->offX, ts.hitbox->offY);
-        if (ts.HasPowerUp() && !ts.powerUp->type.empty()) {
-            PowerUpType puType = PowerUpType::None;
-            if (ts.powerUp->type == "antigravity")
-                puType = PowerUpType::AntiGravity;
-            // Future: else if (ts.powerUp->type == "speedboost") puType =
-            // PowerUpType::SpeedBoost;
-            if (puType != PowerUpType::None)
-                reg.emplace<PowerUpTag>(tile, puType, ts.powerUp->duration);
-        }
-
-        // Source rect covers the full native-resolution texture.
-        // RenderSystem draws it into a dst rect of ts.w x ts.h — the GPU
-        // handles the scale with PIXELART mode for crisp results.
-        float texW = 0, texH = 0;
-        SDL_GetTextureSize(tex, &texW, &texH);
-        std::vector<SDL_Rect> tileFrame = {{0, 0, (int)texW, (int)texH}};
-        reg.emplace<Renderable>(tile, tex, tileFrame, false, ts.w, ts.h);
-        reg.emplace<AnimationState>(tile, 0, 1, 0.0f, 1.0f, false);
-    }
+    // Always-resident tiles. A chunked level's streamed tiles are spawned by
+    // mChunkStreamer further down.
+    report.Phase("tiles", "tiles");
+    for (const auto& ts : mLevel.tiles)
+        SpawnTile(ts, getCachedTex);
 
     // ── Spawn enemies ─────────────────────────────────────────────────────────
-    // Cache loaded enemy profile sprite sheets by type name so multiple enemies
-    // of the same type share the same GPU texture.
-    struct EnemyTypeCache {
-        SpriteSheet* idleSheet = nullptr;
-        std::vector<SDL_Rect> idleFrames;
-        SpriteSheet* moveSheet = nullptr;
-        std::vector<SDL_Rect> moveFrames;
-        float moveFps = 7.0f;
-        SpriteSheet* attackSheet = nullptr;
-        std::vector<SDL_Rect> attackFrames;
-        float attackFps = 10.0f;
-        SpriteSheet* hurtSheet = nullptr;
-        std::vector<SDL_Rect> hurtFrames;
-        float hurtFps = 8.0f;
-        SpriteSheet* deadSheet = nullptr;
-        std::vector<SDL_Rect> deadFrames;
-        float deadFps = 6.0f;
-        int spriteW = 40, spriteH = 40;
-        float health = 30.0f;
-    };
-    std::unordered_map<std::string, std::shared_ptr<EnemyTypeCache>> enemyTypeCache;
-    mEnemySpriteSheets.clear();  // clear from previous Spawn (Respawn path)
-
+    // Enemy type assets live in mEnemyTypeCache: multiple enemies of the same
+    // type share the same GPU texture, and Respawn() reuses them without
+    // touching the profile JSON or sprite PNGs again.
+    report.Phase("enemies", "enemies");
     auto getEnemyTypeCache = [&](const std::string& typeName) -> std::shared_ptr<EnemyTypeCache> {
-        auto it = enemyTypeCache.find(typeName);
-        if (it != enemyTypeCache.end()) return it->second;
+        auto it = mEnemyTypeCache.find(typeName);
+        if (it != mEnemyTypeCache.end()) return it->second;
 
-        EnemyProfile prof;
-        if (!LoadEnemyProfile(EnemyProfilePath(typeName), prof))
+        // Missing / broken types are cached as nullptr so they aren't retried.
+        std::shared_ptr<const EnemyProfile> profPtr;
+        {
+            LoadReport::Timer parse(LoadReport::Parse);
+            profPtr = GetEnemyProfile(EnemyProfilePath(typeName));
+        }
+        if (!profPtr) {
+            mEnemyTypeCache[typeName] = nullptr;
             return nullptr;
+        }
+        const EnemyProfile& prof = *profPtr;
 
         auto tc = std::make_shared<EnemyTypeCache>();
         tc->spriteW = (prof.spriteW > 0) ? prof.spriteW : 40;
@@ -1427,10 +1301,15 @@ void GameScene::Spawn() {
             const auto& dir = prof.Slot(slot).folderPath;
             std::vector<fs::path> pngs;
             std::error_code ec;
-            if (fs::is_directory(dir, ec) && !ec) {
-                for (const auto& e : fs::directory_iterator(dir, ec))
-                    if (!ec && (e.path().extension() == ".png" || e.path().extension() == ".PNG"))
-                        pngs.push_back(e.path());
+            {
+                LoadReport::Timer scan(LoadReport::Scan);
+                if (fs::is_directory(dir, ec) && !ec) {
+                    for (const auto& e : fs::directory_iterator(dir, ec)) {
+                        const auto ext = e.path().extension();
+                        if (!ec && (ext == ".png" || ext == ".PNG"))
+                            pngs.push_back(e.path());
+                    }
+                }
             }
             if (pngs.empty()) return {nullptr, {}};
             std::sort(pngs.begin(), pngs.end());
@@ -1487,18 +1366,12 @@ void GameScene::Spawn() {
             }
         }
 
-        enemyTypeCache[typeName] = tc;
+        mEnemyTypeCache[typeName] = tc;
         return tc;
     };
 
     for (const auto& es : mLevel.enemies) {
-        float speed = es.speed;
-        float dx    = es.startLeft ? -speed : speed;
-        auto  enemy = reg.create();
-        reg.emplace<Transform>(enemy, es.x, es.y);
-        reg.emplace<PrevTransform>(enemy, es.x, es.y);
-        reg.emplace<Velocity>(enemy, dx, 0.0f, speed);
-        reg.emplace<EnemyTag>(enemy);
+        auto enemy = SpawnEnemyEntity(reg, es);
 
         // Try loading custom enemy profile
         bool usedProfile = false;
@@ -1556,44 +1429,162 @@ void GameScene::Spawn() {
             eh.max     = SLIME_MAX_HEALTH;
             reg.emplace<Health>(enemy, eh);
         }
+    }
 
-        if (es.antiGravity) {
-            reg.emplace<FloatTag>(enemy);
-            FloatState fs;
-            fs.baseY    = es.y;
-            fs.bobAmp   = 5.0f + (rand() % 40) * 0.1f;
-            fs.bobSpeed = 1.6f + (rand() % 60) * 0.01f;
-            fs.bobPhase = (rand() % 628) * 0.01f;
-            reg.emplace<FloatState>(enemy, fs);
-        }
+    // ── Streamed chunks ───────────────────────────────────────────────────────
+    // Respawn() cleared the registry, so the streamer's entity lists are stale.
+    // Prime synchronously spawns the chunks around the starting camera.
+    if (mChunkStreamer) {
+        report.Phase("chunks", "chunks");
+        mChunkStreamer->ResetSpawned();
+        mChunkStreamer->Prime(CameraView());
+        UpdateDormantEnemies();
     }
 
-    // Build the pre-sorted tile render list used by RenderSystem Pass 1.
-    // Tile entity IDs are stable for the lifetime of Spawn() -- they are never
-    // re-created mid-level, only destroyed (action tiles). RenderSystem uses
-    // this list instead of building+sorting a vector on every frame.
     // We rebuild it here on each Spawn() because Respawn() clears the registry.
-    {
-        mSortedTileRenderList.clear();
-        auto tv = reg.view<TileTag, AnimationState, Renderable>();
-        auto lv = reg.view<LadderTag, AnimationState, Renderable>();
-        auto pv = reg.view<PropTag, AnimationState, Renderable>();
-        mSortedTileRenderList.reserve(tv.size_hint() + lv.size_hint() + pv.size_hint());
-        for (auto e : tv)
-            mSortedTileRenderList.push_back(e);
-        for (auto e : lv)
-            mSortedTileRenderList.push_back(e);
-        for (auto e : pv)
-            mSortedTileRenderList.push_back(e);
-        std::sort(mSortedTileRenderList.begin(), mSortedTileRenderList.end());
+    report.Phase("tile render list", "other");
+    RebuildSortedTileRenderList();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Build the pre-sorted tile render list used by RenderSystem Pass 1.
+// Tile entity IDs are stable between rebuilds -- they are only destroyed
+// (action tiles, which Update() erases from the list) or, for chunked levels,
+// created/destroyed in batches by mChunkStreamer, which triggers a rebuild.
+// RenderSystem uses this list instead of building+sorting a vector every frame.
+// ─────────────────────────────────────────────────────────────────────────────
+void GameScene::RebuildSortedTileRenderList() {
+    mSortedTileRenderList.clear();
+    auto tv = reg.view<TileTag, AnimationState, Renderable>();
+    auto lv = reg.view<LadderTag, AnimationState, Renderable>();
+    auto pv = reg.view<PropTag, AnimationState, Renderable>();
+    mSortedTileRenderList.reserve(tv.size_hint() + lv.size_hint() + pv.size_hint());
+    for (auto e : tv)
+        mSortedTileRenderList.push_back(e);
+    for (auto e : lv)
+        mSortedTileRenderList.push_back(e);
+    for (auto e : pv)
+        mSortedTileRenderList.push_back(e);
+    std::sort(mSortedTileRenderList.begin(), mSortedTileRenderList.end());
+}
+
+// Chunked levels spawn every enemy up front, but only the tiles around the
+// camera. An enemy whose chunk is not spawned would fall, or walk through
+// walls that aren't there, so it sleeps until the chunk streams in.
+void GameScene::UpdateDormantEnemies() {
+    auto view = reg.view<EnemyTag, Transform, Collider>();
+    for (auto e : view) {
+        const auto& [t, c] = view.get<Transform, Collider>(e);
+        const bool dormant = mChunkStreamer->Unspawned(t.x + c.w * 0.5f, t.y + c.h * 0.5f);
+        if (dormant == reg.all_of<DormantTag>(e))
+            continue;
+        if (dormant)
+            reg.emplace<DormantTag>(e);
+        else
+            reg.remove<DormantTag>(e);
+    }
+}
+
+SDL_FRect GameScene::CameraView() const {
+    return {mCamera.x, mCamera.y, (float)mWindow->GetWidth(), (float)mWindow->GetHeight()};
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// SpawnTile — creates the entity (tags, collider, render data) for one tile.
+// getTex resolves an image path to a GPU texture; the caller decides who owns
+// it (level cache for whole levels, ChunkStreamer for streamed chunks).
+// Animated tiles bypass getTex and share an atlas from mAnimTiles.
+// Returns entt::null if the tile's image could not be loaded.
+// ─────────────────────────────────────────────────────────────────────────────
+entt::entity GameScene::SpawnTile(const TileSpawn& ts, const TileTextureFn& getTex) {
+    if (IsAnimatedTile(ts.imagePath)) {
+        // One shared atlas per manifest; the entity only stores its id.
+        const int   animId = mAnimTiles.Acquire(mWindow->GetRenderer(), ts.imagePath,
+                                                ts.rotation);
+        const auto* anim   = mAnimTiles.Get(animId);
+        if (!anim)
+            return entt::null;
+
+        auto tile = reg.create();
+        reg.emplace<Transform>(tile, ts.x, ts.y);
+
+        bool hasCustomHitbox = ts.HasHitbox();
+        int  colW = hasCustomHitbox ? (ts.hitbox->w > 0 ? ts.hitbox->w : ts.w) : ts.w;
+        int  colH = hasCustomHitbox ? (ts.hitbox->h > 0 ? ts.hitbox->h : ts.h) : ts.h;
+
+        if (ts.ladder)
+            reg.emplace<LadderTag>(tile);
+        else if (ts.HasSlope()) {
+            reg.emplace<TileTag>(tile);
+            reg.emplace<SlopeCollider>(tile, ts.slope->type, ts.slope->heightFrac);
+        } else if (ts.hazard) {
+            reg.emplace<HazardTag>(tile);
+            if (!ts.prop)
+                reg.emplace<TileTag>(tile);
+        } else if (!ts.prop)
+            reg.emplace<TileTag>(tile);
+        if (ts.prop)
+            reg.emplace<PropTag>(tile);
+        if (ts.HasAction())
+            reg.emplace<ActionTag>(tile,
+                                   ts.action->group,
+                                   ts.action->hitsRequired,
+                                   ts.action->hitsRequired,
+                                   ts.action->destroyAnimPath);
+        AttachDestroyAnim(tile, ts);
+        if (!ts.prop || ts.hazard)
+            reg.emplace<Collider>(tile, colW, colH);
+        if (hasCustomHitbox)
+            reg.emplace<ColliderOffset>(tile, ts.hitbox->offX, ts.hitbox->offY);
+
+        // Renderable/AnimationState stay a static first frame so the tile views
+        // (sorted render list, culling) match; RenderSystem draws the frame the
+        // library clock selects via AnimatedTileRef.
+        reg.emplace<TileAnimTag>(tile);
+        reg.emplace<AnimatedTileRef>(tile, animId, 0.0f, true, 0.0);
+        reg.emplace<Renderable>(
+            tile, anim->atlas, std::vector<SDL_Rect>{anim->frames[0]}, false, ts.w, ts.h);
+        reg.emplace<AnimationState>(tile, 0, 1, 0.0f, 1.0f, false);
+        return tile;
     }
+
+    // ── Normal PNG tile ────────────────────────────────────────────────
+    // Use cache: on Respawn this returns the already-uploaded GPU texture
+    // without touching disk or the CPU scaling pipeline.
+    SDL_Texture* tex = getTex(ts.imagePath, ts.rotation);
+    if (!tex)
+        return entt::null;
+
+    auto tile = SpawnTileEntity(reg, ts);
+    AttachDestroyAnim(tile, ts);
+
+    // Source rect covers the full native-resolution texture.
+    // RenderSystem draws it into a dst rect of ts.w x ts.h — the GPU
+    // handles the scale with PIXELART mode for crisp results.
+    float texW = 0, texH = 0;
+    SDL_GetTextureSize(tex, &texW, &texH);
+    std::vector<SDL_Rect> tileFrame = {{0, 0, (int)texW, (int)texH}};
+    reg.emplace<Renderable>(tile, tex, tileFrame, false, ts.w, ts.h);
+    reg.emplace<AnimationState>(tile, 0, 1, 0.0f, 1.0f, false);
+    return tile;
+}
+
+// Prefetch pass for action tiles: resolves the tile's destroy animation into
+// the shared library now, so breaking it later costs no I/O. For streamed
+// chunks the worker has normally stitched and the streamer uploaded it
+// already, and this is a lookup.
+void GameScene::AttachDestroyAnim(entt::entity tile, const TileSpawn& ts) {
+    if (!ts.HasAction() || ts.action->destroyAnimPath.empty())
+        return;
+    int animId = mAnimTiles.Acquire(mWindow->GetRenderer(), ts.action->destroyAnimPath);
+    if (animId >= 0)
+        reg.emplace<DestroyAnimRef>(tile, animId);
 }
 
 void GameScene::Respawn() {
     reg.clear();
-    tileAnimFrameMap.clear();
     mSortedTileRenderList.clear();
-    // tileScaledTextures and tileTextureCache are intentionally NOT cleared here.
+    // mTileTextures is intentionally NOT cleared here.
     // All tile textures are already uploaded to the GPU and can be reused as-is.
     // They are only freed in Unload() when the scene is torn down entirely.
     gameOver           = false;
@@ -1602,5 +1593,53 @@ void GameScene::Respawn() {
     coinCount          = 0;
     stompCount         = 0;
     mCamera            = Camera{};
+    BeginLife();
     Spawn();
 }
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Input and replays
+// ─────────────────────────────────────────────────────────────────────────────
+void GameScene::PlayReplay(Replay replay) {
+    mRecording.reset();
+    mReplay = std::make_unique<ReplayPlayer>(std::move(replay));
+}
+
+InputFrame GameScene::NextInput() {
+    InputFrame live = mInput.Next();
+    if (mReplay && !mReplay->Finished())
+        return mReplay->Next(); // live keys are dropped while a replay plays
+    return live;
+}
+
+// Spawn() draws float bob phases from rand(), so every life starts from a
+// known seed and a replay rebuilds the same world. A replay covers one life:
+// a respawn hands control back to the keyboard. With --record the previous
+// life is saved and a new recording starts here.
+void GameScene::BeginLife() {
+    SaveRecording();
+    if (mReplay && mReplay->Tick() == 0) {
+        srand(mReplay->Data().seed);
+        return;
+    }
+    mReplay.reset();
+    mFastForward = false;
+    if (!RecordReplays() || mLevelPath.empty() || !mWindow)
+        return;
+    mRecording              = std::make_unique<Replay>();
+    mRecording->levelPath   = mLevelPath;
+    mRecording->profilePath = mProfilePath;
+    mRecording->seed        = (Uint32)SDL_GetPerformanceCounter();
+    mRecording->viewW       = mWindow->GetWidth();
+    mRecording->viewH       = mWindow->GetHeight();
+    srand(mRecording->seed);
+}
+
+void GameScene::SaveRecording() {
+    std::unique_ptr<Replay> rec = std::move(mRecording);
+    if (!rec || rec->frames.empty())
+        return;
+    const std::string path = NewReplayPath(rec->levelPath);
+    if (SaveReplay(path, *rec))
+        std::print("[Replay] saved {} ticks to {}\n", rec->frames.size(), path);
+}
@@ -1,4 +1,7 @@
 #include "Image.hpp"
+#include "SurfaceUtils.hpp"
+#include "TextureRegistry.hpp"
+#include "TraceRecorder.hpp"
 #include <SDL3_image/SDL_image.h>
 #include <algorithm>
 #include <cmath>
@@ -10,7 +13,8 @@
 
 Image::Image(std::string File, FitMode mode)
     : mFitMode(mode) {
-    mPendingSurface = IMG_Load(File.c_str());
+    TRACE_SCOPE("asset", "Image load", File);
+    mPendingSurface = LoadImageFile(File);
     if (!mPendingSurface) {
         std::print("Failed to load image: {}\n{}\n", File, SDL_GetError());
         return;
@@ -31,7 +35,7 @@ Image::Image(SDL_Surface* surface, FitMode mode)
 }
 
 Image::~Image() {
-    if (mTexture)        SDL_DestroyTexture(mTexture);
+    if (mTexture)        TextureRegistry::Get().Destroy(mTexture);
     if (mPendingSurface) SDL_DestroySurface(mPendingSurface);
 }
 
@@ -50,7 +54,7 @@ Image::Image(Image&& o) noexcept
 
 Image& Image::operator=(Image&& o) noexcept {
     if (this != &o) {
-        if (mTexture)        SDL_DestroyTexture(mTexture);
+        if (mTexture)        TextureRegistry::Get().Destroy(mTexture);
         if (mPendingSurface) SDL_DestroySurface(mPendingSurface);
         mPendingSurface    = o.mPendingSurface;
         mTexture           = o.mTexture;
@@ -72,7 +76,8 @@ Image& Image::operator=(Image&& o) noexcept {
 
 void Image::UploadSurface(SDL_Renderer* renderer) {
     if (!mPendingSurface) return;
-    mTexture = SDL_CreateTextureFromSurface(renderer, mPendingSurface);
+    TRACE_SCOPE("gpu", "Image upload");
+    mTexture = TextureRegistry::Get().CreateFromSurface(renderer, mPendingSurface, "image");
     if (!mTexture)
         std::print("Image: failed to create texture: {}\n", SDL_GetError());
     SDL_DestroySurface(mPendingSurface);
@@ -148,6 +153,7 @@ void Image::Render(SDL_Renderer* renderer) {
     SDL_FRect dst = ComputeDest(rw, rh);
 
     SDL_FlipMode flip = mFlipH ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
+    TextureRegistry::Get().Touch(mTexture);
     SDL_RenderTextureRotated(renderer, mTexture, nullptr, &dst, 0.0, nullptr, flip);
 }
 
@@ -201,6 +207,7 @@ static void ScrollHelper(SDL_Renderer* renderer, SDL_Texture* texture,
     const float imgW = static_cast<float>(origW);
     const float imgH = static_cast<float>(origH);
     if (imgW < 1.f || imgH < 1.f || vpW < 1.f || vpH < 1.f) return;
+    TextureRegistry::Get().Touch(texture);
 
     // COVER-fit: always fill the viewport. No black bars ever.
     float scale = std::max(vpW / imgW, vpH / imgH);
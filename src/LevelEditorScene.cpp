@@ -6,9 +6,11 @@
 #include "EditorUIRenderer.hpp"
 #include "GameScene.hpp"
 #include "SurfaceUtils.hpp"
+#include "TextureRegistry.hpp"
 #include "TitleScene.hpp"
 #include <SDL3_ttf/SDL_ttf.h>
 #include <climits>
+#include <numeric>
 #include <print>
 
 namespace fs = std::filesystem;
@@ -22,10 +24,24 @@ static SDL_Surface* LoadPNG(const fs::path& p) {
     return EditorSurfaceCache::LoadPNG(p);
 }
 
+// One-line surface cache report (F3 status line, printed on Unload).
+static std::string DescribeSurfaceCache(const EditorSurfaceCache::Stats& st) {
+    constexpr double MiB = 1024.0 * 1024.0;
+    char             buf[160];
+    SDL_snprintf(buf, sizeof(buf),
+                 "Surface cache: %.1f/%.0f MiB, %d tiles + %d rotations + %d mips, "
+                 "%llu hits / %llu misses, %llu evicted",
+                 st.residentBytes / MiB, st.budgetBytes / MiB, st.tiles, st.rotations,
+                 st.mips, (unsigned long long)st.hits, (unsigned long long)st.misses,
+                 (unsigned long long)st.evictions);
+    return buf;
+}
+
 // --- MakePopupCtx ----------------------------------------------------------
 EditorPopups::Ctx LevelEditorScene::MakePopupCtx() {
     return EditorPopups::Ctx{
         .level            = mLevel,
+        .history          = mHistory,
         .palette          = mPalette,
         .setStatus        = [this](const std::string& msg) { SetStatus(msg); },
         .refreshTileView  = [this]() { LoadTileView(mPalette.CurrentDir()); },
@@ -113,6 +129,9 @@ void LevelEditorScene::Load(Window& window) {
     SDL_SetHint(SDL_HINT_MOUSE_AUTO_CAPTURE, "0");
     SDL_SetHint("SDL_MOUSE_TOUCH_EVENTS", "0");
 
+    // Canvas textures are keyed by their source surface; free them together.
+    mSurfaceCache.SetOnFree([this](const SDL_Surface* s) { mTextures.Forget(s); });
+
     background = std::make_unique<Image>("game_assets/backgrounds/deepspace_scene.png",
                                          FitModeFromString(mLevel.bgFitMode));
     coinSheet  = std::make_unique<SpriteSheet>(
@@ -139,6 +158,8 @@ void LevelEditorScene::Load(Window& window) {
         if (fs::exists(autoPath)) {
             LoadLevel(autoPath, mLevel);
             SetStatus("Resumed: " + autoPath);
+            for (const auto& en : mLevel.enemies)
+                mEnemyTypes.Warm(en.enemyType);
             if (!mLevel.background.empty()) {
                 background = std::make_unique<Image>(mLevel.background,
                                                      FitModeFromString(mLevel.bgFitMode));
@@ -175,9 +196,9 @@ void LevelEditorScene::Load(Window& window) {
         }
     }
 
-    // Initialize the palette subsystem with the shared surface cache and
-    // folder icon, then load tile and background palettes.
-    mPalette.Init(mSurfaceCache, mFolderIcon);
+    // Initialize the palette subsystem (starts its thumbnail worker) with the
+    // shared folder icon, then load tile and background palettes.
+    mPalette.Init(mFolderIcon);
     LoadTileView(TILE_ROOT);
     LoadBgPalette();
 
@@ -223,8 +244,25 @@ void LevelEditorScene::Unload() {
         mFolderIcon = nullptr;
     }
 
-    // Free all cached surfaces (rotation, badge, destroy-anim, tile, extra)
+    // Free all cached surfaces (tile + rotation, badge, destroy-anim)
+    std::print("[Editor] {}\n", DescribeSurfaceCache(mSurfaceCache.GetStats()));
     mSurfaceCache.Clear();
+    mEnemyTypes.Clear();
+    mSpatial.MarkDirty();
+    mMinimap.Clear();
+    mMinimapDrag = false;
+    mHistory.Clear();
+
+    // GPU side: canvas textures and the overlay target
+    mTextures.Clear();
+    if (mOverlayTex) {
+        TextureRegistry::Get().Destroy(mOverlayTex);
+        mOverlayTex = nullptr;
+    }
+    if (mOverlaySurface) {
+        SDL_DestroySurface(mOverlaySurface);
+        mOverlaySurface = nullptr;
+    }
 
     mWindow = nullptr;
 }
@@ -234,6 +272,53 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
     if (e.type == SDL_EVENT_QUIT)
         return false;
 
+    // Tools, popups, drops and hotkeys all edit mLevel in place, recording
+    // each edit in mHistory first. If this event recorded any, the hit-test
+    // index is rebuilt on its next query; panning, zooming and clicks that
+    // changed nothing leave it alone.
+    //
+    // The same events are bracketed in an undo transaction. It is committed
+    // on the way out unless a button is down: a press-drag-release is one
+    // undo step, closed by the release. Wheel edits of the same kind merge.
+    const bool passive = e.type == SDL_EVENT_MOUSE_MOTION && e.motion.state == 0;
+    const bool holding = e.type == SDL_EVENT_MOUSE_BUTTON_DOWN ||
+                         (e.type == SDL_EVENT_MOUSE_MOTION && e.motion.state != 0);
+    if (!passive)
+        mHistory.Begin(mTool ? mTool->Name() : "Edit", e.type == SDL_EVENT_MOUSE_WHEEL);
+    struct EditGuard {
+        LevelEditorScene* scene;
+        bool              commit;
+        ~EditGuard() {
+            if (!scene)
+                return;
+            if (scene->mHistory.Edits() != scene->mSyncedEdits) {
+                scene->mSyncedEdits = scene->mHistory.Edits();
+                scene->mSpatial.MarkDirty();
+                scene->mMinimap.MarkDirty();
+            }
+            if (commit)
+                scene->mHistory.Commit(scene->mLevel);
+        }
+    } editGuard{passive ? nullptr : this, !holding};
+
+    // Damage: a button-less move only changes hover feedback in the region it
+    // leaves and the one it enters (popups can straddle regions, so any open
+    // one widens it to everything). Every other event may have changed
+    // anything on screen.
+    if (passive && !mPopups.AnyModalOpen() && !mPopups.movPlatOpen) {
+        int mx = (int)e.motion.x, my = (int)e.motion.y;
+        mDamage.Add(DamageRegionAt(mDamageMouse.x, mDamageMouse.y));
+        mDamage.Add(DamageRegionAt(mx, my));
+        mDamageMouse = {mx, my};
+    } else {
+        mDamage.AddAll();
+        if (e.type == SDL_EVENT_MOUSE_MOTION)
+            mDamageMouse = {(int)e.motion.x, (int)e.motion.y};
+    }
+
+    if (e.type == SDL_EVENT_WINDOW_FOCUS_GAINED)
+        PollEnemyTypes();
+
     // ── File / folder drop ────────────────────────────────────────────────────
     if (e.type == SDL_EVENT_DROP_BEGIN) {
         mDropActive = true;
@@ -257,6 +342,7 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                 int mx = (int)fmx, my = (int)fmy;
                 int ti = (my >= TOOLBAR_H && mx < CanvasW()) ? HitTile(mx, my) : -1;
                 if (ti >= 0 && mLevel.tiles[ti].HasAction()) {
+                    TouchTile(ti);
                     mLevel.tiles[ti].action->destroyAnimPath = path;
                     // Preload the thumbnail now so it's ready to render immediately
                     GetDestroyAnimThumb(path);
@@ -313,6 +399,28 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
             }
         }
     }
+    // ── Minimap: click or drag to move the camera ────────────────────────────
+    if (mShowMinimap) {
+        if (e.type == SDL_EVENT_MOUSE_BUTTON_DOWN && e.button.button == SDL_BUTTON_LEFT) {
+            SDL_Point p  = {(int)e.button.x, (int)e.button.y};
+            SDL_Rect  mm = MinimapRect();
+            if (SDL_PointInRect(&p, &mm)) {
+                mMinimapDrag = true;
+                CenterCameraOnMinimap(p.x, p.y);
+                return true;
+            }
+        }
+        if (mMinimapDrag && e.type == SDL_EVENT_MOUSE_MOTION) {
+            CenterCameraOnMinimap((int)e.motion.x, (int)e.motion.y);
+            return true;
+        }
+        if (mMinimapDrag && e.type == SDL_EVENT_MOUSE_BUTTON_UP &&
+            e.button.button == SDL_BUTTON_LEFT) {
+            mMinimapDrag = false;
+            return true;
+        }
+    }
+
     // ── Pan: middle-mouse drag OR Ctrl + left-mouse drag ────────────────────
     auto startPan = [&](int mx, int my) { mCamera.StartPan(mx, my); };
 
@@ -364,8 +472,10 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
             mx < CanvasW()) {
             mMovPlatRange = std::max(GRID * 1.0f, mMovPlatRange + e.wheel.y * GRID);
             // Update current session tiles
-            for (int idx : mMovPlatIndices)
+            for (int idx : mMovPlatIndices) {
+                TouchTile(idx);
                 mLevel.tiles[idx].moving->range = mMovPlatRange;
+            }
             // Also update the hovered tile's group (handles already-placed platforms)
             int hovTi = (my >= TOOLBAR_H && mx < CanvasW()) ? HitTile(mx, my) : -1;
             if (hovTi >= 0 && mLevel.tiles[hovTi].HasMoving()) {
@@ -373,8 +483,10 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                 for (auto& t : mLevel.tiles) {
                     if (!t.HasMoving())
                         continue;
-                    if (grp != 0 ? (t.moving->groupId == grp) : (&t == &mLevel.tiles[hovTi]))
+                    if (grp != 0 ? (t.moving->groupId == grp) : (&t == &mLevel.tiles[hovTi])) {
+                        TouchTile(t);
                         t.moving->range = mMovPlatRange;
+                    }
                 }
             }
             SetStatus("MovePlat range=" + std::to_string((int)mMovPlatRange));
@@ -415,6 +527,7 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                 int steps = (int)mScrollAccum;
                 if (steps != 0) {
                     mScrollAccum -= steps;
+                    TouchTile(hovAction);
                     int& hits = mLevel.tiles[hovAction].action->hitsRequired;
                     hits      = std::clamp(hits + steps, 1, 99);
                     SetStatus("Action tile hits: " + std::to_string(hits));
@@ -448,8 +561,10 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                 for (auto& t : mLevel.tiles) {
                     if (!t.HasMoving())
                         continue;
-                    if (grp != 0 ? (t.moving->groupId == grp) : (&t == &ht))
+                    if (grp != 0 ? (t.moving->groupId == grp) : (&t == &ht)) {
+                        TouchTile(t);
                         t.moving->phase = newPhase;
+                    }
                 }
                 SetStatus((grp != 0 ? "Group " + std::to_string(grp)
                                     : "Tile " + std::to_string(hovTi)) +
@@ -462,8 +577,10 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                 for (auto& t : mLevel.tiles) {
                     if (!t.HasMoving())
                         continue;
-                    if (grp != 0 ? (t.moving->groupId == grp) : (&t == &mLevel.tiles[hovTi]))
+                    if (grp != 0 ? (t.moving->groupId == grp) : (&t == &mLevel.tiles[hovTi])) {
+                        TouchTile(t);
                         t.moving->loopDir = newDir;
+                    }
                 }
                 SetStatus(
                     (grp != 0 ? "Group " + std::to_string(grp)
@@ -472,8 +589,10 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
             } else {
                 // Plain scroll: adjust range for current group
                 mMovPlatRange = std::max(48.0f, mMovPlatRange + (int)e.wheel.y * GRID);
-                for (int idx : mMovPlatIndices)
+                for (int idx : mMovPlatIndices) {
+                    TouchTile(idx);
                     mLevel.tiles[idx].moving->range = mMovPlatRange;
+                }
                 SetStatus("MovePlat range=" + std::to_string((int)mMovPlatRange) +
                           "  spd=" + std::to_string((int)mPopups.movPlatSpeed) +
                           (mPopups.movPlatLoop ? "  LOOP" : "") +
@@ -517,6 +636,21 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                 SwitchTool(ToolId::Erase);
                 lblTool->CreateSurface("Erase");
                 break;
+            case SDLK_B:
+                SwitchTool(ToolId::Fill);
+                lblTool->CreateSurface("Fill");
+                mPalette.SetActiveTab(EditorPalette::Tab::Tiles);
+                break;
+            case SDLK_N:
+                SwitchTool(ToolId::Stamp);
+                lblTool->CreateSurface("Stamp");
+                break;
+            case SDLK_C:
+            case SDLK_X:
+            case SDLK_V:
+                if (e.key.mod & SDL_KMOD_CTRL)
+                    HandleClipboardKey(e.key.key);
+                break;
             case SDLK_5:
                 SwitchTool(ToolId::PlayerStart);
                 lblTool->CreateSurface("Player");
@@ -581,27 +715,26 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                 break;
             }
             case SDLK_S:
-                if (e.key.mod & SDL_KMOD_CTRL) {
-                    fs::create_directories("levels");
-                    std::string path = "levels/" + mLevelName + ".json";
-                    mLevel.name      = mLevelName;
-                    SaveLevel(mLevel, path);
-                    SetStatus("Saved: " + path);
-                }
+                if (e.key.mod & SDL_KMOD_CTRL)
+                    SetStatus("Saved: " + SaveCurrentLevel());
                 break;
             case SDLK_Z:
-                if (e.key.mod & SDL_KMOD_CTRL) {
-                    if (!mLevel.tiles.empty()) {
-                        mLevel.tiles.pop_back();
-                        SetStatus("Undo tile");
-                    } else if (!mLevel.coins.empty()) {
-                        mLevel.coins.pop_back();
-                        SetStatus("Undo coin");
-                    } else if (!mLevel.enemies.empty()) {
-                        mLevel.enemies.pop_back();
-                        SetStatus("Undo enemy");
-                    }
-                }
+                // Ctrl+Z = undo, Ctrl+Shift+Z = redo
+                if (e.key.mod & SDL_KMOD_CTRL)
+                    ApplyHistory((e.key.mod & SDL_KMOD_SHIFT) != 0);
+                break;
+            case SDLK_Y:
+                if (e.key.mod & SDL_KMOD_CTRL)
+                    ApplyHistory(true);
+                break;
+            case SDLK_F3:
+                SetStatus(DescribeSurfaceCache(mSurfaceCache.GetStats()));
+                break;
+            case SDLK_M:
+                mShowMinimap = !mShowMinimap;
+                mMinimapDrag = false;
+                SetStatus(mShowMinimap ? "Minimap visible (M to hide)"
+                                       : "Minimap hidden (M to show)");
                 break;
             case SDLK_DELETE:
             case SDLK_BACKSPACE:
@@ -653,6 +786,7 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                 // None -> anim1 -> anim2 -> ... -> last -> None -> ...
                 // The thumbnail badge updates immediately on each click.
                 {
+                    TouchTile(ti);
                     auto  manifests = ScanAnimatedTiles();
                     auto& cur       = mLevel.tiles[ti].action->destroyAnimPath;
                     if (manifests.empty()) {
@@ -738,6 +872,7 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
             }
             // Update all tiles already in the group
             for (int idx : mMovPlatIndices) {
+                TouchTile(idx);
                 mLevel.tiles[idx].moving->horiz   = mPopups.movPlatHoriz;
                 mLevel.tiles[idx].moving->range   = mMovPlatRange;
                 mLevel.tiles[idx].moving->speed   = mPopups.movPlatSpeed;
@@ -757,9 +892,10 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
         if (my >= TOOLBAR_H && mx < CanvasW()) {
             int ti = HitTile(mx, my);
             if (ti >= 0) {
+                TouchTile(ti);
                 if (mActiveToolId == ToolId::Action && mLevel.tiles[ti].HasAction()) {
                     int& grp = mLevel.tiles[ti].action->group;
-                    grp      = (grp + 1) % 10;
+                    grp      = (grp + 1) % (ActionData::MAX_GROUP + 1);
                     SetStatus("Tile " + std::to_string(ti) + " group -> " +
                               (grp == 0 ? "standalone" : std::to_string(grp)));
                 } else {
@@ -884,6 +1020,14 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                         SwitchTool(ToolId::Erase);
                         lblTool->CreateSurface("Erase");
                         return true;
+                    case TBBtn::Fill:
+                        SwitchTool(ToolId::Fill);
+                        lblTool->CreateSurface("Fill");
+                        return true;
+                    case TBBtn::Stamp:
+                        SwitchTool(ToolId::Stamp);
+                        lblTool->CreateSurface("Stamp");
+                        return true;
                     case TBBtn::PlayerStart:
                         SwitchTool(ToolId::PlayerStart);
                         lblTool->CreateSurface("Player");
@@ -967,18 +1111,18 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                             std::to_string(mMovPlatCurGroupId));
                         return true;
                     }
-                    case TBBtn::Save: {
-                        fs::create_directories("levels");
-                        std::string path = "levels/" + mLevelName + ".json";
-                        mLevel.name      = mLevelName;
-                        SaveLevel(mLevel, path);
-                        SetStatus("Saved: " + path);
+                    case TBBtn::Save:
+                        SetStatus("Saved: " + SaveCurrentLevel());
                         return true;
-                    }
                     case TBBtn::Load: {
                         std::string path = "levels/" + mLevelName + ".json";
                         if (LoadLevel(path, mLevel)) {
+                            mHistory.Clear();
+                            mSpatial.MarkDirty();
+                            mMinimap.MarkDirty();
                             SetStatus("Loaded: " + path);
+                            for (const auto& en : mLevel.enemies)
+                                mEnemyTypes.Warm(en.enemyType);
                             if (!mLevel.background.empty())
                                 background = std::make_unique<Image>(
                                     mLevel.background, FitModeFromString(mLevel.bgFitMode));
@@ -988,28 +1132,33 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                             SetStatus("No file: " + path);
                         return true;
                     }
-                    case TBBtn::Clear:
+                    case TBBtn::Clear: {
+                        // One batched op per kind, so one Ctrl+Z restores everything
+                        auto all = [](size_t n) {
+                            std::vector<int> v(n);
+                            std::iota(v.begin(), v.end(), 0);
+                            return v;
+                        };
+                        mHistory.ErasingMany(
+                            mLevel, EditorHistory::Kind::Tile, all(mLevel.tiles.size()));
+                        mHistory.ErasingMany(
+                            mLevel, EditorHistory::Kind::Coin, all(mLevel.coins.size()));
+                        mHistory.ErasingMany(
+                            mLevel, EditorHistory::Kind::Enemy, all(mLevel.enemies.size()));
                         mLevel.coins.clear();
                         mLevel.enemies.clear();
                         mLevel.tiles.clear();
-                        SetStatus("Cleared");
+                        SetStatus("Cleared  (Ctrl+Z to restore)");
                         return true;
-                    case TBBtn::Play: {
-                        fs::create_directories("levels");
-                        std::string path = "levels/" + mLevelName + ".json";
-                        mLevel.name      = mLevelName;
-                        SaveLevel(mLevel, path);
+                    }
+                    case TBBtn::Play:
+                        SaveCurrentLevel();
                         mLaunchGame = true;
                         return true;
-                    }
-                    case TBBtn::Back: {
-                        fs::create_directories("levels");
-                        std::string path = "levels/" + mLevelName + ".json";
-                        mLevel.name      = mLevelName;
-                        SaveLevel(mLevel, path);
+                    case TBBtn::Back:
+                        SaveCurrentLevel();
                         mGoBack = true;
                         return true;
-                    }
                     case TBBtn::Gravity: {
                         if (mLevel.gravityMode == GravityMode::Platformer)
                             mLevel.gravityMode = GravityMode::WallRun;
@@ -1174,16 +1323,18 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
 
         // Dispatch to extracted tools first
         if (mTool) {
-            // Populate TileTool's placement info if active
-            if (mActiveToolId == ToolId::Tile) {
-                if (auto* tt = dynamic_cast<TileTool*>(mTool.get())) {
-                    const auto* selItem = mPalette.SelectedItem();
-                    tt->placementInfo   = selItem ? TilePlacementInfo{true,
-                                                                    selItem->isFolder,
-                                                                    selItem->path,
-                                                                    selItem->label}
-                                                  : TilePlacementInfo{};
-                }
+            // Populate TileTool's / FillTool's placement info if active
+            if (mActiveToolId == ToolId::Tile || mActiveToolId == ToolId::Fill) {
+                const auto*       selItem = mPalette.SelectedItem();
+                TilePlacementInfo info    = selItem ? TilePlacementInfo{true,
+                                                                     selItem->isFolder,
+                                                                     selItem->path,
+                                                                     selItem->label}
+                                                    : TilePlacementInfo{};
+                if (auto* tt = dynamic_cast<TileTool*>(mTool.get()))
+                    tt->placementInfo = std::move(info);
+                else if (auto* ft = dynamic_cast<FillTool*>(mTool.get()))
+                    ft->placementInfo = std::move(info);
             }
             auto ctx = MakeToolCtx();
             auto res = mTool->OnMouseDown(ctx, mx, my, SDL_BUTTON_LEFT, SDL_GetModState());
@@ -1211,6 +1362,7 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                         SetStatus("Tile " + std::to_string(ti) + ": choose death animation");
                     } else {
                         // Not an action tile yet — make it one
+                        TouchTile(ti);
                         mLevel.tiles[ti].action = ActionData{};
                         mLevel.tiles[ti].prop   = false;
                         mLevel.tiles[ti].ladder = false;
@@ -1249,6 +1401,7 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                 // Left-click: toggle tile into/out of the current moving group
                 int ti = HitTile(mx, my);
                 if (ti >= 0) {
+                    TouchTile(ti);
                     auto& t = mLevel.tiles[ti];
                     // If the tile is already moving but from a *different* session group,
                     // adopt its group so the speed popup edits the right group.
@@ -1308,8 +1461,10 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
                             (mMovPlatIndices.size() > 1) ? mMovPlatCurGroupId : 0;
                         // Re-apply group id to all tiles in group
                         if (mMovPlatIndices.size() > 1) {
-                            for (int idx : mMovPlatIndices)
+                            for (int idx : mMovPlatIndices) {
+                                TouchTile(idx);
                                 mLevel.tiles[idx].moving->groupId = mMovPlatCurGroupId;
+                            }
                         }
                         SetStatus("Tile " + std::to_string(ti) +
                                   " added to platform group " +
@@ -1403,13 +1558,16 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
         if (mIsDragging && mDragIndex >= 0 && my >= TOOLBAR_H && mx < CanvasW()) {
             auto [sx, sy] = SnapToGrid(mx, my);
             if (mDragIsTile && mDragIndex < (int)mLevel.tiles.size()) {
+                TouchTile(mDragIndex);
                 mLevel.tiles[mDragIndex].x = (float)sx;
                 mLevel.tiles[mDragIndex].y = (float)sy;
             } else if (mDragIsCoin && mDragIndex < (int)mLevel.coins.size()) {
+                mHistory.Touch(mLevel, EditorHistory::Kind::Coin, mDragIndex);
                 mLevel.coins[mDragIndex].x = (float)sx;
                 mLevel.coins[mDragIndex].y = (float)sy;
             } else if (!mDragIsCoin && !mDragIsTile &&
                        mDragIndex < (int)mLevel.enemies.size()) {
+                mHistory.Touch(mLevel, EditorHistory::Kind::Enemy, mDragIndex);
                 mLevel.enemies[mDragIndex].x = (float)sx;
                 mLevel.enemies[mDragIndex].y = (float)sy;
             }
@@ -1420,30 +1578,200 @@ bool LevelEditorScene::HandleEvent(SDL_Event& e) {
 }
 
 // --- Update ----------------------------------------------------------------
-void LevelEditorScene::Update(float /*dt*/) {
+void LevelEditorScene::Update(float dt) {
     // Pan is driven entirely by SDL_EVENT_MOUSE_MOTION in HandleEvent using
     // absolute position delta from the recorded start point. SDL_CaptureMouse
     // ensures motion events are delivered reliably, so no polling catch-up is
     // needed here. Having two writers to mCamX/Y caused jitter, especially
     // under thermal throttling where frame timing is inconsistent.
+
+    // Pick up enemy profiles edited on disk (Enemy Creator, text editor).
+    // One stat() per known type, once a second.
+    mEnemyTypePollT += dt;
+    if (mEnemyTypePollT >= 1.0f)
+        PollEnemyTypes();
+
+    // Palette thumbnails stream in from the loader thread.
+    if (mPalette.PumpThumbnails() && mWindow)
+        mDamage.Add({CanvasW(), TOOLBAR_H, mWindow->GetWidth() - CanvasW(),
+                     mWindow->GetHeight() - TOOLBAR_H});
+
+    // Only the part of the map under what was edited is redrawn.
+    if (mShowMinimap && mMinimap.Refresh(mLevel) && mWindow)
+        mDamage.Add(MinimapRect());
+}
+
+void LevelEditorScene::PollEnemyTypes() {
+    mEnemyTypePollT = 0.0f;
+    if (mEnemyTypes.Refresh()) {
+        mSpatial.MarkDirty(); // enemy hit boxes may have changed size
+        mDamage.AddAll();     // ...and sprites / previews their look
+    }
+}
+
+// --- DamageRegionAt --------------------------------------------------------
+// Toolbar strip, palette panel or canvas (incl. its bottom bar), whichever
+// contains the point. Off-window points map to nothing.
+SDL_Rect LevelEditorScene::DamageRegionAt(int x, int y) const {
+    if (!mWindow || x < 0 || y < 0)
+        return {0, 0, 0, 0};
+    int W = mWindow->GetWidth(), H = mWindow->GetHeight(), cw = CanvasW();
+    if (y < TOOLBAR_H)
+        return {0, 0, W, TOOLBAR_H};
+    if (x >= cw)
+        return {cw, TOOLBAR_H, W - cw, H - TOOLBAR_H};
+    return {0, TOOLBAR_H, cw, H - TOOLBAR_H};
+}
+
+// --- HandleClipboardKey ----------------------------------------------------
+// Ctrl+C / Ctrl+X act on the Select tool's selection. Ctrl+V pastes with the
+// clipboard's top-left at the grid cell under the cursor (or the top-left of
+// the view when the cursor is off the canvas) and selects the pasted tiles.
+void LevelEditorScene::HandleClipboardKey(SDL_Keycode key) {
+    auto* sel = dynamic_cast<SelectTool*>(mTool.get());
+    if (key == SDLK_C || key == SDLK_X) {
+        if (!sel || sel->selIndices.empty()) {
+            SetStatus("Nothing selected to copy (Q = Select)");
+            return;
+        }
+        mClipboard = EditorBulkOps::Copy(mLevel, sel->selIndices);
+        if (key == SDLK_X) {
+            int n = EditorBulkOps::EraseTiles(mLevel, mHistory, sel->selIndices);
+            sel->selIndices.clear();
+            SetStatus("Cut " + std::to_string(n) + " tile(s)");
+        } else {
+            SetStatus("Copied " + std::to_string(mClipboard.tiles.size()) +
+                      " tile(s)  (Ctrl+V paste, N stamp)");
+        }
+        return;
+    }
+
+    if (mClipboard.Empty()) {
+        SetStatus("Clipboard is empty (select tiles, then Ctrl+C)");
+        return;
+    }
+    float fmx, fmy;
+    SDL_GetMouseState(&fmx, &fmy);
+    int mx = (int)fmx, my = (int)fmy;
+    if (my < TOOLBAR_H || mx >= CanvasW()) {
+        mx = 0;
+        my = TOOLBAR_H;
+    }
+    auto [sx, sy] = SnapToGrid(mx, my);
+    int ungrouped = 0;
+    int first     = EditorBulkOps::Paste(mLevel, mHistory, mClipboard, (float)sx, (float)sy,
+                                         &ungrouped);
+
+    SwitchTool(ToolId::Select);
+    if (auto* st = dynamic_cast<SelectTool*>(mTool.get())) {
+        st->selIndices.resize(mLevel.tiles.size() - first);
+        std::iota(st->selIndices.begin(), st->selIndices.end(), first);
+    }
+    std::string msg = "Pasted " + std::to_string(mClipboard.tiles.size()) + " tile(s)";
+    if (ungrouped > 0)
+        msg += "  (" + std::to_string(ungrouped) + " standalone: action groups 1-" +
+               std::to_string(ActionData::MAX_GROUP) + " all in use)";
+    SetStatus(msg);
+}
+
+// --- Minimap ---------------------------------------------------------------
+// Bottom-right corner of the canvas, just above the status bar.
+SDL_Rect LevelEditorScene::MinimapRect() const {
+    constexpr int BOX_W = 200, BOX_H = 100, MARGIN = 8;
+    int           H = mWindow ? mWindow->GetHeight() : 0;
+    return mMinimap.Fit(
+        {CanvasW() - BOX_W - MARGIN, H - BOTTOM_BAR_H - BOX_H - MARGIN, BOX_W, BOX_H});
+}
+
+// Centre the visible canvas area on the world point under minimap pixel (x, y).
+void LevelEditorScene::CenterCameraOnMinimap(int x, int y) {
+    if (!mWindow)
+        return;
+    SDL_FPoint w    = mMinimap.ToWorld(MinimapRect(), x, y);
+    float      z    = mCamera.Zoom();
+    float      midY = (TOOLBAR_H + mWindow->GetHeight() - BOTTOM_BAR_H) * 0.5f;
+    mCamera.SetPosition(std::max(0.0f, w.x - CanvasW() * 0.5f / z),
+                        std::max(0.0f, w.y - midY / z));
+}
+
+// Writes levels/<name>.json plus its browser preview. Returns the level path.
+std::string LevelEditorScene::SaveCurrentLevel() {
+    fs::create_directories("levels");
+    std::string path = "levels/" + mLevelName + ".json";
+    mLevel.name      = mLevelName;
+    SaveLevel(mLevel, path);
+    mMinimap.MarkDirty();
+    mMinimap.Refresh(mLevel);
+    mMinimap.SavePreview(path);
+    return path;
+}
+
+// --- ApplyHistory ----------------------------------------------------------
+void LevelEditorScene::ApplyHistory(bool redo) {
+    const std::string label = redo ? mHistory.RedoLabel() : mHistory.UndoLabel();
+    if (!(redo ? mHistory.Redo(mLevel) : mHistory.Undo(mLevel))) {
+        SetStatus(redo ? "Nothing to redo" : "Nothing to undo");
+        return;
+    }
+    SetStatus((redo ? "Redo: " : "Undo: ") + label);
+
+    // Anything holding a tile / coin / enemy index may now point at a
+    // different entity or past the end. Tools drop their own state; the
+    // scene closes index-bound popups and prunes the moving-platform session.
+    if (mTool) {
+        auto ctx = MakeToolCtx();
+        mTool->OnHistoryApplied(ctx);
+    }
+    mPopups.CloseAnimPicker();
+    mPopups.ClosePowerUpPicker();
+    std::erase_if(mMovPlatIndices, [this](int i) {
+        return i >= (int)mLevel.tiles.size() || !mLevel.tiles[i].HasMoving();
+    });
+    mIsDragging          = false;
+    mDragIndex           = -1;
+    mActionAnimDropHover = -1;
+    mSpatial.MarkDirty();
 }
 
 // --- Render ----------------------------------------------------------------
 void LevelEditorScene::Render(Window& window, float /*alpha*/) {
-    window.Render();
     SDL_Renderer* ren = window.GetRenderer();
 
-    int          W = mWindow->GetWidth(), H = mWindow->GetHeight();
-    SDL_Surface* screen = SDL_CreateSurface(W, H, SDL_PIXELFORMAT_ARGB8888);
-    if (!screen) {
+    int W = mWindow->GetWidth(), H = mWindow->GetHeight();
+    mDamage.Track(W, H, mCamera);
+    mPresented = mDamage.Any();
+    if (!mPresented)
+        return; // nothing changed: the last presented frame is still correct
+
+    window.Render();
+    if (!mOverlaySurface || mOverlaySurface->w != W || mOverlaySurface->h != H) {
+        if (mOverlaySurface)
+            SDL_DestroySurface(mOverlaySurface);
+        if (mOverlayTex)
+            TextureRegistry::Get().Destroy(mOverlayTex);
+        mOverlaySurface = SDL_CreateSurface(W, H, SDL_PIXELFORMAT_ARGB8888);
+        mOverlayTex     = TextureRegistry::Get().Create(ren, SDL_PIXELFORMAT_ARGB8888,
+                                                        SDL_TEXTUREACCESS_STREAMING, W, H,
+                                                        "editor/overlay");
+        if (mOverlaySurface)
+            SDL_SetSurfaceBlendMode(mOverlaySurface, SDL_BLENDMODE_BLEND);
+        if (mOverlayTex)
+            SDL_SetTextureBlendMode(mOverlayTex, SDL_BLENDMODE_BLEND);
+        mDamage.AddAll(); // fresh overlay has nothing on it yet
+    }
+    SDL_Surface* screen = mOverlaySurface;
+    if (!screen || !mOverlayTex) {
         window.Update();
         return;
     }
-    SDL_SetSurfaceBlendMode(screen, SDL_BLENDMODE_BLEND);
-    SDL_FillSurfaceRect(
-        screen,
-        nullptr,
-        SDL_MapRGBA(SDL_GetPixelFormatDetails(screen->format), nullptr, 0, 0, 0, 0));
+    // Surfaces from last frame's draw stay resident; older ones may be evicted
+    // to keep the cache within budget. Pointers fetched below stay valid.
+    mSurfaceCache.BeginFrame();
+    // Only the damaged rect of the overlay is cleared and redrawn; the clip
+    // rect makes every fill and blit below skip the rest.
+    const SDL_Rect dirty = mDamage.Take();
+    SDL_SetSurfaceClipRect(screen, &dirty);
+    SDL_FillSurfaceRect(screen, &dirty, 0);
     int cw = CanvasW();
 
     // ── Canvas pass ─────────────────────────────────────────────────────────
@@ -1462,12 +1790,15 @@ void LevelEditorScene::Render(Window& window, float /*alpha*/) {
 
     mCanvasRenderer.Render(window,
                            screen,
+                           mTextures,
                            cw,
                            TOOLBAR_H,
                            GRID,
                            mLevel,
+                           mSpatial,
                            mCamera,
                            mSurfaceCache,
+                           mEnemyTypes,
                            mPalette,
                            background.get(),
                            coinSheet.get(),
@@ -1525,6 +1856,14 @@ void LevelEditorScene::Render(Window& window, float /*alpha*/) {
     mpuState.curGroupId = mMovPlatCurGroupId;
     mpuState.rect       = mPopups.movPlatRect;
 
+    // Canvas-space UI, so drawn before the toolbar / palette / popups on top
+    if (mShowMinimap && mMinimap.Surface()) {
+        float     z    = mCamera.Zoom();
+        SDL_FRect view = {mCamera.X(), mCamera.Y() + TOOLBAR_H / z, cw / z,
+                          (H - BOTTOM_BAR_H - TOOLBAR_H) / z};
+        mMinimap.Draw(screen, MinimapRect(), view);
+    }
+
     mUIRenderer.Render(window,
                        screen,
                        cw,
@@ -1568,13 +1907,16 @@ void LevelEditorScene::Render(Window& window, float /*alpha*/) {
     mPopups.delNo          = mUIRenderer.DelConfirmNoRect();
     mPopups.animPickerRect = mUIRenderer.AnimPickerRect();
 
-    // Upload completed surface to GPU and present
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(ren, screen);
-    SDL_DestroySurface(screen);
-    if (tex) {
-        SDL_RenderTexture(ren, tex, nullptr, nullptr);
-        SDL_DestroyTexture(tex);
+    SDL_SetSurfaceClipRect(screen, nullptr);
+
+    // Upload the redrawn rect, then composite the overlay over the GPU-drawn
+    // canvas and present
+    if (dirty.w > 0 && dirty.h > 0) {
+        const auto* px = static_cast<const Uint8*>(screen->pixels) +
+                         dirty.y * screen->pitch + dirty.x * 4; // ARGB8888
+        SDL_UpdateTexture(mOverlayTex, &dirty, px, screen->pitch);
     }
+    SDL_RenderTexture(ren, mOverlayTex, nullptr, nullptr);
     window.Update();
 }
 
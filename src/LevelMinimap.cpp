@@ -0,0 +1,331 @@
+#include "LevelMinimap.hpp"
+#include "EditorSurfaceCache.hpp"
+#include "GameConfig.hpp"
+#include "TextureRegistry.hpp"
+#include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <print>
+
+namespace fs = std::filesystem;
+
+namespace {
+constexpr SDL_Color BG_COLOR     = {14, 16, 26, 255};
+constexpr SDL_Color COIN_COLOR   = {255, 215, 0, 255};
+constexpr SDL_Color ENEMY_COLOR  = {230, 60, 60, 255};
+constexpr SDL_Color PLAYER_COLOR = {80, 230, 120, 255};
+constexpr SDL_Color MISSING_TILE = {90, 90, 130, 255};
+
+// FNV-1a — stable across runs, unlike std::hash.
+std::uint64_t Fnv1a(const std::string& s) {
+    std::uint64_t h = 1469598103934665603ull;
+    for (unsigned char c : s) {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+void Fill(SDL_Surface* s, SDL_Rect r, SDL_Color c) {
+    const auto* fmt = SDL_GetPixelFormatDetails(s->format);
+    SDL_FillSurfaceRect(s, &r, SDL_MapRGBA(fmt, nullptr, c.r, c.g, c.b, c.a));
+}
+
+// Alpha-weighted mean colour of an ARGB8888 image; MISSING_TILE without one.
+SDL_Color MeanColor(const SDL_Surface* img) {
+    if (!img)
+        return MISSING_TILE;
+    double r = 0, g = 0, b = 0, a = 0;
+    for (int y = 0; y < img->h; ++y) {
+        const auto* row = reinterpret_cast<const Uint32*>(
+            static_cast<const Uint8*>(img->pixels) + y * img->pitch);
+        for (int x = 0; x < img->w; ++x) {
+            const Uint32 p  = row[x];
+            const double pa = (p >> 24) & 0xFF;
+            r += ((p >> 16) & 0xFF) * pa;
+            g += ((p >> 8) & 0xFF) * pa;
+            b += (p & 0xFF) * pa;
+            a += pa;
+        }
+    }
+    if (a <= 0)
+        return MISSING_TILE;
+    return {(Uint8)(r / a), (Uint8)(g / a), (Uint8)(b / a), 255};
+}
+} // namespace
+
+LevelMinimap::~LevelMinimap() {
+    if (mSurface)
+        SDL_DestroySurface(mSurface);
+}
+
+void LevelMinimap::Clear() {
+    if (mSurface)
+        SDL_DestroySurface(mSurface);
+    mSurface = nullptr;
+    mDirty   = true;
+    mTiles.clear();
+    mMarkers.clear();
+    mImageIds.clear();
+    mImages.clear();
+    mColors.clear();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Snapshot / bounds
+// ─────────────────────────────────────────────────────────────────────────────
+SDL_FRect LevelMinimap::Bounds(const Level& level) {
+    float maxX = 0.0f, maxY = 0.0f;
+    auto  grow = [&](float x, float y) {
+        maxX = std::max(maxX, x);
+        maxY = std::max(maxY, y);
+    };
+    for (const auto& t : level.tiles)
+        grow(t.x + t.w, t.y + t.h);
+    for (const auto& c : level.coins)
+        grow(c.x + COIN_SIZE, c.y + COIN_SIZE);
+    for (const auto& en : level.enemies)
+        grow(en.x + SLIME_SPRITE_WIDTH, en.y + SLIME_SPRITE_HEIGHT);
+    grow(level.player.x + PLAYER_STAND_WIDTH, level.player.y + PLAYER_STAND_HEIGHT);
+
+    // Editor world space starts at 0,0 (the camera never goes negative).
+    return {0.0f, 0.0f, std::ceil(maxX / WORLD_QUANT) * WORLD_QUANT,
+            std::ceil(maxY / WORLD_QUANT) * WORLD_QUANT};
+}
+
+int LevelMinimap::ImageId(const std::string& path) {
+    if (auto it = mImageIds.find(path); it != mImageIds.end())
+        return it->second;
+    // First sight of an image: take its colour from the editor's decoded
+    // surface (animated tiles resolve to their first frame there).
+    const int id = (int)mImages.size();
+    mImages.push_back(path);
+    mColors.push_back(MeanColor(mSurfaces.LoadAndCache(path)));
+    mImageIds.emplace(path, id);
+    return id;
+}
+
+void LevelMinimap::Snapshot(const Level& level, std::vector<Mark>& tiles,
+                            std::vector<Mark>& markers) {
+    tiles.clear();
+    tiles.reserve(level.tiles.size());
+    for (const auto& t : level.tiles)
+        tiles.push_back({{t.x, t.y, (float)t.w, (float)t.h}, ImageId(t.imagePath)});
+
+    markers.clear();
+    markers.reserve(level.coins.size() + level.enemies.size() + 1);
+    for (const auto& c : level.coins)
+        markers.push_back({{c.x, c.y, (float)COIN_SIZE, (float)COIN_SIZE}});
+    for (const auto& en : level.enemies)
+        markers.push_back(
+            {{en.x, en.y, (float)SLIME_SPRITE_WIDTH, (float)SLIME_SPRITE_HEIGHT}});
+    markers.push_back({{level.player.x, level.player.y, (float)PLAYER_STAND_WIDTH,
+                        (float)PLAYER_STAND_HEIGHT}});
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Refresh
+// ─────────────────────────────────────────────────────────────────────────────
+bool LevelMinimap::Refresh(const Level& level) {
+    if (!mDirty && mSurface)
+        return false;
+    mDirty = false;
+
+    const SDL_FRect world = Bounds(level);
+    if (!mSurface || world.w != mWorld.w || world.h != mWorld.h) {
+        if (mSurface)
+            SDL_DestroySurface(mSurface);
+        mWorld   = world;
+        mScale   = std::min(MAX_W / world.w, MAX_H / world.h);
+        mSurface = SDL_CreateSurface(std::max(1, (int)std::ceil(world.w * mScale)),
+                                     std::max(1, (int)std::ceil(world.h * mScale)),
+                                     SDL_PIXELFORMAT_ARGB8888);
+        if (!mSurface)
+            return false;
+        Snapshot(level, mTiles, mMarkers);
+        mCoins   = (int)level.coins.size();
+        mEnemies = (int)level.enemies.size();
+        Redraw({0, 0, mSurface->w, mSurface->h});
+        return true;
+    }
+
+    // Diff against what was drawn: every entity whose slot changed damages
+    // its old and new footprint. An erase mid-vector shifts every later slot,
+    // which is still correct, just a bigger redraw.
+    std::vector<Mark> tiles, markers;
+    Snapshot(level, tiles, markers);
+    SDL_Rect dirty{};
+    bool     any    = false;
+    auto     damage = [&](const Mark& m) {
+        SDL_Rect px = ToPixels(m.rect);
+        if (!any)
+            dirty = px;
+        else
+            SDL_GetRectUnion(&dirty, &px, &dirty);
+        any = true;
+    };
+    auto diff = [&](const std::vector<Mark>& was, const std::vector<Mark>& now) {
+        const size_t n = std::max(was.size(), now.size());
+        for (size_t i = 0; i < n; ++i) {
+            if (i < was.size() && i < now.size() && was[i] == now[i])
+                continue;
+            if (i < was.size())
+                damage(was[i]);
+            if (i < now.size())
+                damage(now[i]);
+        }
+    };
+    diff(mTiles, tiles);
+    diff(mMarkers, markers);
+
+    mTiles   = std::move(tiles);
+    mMarkers = std::move(markers);
+    mCoins   = (int)level.coins.size();
+    mEnemies = (int)level.enemies.size();
+    if (any)
+        Redraw(dirty);
+    return any;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Drawing into the cached surface
+// ─────────────────────────────────────────────────────────────────────────────
+SDL_Rect LevelMinimap::ToPixels(const SDL_FRect& r) const {
+    const int x0 = (int)std::floor((r.x - mWorld.x) * mScale);
+    const int y0 = (int)std::floor((r.y - mWorld.y) * mScale);
+    const int x1 = (int)std::ceil((r.x + r.w - mWorld.x) * mScale);
+    const int y1 = (int)std::ceil((r.y + r.h - mWorld.y) * mScale);
+    return {x0, y0, std::max(1, x1 - x0), std::max(1, y1 - y0)};
+}
+
+void LevelMinimap::DrawMark(const Mark& m, SDL_Color c, int minPx) {
+    SDL_Rect px = ToPixels(m.rect);
+    if (px.w < minPx) {
+        px.x -= (minPx - px.w) / 2;
+        px.w = minPx;
+    }
+    if (px.h < minPx) {
+        px.y -= (minPx - px.h) / 2;
+        px.h = minPx;
+    }
+    Fill(mSurface, px, c);
+}
+
+// Repaints the pixels in `px` from the snapshot; everything outside is
+// clipped away, so only entities overlapping it cost anything.
+void LevelMinimap::Redraw(SDL_Rect px) {
+    // Markers are drawn up to 3px wide; widen so their overhang is cleared too.
+    px = {px.x - 2, px.y - 2, px.w + 4, px.h + 4};
+    SDL_SetSurfaceClipRect(mSurface, &px);
+    Fill(mSurface, px, BG_COLOR);
+
+    auto hits = [&](const Mark& m) {
+        SDL_Rect r = ToPixels(m.rect);
+        r          = {r.x - 2, r.y - 2, r.w + 4, r.h + 4};
+        return SDL_HasRectIntersection(&r, &px);
+    };
+    for (const auto& t : mTiles)
+        if (hits(t))
+            DrawMark(t, mColors[t.image], 1);
+    for (int i = 0; i < (int)mMarkers.size(); ++i) {
+        if (!hits(mMarkers[i]))
+            continue;
+        SDL_Color c = (i < mCoins)             ? COIN_COLOR
+                      : (i < mCoins + mEnemies) ? ENEMY_COLOR
+                                                : PLAYER_COLOR;
+        DrawMark(mMarkers[i], c, (i < mCoins + mEnemies) ? 2 : 3);
+    }
+    SDL_SetSurfaceClipRect(mSurface, nullptr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Display
+// ─────────────────────────────────────────────────────────────────────────────
+SDL_Rect LevelMinimap::Fit(SDL_Rect box) const {
+    if (!mSurface)
+        return box;
+    const float sc = std::min((float)box.w / mSurface->w, (float)box.h / mSurface->h);
+    const int   w  = std::max(1, (int)(mSurface->w * sc));
+    const int   h  = std::max(1, (int)(mSurface->h * sc));
+    return {box.x + (box.w - w) / 2, box.y + (box.h - h) / 2, w, h};
+}
+
+void LevelMinimap::Draw(SDL_Surface* screen, SDL_Rect dst, const SDL_FRect& view) const {
+    if (!mSurface)
+        return;
+    SDL_BlitSurfaceScaled(mSurface, nullptr, screen, &dst, SDL_SCALEMODE_NEAREST);
+
+    const float sx = dst.w / mWorld.w, sy = dst.h / mWorld.h;
+    SDL_Rect    v  = {dst.x + (int)((view.x - mWorld.x) * sx),
+                      dst.y + (int)((view.y - mWorld.y) * sy), std::max(2, (int)(view.w * sx)),
+                      std::max(2, (int)(view.h * sy))};
+    SDL_Rect    clipped;
+    if (!SDL_GetRectIntersection(&v, &dst, &clipped))
+        return;
+    constexpr SDL_Color VIEW = {255, 255, 255, 220};
+    Fill(screen, {clipped.x, clipped.y, clipped.w, 1}, VIEW);
+    Fill(screen, {clipped.x, clipped.y + clipped.h - 1, clipped.w, 1}, VIEW);
+    Fill(screen, {clipped.x, clipped.y, 1, clipped.h}, VIEW);
+    Fill(screen, {clipped.x + clipped.w - 1, clipped.y, 1, clipped.h}, VIEW);
+}
+
+SDL_FPoint LevelMinimap::ToWorld(SDL_Rect dst, int x, int y) const {
+    const float fx = std::clamp((float)(x - dst.x) / std::max(1, dst.w), 0.0f, 1.0f);
+    const float fy = std::clamp((float)(y - dst.y) / std::max(1, dst.h), 0.0f, 1.0f);
+    return {mWorld.x + fx * mWorld.w, mWorld.y + fy * mWorld.h};
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Level browser previews
+// ─────────────────────────────────────────────────────────────────────────────
+// Named by a hash of the normalised level path (like EditorThumbLoader's
+// cache files), so levels sharing a stem in different folders keep their own
+// preview. The stem stays in the name for anyone browsing the folder.
+std::string LevelMinimap::PreviewPath(const std::string& levelPath) {
+    std::error_code ec;
+    fs::path        abs = fs::absolute(levelPath, ec);
+    if (ec)
+        abs = levelPath;
+    const std::uint64_t h = Fnv1a(abs.lexically_normal().generic_string());
+    char                hash[17];
+    std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(h));
+    return (fs::path(PREVIEW_DIR) / (abs.stem().string() + "_" + hash + ".png")).string();
+}
+
+bool LevelMinimap::SavePreview(const std::string& levelPath) const {
+    if (!mSurface)
+        return false;
+    std::error_code ec;
+    fs::create_directories(PREVIEW_DIR, ec);
+    const std::string path = PreviewPath(levelPath);
+    if (!IMG_SavePNG(mSurface, path.c_str())) {
+        std::print("LevelMinimap: failed to write {}: {}\n", path, SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+SDL_Texture* LevelMinimap::LoadPreview(SDL_Renderer* ren, const std::string& levelPath) {
+    const std::string path = PreviewPath(levelPath);
+    std::error_code   ec;
+    if (!ren || !fs::exists(path, ec))
+        return nullptr;
+    // A level edited outside the editor (by hand, a pull, --chunk-level) is
+    // newer than its preview; showing the stale render would be wrong.
+    std::error_code levelEc;
+    const auto      shot  = fs::last_write_time(path, ec);
+    const auto      level = fs::last_write_time(levelPath, levelEc);
+    if (ec || levelEc || shot < level)
+        return nullptr;
+    SDL_Surface* surf = IMG_Load(path.c_str());
+    if (!surf)
+        return nullptr;
+    SDL_Texture* tex = TextureRegistry::Get().CreateFromSurface(ren, surf, "minimap");
+    SDL_DestroySurface(surf);
+    if (tex)
+        SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST);
+    return tex;
+}
@@ -0,0 +1,184 @@
+#include "LoadReport.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <print>
+
+namespace fs = std::filesystem;
+using json   = nlohmann::json;
+
+thread_local bool LoadReport::sRecording = false;
+
+namespace {
+constexpr const char* STAGE_NAMES[LoadReport::STAGE_COUNT] = {
+    "parse", "scan", "read", "decode", "convert", "rotate", "upload"};
+
+double Ms(Uint64 ticks) {
+    return (double)ticks * 1000.0 / (double)SDL_GetPerformanceFrequency();
+}
+double KB(Uint64 bytes) { return (double)bytes / 1024.0; }
+} // namespace
+
+LoadReport& LoadReport::Get() {
+    static LoadReport instance;
+    return instance;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Scopes
+// ─────────────────────────────────────────────────────────────────────────────
+LoadReport::AssetClass::AssetClass(const char* assetClass)
+    : mPrev(nullptr) {
+    if (!Recording())
+        return;
+    mPrev        = Get().mClass;
+    Get().mClass = assetClass;
+}
+
+LoadReport::AssetClass::~AssetClass() {
+    if (mPrev)
+        Get().mClass = mPrev;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Recording
+// ─────────────────────────────────────────────────────────────────────────────
+void LoadReport::Begin(const std::string& level) {
+    mLevel      = level;
+    mStart      = SDL_GetPerformanceCounter();
+    mStageTicks = 0;
+    mClass      = "other";
+    mClasses.clear();
+    mPhases.clear();
+    mCounts.clear();
+    mOpen      = {};
+    sRecording = true;
+}
+
+void LoadReport::Phase(const char* name, const char* assetClass) {
+    if (!Recording())
+        return;
+    ClosePhase();
+    // While open, ticks / stageTicks hold the counters at the phase start.
+    mOpen  = {name, SDL_GetPerformanceCounter(), mStageTicks};
+    mClass = assetClass;
+}
+
+void LoadReport::ClosePhase() {
+    if (!mOpen.name)
+        return;
+    mPhases.push_back({mOpen.name, SDL_GetPerformanceCounter() - mOpen.ticks,
+                       mStageTicks - mOpen.stageTicks});
+    mOpen  = {};
+    mClass = "other";
+}
+
+LoadReport::ClassStats& LoadReport::Class(const char* name) {
+    for (auto& c : mClasses)
+        if (std::strcmp(c.name, name) == 0)
+            return c;
+    return mClasses.emplace_back(ClassStats{name});
+}
+
+void LoadReport::AddStage(Stage stage, Uint64 ticks, Uint64 bytes) {
+    ClassStats& c = Class(mClass);
+    c.ticks[stage] += ticks;
+    c.calls[stage] += 1;
+    c.bytes[stage] += bytes;
+    mStageTicks += ticks;
+}
+
+void LoadReport::Count(const char* what, size_t n) {
+    if (Recording())
+        mCounts.emplace_back(what, n);
+}
+
+void LoadReport::End() {
+    if (!Recording())
+        return;
+    ClosePhase();
+    sRecording           = false;
+    const double totalMs = Ms(SDL_GetPerformanceCounter() - mStart);
+    Print(totalMs);
+    Write(totalMs);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Output
+// ─────────────────────────────────────────────────────────────────────────────
+void LoadReport::Print(double totalMs) const {
+    std::print("[Load] {}: {:.1f} ms\n", mLevel.empty() ? "(default level)" : mLevel,
+               totalMs);
+
+    double phasedMs = 0.0;
+    std::print("  {:<22}{:>9}{:>10}\n", "phase", "ms", "other ms");
+    for (const auto& p : mPhases) {
+        std::print("  {:<22}{:>9.1f}{:>10.1f}\n", p.name, Ms(p.ticks),
+                   Ms(p.ticks - std::min(p.stageTicks, p.ticks)));
+        phasedMs += Ms(p.ticks);
+    }
+    std::print("  {:<22}{:>9.1f}\n", "(outside phases)", std::max(0.0, totalMs - phasedMs));
+
+    std::print("  {:<14}", "asset (ms)");
+    for (const char* s : STAGE_NAMES)
+        std::print("{:>8}", s);
+    std::print("{:>7}{:>10}{:>6}{:>11}\n", "files", "read KB", "tex", "upload KB");
+    for (const auto& c : mClasses) {
+        std::print("  {:<14}", c.name);
+        for (int s = 0; s < STAGE_COUNT; ++s)
+            std::print("{:>8.1f}", Ms(c.ticks[s]));
+        std::print("{:>7}{:>10.0f}{:>6}{:>11.0f}\n", c.calls[Read], KB(c.bytes[Read]),
+                   c.calls[Upload], KB(c.bytes[Upload]));
+    }
+
+    if (!mCounts.empty()) {
+        std::print("  entities:");
+        for (const auto& [what, n] : mCounts)
+            std::print(" {} {}", what, n);
+        std::print("\n");
+    }
+}
+
+void LoadReport::Write(double totalMs) const {
+    json j;
+    j["level"]    = mLevel;
+    j["total_ms"] = totalMs;
+
+    json phases = json::array();
+    for (const auto& p : mPhases)
+        phases.push_back({{"name", p.name},
+                          {"ms", Ms(p.ticks)},
+                          {"other_ms", Ms(p.ticks - std::min(p.stageTicks, p.ticks))}});
+    j["phases"] = std::move(phases);
+
+    json assets = json::object();
+    for (const auto& c : mClasses) {
+        json a = json::object();
+        for (int s = 0; s < STAGE_COUNT; ++s)
+            a[std::string(STAGE_NAMES[s]) + "_ms"] = Ms(c.ticks[s]);
+        a["files"]        = c.calls[Read];
+        a["read_bytes"]   = c.bytes[Read];
+        a["textures"]     = c.calls[Upload];
+        a["upload_bytes"] = c.bytes[Upload];
+        assets[c.name]    = std::move(a);
+    }
+    j["assets"] = std::move(assets);
+
+    json counts = json::object();
+    for (const auto& [what, n] : mCounts)
+        counts[what] = n;
+    j["entities"] = std::move(counts);
+
+    std::error_code ec;
+    fs::create_directories(REPORT_DIR, ec);
+    const std::string stem = mLevel.empty() ? "default" : fs::path(mLevel).stem().string();
+    const std::string path = std::string(REPORT_DIR) + "/" + stem + ".json";
+    std::ofstream     file(path);
+    if (!file.is_open()) {
+        std::print("[Load] cannot write {}\n", path);
+        return;
+    }
+    file << j.dump(4) << '\n';
+}
@@ -1,4 +1,6 @@
 #include "PlayerCreatorScene.hpp"
+#include "ProfileCache.hpp"
+#include "TextureRegistry.hpp"
 #include "TitleScene.hpp"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
@@ -800,11 +802,11 @@ void PlayerCreatorScene::Render(Window& window, float /*alpha*/) {
     }
 
     // Upload the completed surface to a texture and render it
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(ren, s);
+    SDL_Texture* tex = TextureRegistry::Get().CreateFromSurface(ren, s, "player-creator");
     SDL_DestroySurface(s);
     if (tex) {
         SDL_RenderTexture(ren, tex, nullptr, nullptr);
-        SDL_DestroyTexture(tex);
+        TextureRegistry::Get().Destroy(tex);
     }
     window.Update();
 }
@@ -1164,8 +1166,9 @@ void PlayerCreatorScene::refreshRoster() {
 
 void PlayerCreatorScene::loadRosterEntry(int idx) {
     if (idx < 0 || idx >= (int)mRoster.size()) return;
-    PlayerProfile loaded;
-    if (LoadPlayerProfile(mRoster[idx].path, loaded)) {
+    // Shared cached parse; the creator edits its own copy.
+    if (auto shared = GetPlayerProfile(mRoster[idx].path)) {
+        PlayerProfile loaded = *shared;
         // Only commit if we have a valid layout — avoid writing garbage on first load
         if (mHBInitialised && mPreviewCellRect.w > 0)
             commitHBToProfile(mSelectedSlot);
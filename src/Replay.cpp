@@ -0,0 +1,230 @@
+#include "Replay.hpp"
+#include "Components.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <print>
+
+namespace fs = std::filesystem;
+
+namespace {
+constexpr char MAGIC[4] = {'F', '2', 'D', 'R'};
+
+bool sRecordReplays = false;
+
+// ── Little-endian primitives ────────────────────────────────────────────────
+void PutU16(std::FILE* f, Uint16 v) {
+    const unsigned char b[2] = {(unsigned char)v, (unsigned char)(v >> 8)};
+    std::fwrite(b, 1, 2, f);
+}
+void PutU32(std::FILE* f, Uint32 v) {
+    const unsigned char b[4] = {(unsigned char)v, (unsigned char)(v >> 8),
+                                (unsigned char)(v >> 16), (unsigned char)(v >> 24)};
+    std::fwrite(b, 1, 4, f);
+}
+void PutStr(std::FILE* f, const std::string& s) {
+    const Uint16 n = (Uint16)std::min(s.size(), (size_t)0xFFFF);
+    PutU16(f, n);
+    std::fwrite(s.data(), 1, n, f);
+}
+
+bool GetU16(std::FILE* f, Uint16& v) {
+    unsigned char b[2];
+    if (std::fread(b, 1, 2, f) != 2)
+        return false;
+    v = (Uint16)(b[0] | (b[1] << 8));
+    return true;
+}
+bool GetU32(std::FILE* f, Uint32& v) {
+    unsigned char b[4];
+    if (std::fread(b, 1, 4, f) != 4)
+        return false;
+    v = (Uint32)b[0] | ((Uint32)b[1] << 8) | ((Uint32)b[2] << 16) | ((Uint32)b[3] << 24);
+    return true;
+}
+bool GetStr(std::FILE* f, std::string& s) {
+    Uint16 n = 0;
+    if (!GetU16(f, n))
+        return false;
+    s.resize(n);
+    return n == 0 || std::fread(s.data(), 1, n, f) == n;
+}
+
+// FNV-1a over the raw bits of each value.
+struct Hasher {
+    Uint32 h = 2166136261u;
+    void   Bytes(const void* p, size_t n) {
+        const auto* b = static_cast<const unsigned char*>(p);
+        for (size_t i = 0; i < n; ++i)
+            h = (h ^ b[i]) * 16777619u;
+    }
+    void Float(float v) { Bytes(&v, sizeof(v)); }
+    void Int(Uint32 v) { Bytes(&v, sizeof(v)); }
+};
+} // namespace
+
+void Replay::Checkpoint(entt::registry& reg) {
+    if (!frames.empty() && frames.size() % CHECK_INTERVAL == 0)
+        checksums.push_back(ReplayChecksum(reg));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// File I/O
+// ─────────────────────────────────────────────────────────────────────────────
+bool SaveReplay(const std::string& path, const Replay& replay) {
+    std::error_code ec;
+    if (fs::path(path).has_parent_path())
+        fs::create_directories(fs::path(path).parent_path(), ec);
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) {
+        std::print("[Replay] cannot write {}\n", path);
+        return false;
+    }
+
+    Uint32 dtBits = 0;
+    std::memcpy(&dtBits, &replay.tickDt, sizeof(dtBits));
+    std::fwrite(MAGIC, 1, sizeof(MAGIC), f);
+    PutU32(f, Replay::VERSION);
+    PutU32(f, replay.seed);
+    PutU32(f, (Uint32)replay.viewW);
+    PutU32(f, (Uint32)replay.viewH);
+    PutU32(f, dtBits);
+    PutStr(f, replay.levelPath);
+    PutStr(f, replay.profilePath);
+
+    // Run-length encode: consecutive identical frames share one record.
+    PutU32(f, (Uint32)replay.frames.size());
+    const size_t n = replay.frames.size();
+    for (size_t i = 0; i < n;) {
+        const InputFrame& fr  = replay.frames[i];
+        size_t            run = 1;
+        while (i + run < n && run < 0xFFFF && replay.frames[i + run] == fr)
+            ++run;
+        PutU16(f, (Uint16)run);
+        PutU16(f, fr.held);
+        PutU16(f, fr.pressed);
+        PutU16(f, fr.released);
+        i += run;
+    }
+
+    PutU32(f, (Uint32)replay.checksums.size());
+    for (Uint32 c : replay.checksums)
+        PutU32(f, c);
+
+    const bool ok = std::ferror(f) == 0;
+    if (std::fclose(f) != 0 || !ok) {
+        std::print("[Replay] failed writing {}\n", path);
+        return false;
+    }
+    return true;
+}
+
+bool LoadReplay(const std::string& path, Replay& out) {
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) {
+        std::print("[Replay] cannot open {}\n", path);
+        return false;
+    }
+
+    Replay r;
+    char   magic[4] = {};
+    Uint32 version = 0, viewW = 0, viewH = 0, dtBits = 0, ticks = 0, checks = 0;
+    bool   ok = std::fread(magic, 1, 4, f) == 4 && std::memcmp(magic, MAGIC, 4) == 0 &&
+              GetU32(f, version) && version == Replay::VERSION && GetU32(f, r.seed) &&
+              GetU32(f, viewW) && GetU32(f, viewH) && GetU32(f, dtBits) &&
+              GetStr(f, r.levelPath) && GetStr(f, r.profilePath) && GetU32(f, ticks);
+    if (ok) {
+        r.frames.reserve(ticks);
+        while (ok && r.frames.size() < ticks) {
+            Uint16     run = 0;
+            InputFrame fr;
+            ok = GetU16(f, run) && GetU16(f, fr.held) && GetU16(f, fr.pressed) &&
+                 GetU16(f, fr.released) && run > 0 && r.frames.size() + run <= ticks;
+            if (ok)
+                r.frames.insert(r.frames.end(), run, fr);
+        }
+    }
+    ok = ok && GetU32(f, checks);
+    for (Uint32 i = 0; ok && i < checks; ++i) {
+        Uint32 c = 0;
+        ok       = GetU32(f, c);
+        r.checksums.push_back(c);
+    }
+    std::fclose(f);
+
+    if (!ok) {
+        std::print("[Replay] {} is not a version {} replay or is truncated\n", path,
+                   Replay::VERSION);
+        return false;
+    }
+    r.viewW = (int)viewW;
+    r.viewH = (int)viewH;
+    std::memcpy(&r.tickDt, &dtBits, sizeof(dtBits));
+    out = std::move(r);
+    return true;
+}
+
+std::string NewReplayPath(const std::string& levelPath) {
+    char        stamp[32] = "unknown";
+    std::time_t now       = std::time(nullptr);
+    if (std::tm* tm = std::localtime(&now))
+        std::strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", tm);
+    std::string stem = fs::path(levelPath).stem().string();
+    if (stem.empty())
+        stem = "session";
+    // Two lives can end within the same second.
+    const std::string base = std::string(Replay::REPLAY_DIR) + "/" + stem + "-" + stamp;
+    std::string       path = base + ".f2dr";
+    for (int n = 2; fs::exists(path); ++n)
+        path = base + "-" + std::to_string(n) + ".f2dr";
+    return path;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Verification
+// ─────────────────────────────────────────────────────────────────────────────
+Uint32 ReplayChecksum(entt::registry& reg) {
+    Hasher h;
+    auto   players = reg.view<PlayerTag, Transform, Velocity, GravityState, Health>();
+    players.each([&](const Transform& t, const Velocity& v, const GravityState& g,
+                     const Health& hp) {
+        h.Float(t.x);
+        h.Float(t.y);
+        h.Float(v.dx);
+        h.Float(v.dy);
+        h.Float(g.velocity);
+        h.Int((Uint32)g.direction);
+        h.Float(hp.current);
+    });
+    auto enemies = reg.view<EnemyTag, Transform, Velocity>();
+    enemies.each([&](const Transform& t, const Velocity& v) {
+        h.Float(t.x);
+        h.Float(t.y);
+        h.Float(v.dx);
+    });
+    h.Int((Uint32)reg.view<CoinTag>().size());
+    h.Int((Uint32)reg.view<TileTag>().size());
+    return h.h;
+}
+
+void ReplayPlayer::Verify(entt::registry& reg) {
+    const size_t idx = mTick / Replay::CHECK_INTERVAL; // 1-based checkpoint
+    if (idx > 0 && mTick % Replay::CHECK_INTERVAL == 0 && idx <= mReplay.checksums.size()) {
+        ++mChecked;
+        if (mDivergedAt < 0 && ReplayChecksum(reg) != mReplay.checksums[idx - 1]) {
+            mDivergedAt = (long long)mTick;
+            std::print("[Replay] diverged from the recording by tick {}\n", mTick);
+        }
+    }
+    if (Finished() && !mReported) {
+        mReported = true;
+        if (mDivergedAt < 0)
+            std::print("[Replay] finished: {} ticks, {} checkpoints matched\n", mTick,
+                       mChecked);
+    }
+}
+
+void SetRecordReplays(bool on) { sRecordReplays = on; }
+bool RecordReplays() { return sRecordReplays; }
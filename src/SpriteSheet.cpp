@@ -1,4 +1,7 @@
 #include "SpriteSheet.hpp"
+#include "SurfaceUtils.hpp"
+#include "TextureRegistry.hpp"
+#include "TraceRecorder.hpp"
 #include <SDL3_image/SDL_image.h>
 #include <algorithm>
 #include <fstream>
@@ -7,8 +10,9 @@
 
 SpriteSheet::SpriteSheet(const std::string& imageFile, const std::string& coordFile)
     : surface(nullptr) {
+    TRACE_SCOPE("asset", "SpriteSheet load", imageFile);
     // Load the sprite sheet image
-    surface = IMG_Load(imageFile.c_str());
+    surface = LoadImageFile(imageFile);
     if (!surface) {
         std::print("Failed to load sprite sheet: {}\n{}\n", imageFile, SDL_GetError());
         return;
@@ -22,6 +26,7 @@ SpriteSheet::SpriteSheet(const std::string& imageFile, const std::string& coordF
 
 SpriteSheet::SpriteSheet(const std::string& directory, const std::string& prefix, int frameCount, int targetW, int targetH, int padDigits, int startIndex)
     : surface(nullptr) {
+    TRACE_SCOPE("asset", "SpriteSheet load", directory);
     std::string dir = directory;
     if (!dir.empty() && dir.back() != '/')
         dir += '/';
@@ -46,7 +51,7 @@ SpriteSheet::SpriteSheet(const std::string& directory, const std::string& prefix
         if (padDigits > 0)
             numStr = std::string(std::max(0, padDigits - (int)numStr.size()), '0') + numStr;
         std::string  path = dir + prefix + numStr + ".png";
-        SDL_Surface* s    = IMG_Load(path.c_str());
+        SDL_Surface* s    = LoadImageFile(path);
         if (!s) {
             std::print("Failed to load frame: {}\n{}\n", path, SDL_GetError());
             for (auto* f : frameSurfaces) SDL_DestroySurface(f);
@@ -76,6 +81,7 @@ SpriteSheet::SpriteSheet(const std::string& directory, const std::string& prefix
     }
     SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
 
+    LoadReport::Timer stitch(LoadReport::Convert);
     for (int i = 0; i < static_cast<int>(frameSurfaces.size()); i++) {
         int col = i % cols;
         int row = i / cols;
@@ -97,13 +103,14 @@ SpriteSheet::SpriteSheet(const std::string& directory, const std::string& prefix
 
 SpriteSheet::SpriteSheet(const std::vector<std::string>& paths, int targetW, int targetH)
     : surface(nullptr) {
+    TRACE_SCOPE("asset", "SpriteSheet load", paths.empty() ? std::string_view{} : paths[0]);
     if (paths.empty()) return;
 
     std::vector<SDL_Surface*> frameSurfaces;
     int frameW = 0, frameH = 0;
 
     for (const auto& path : paths) {
-        SDL_Surface* s = IMG_Load(path.c_str());
+        SDL_Surface* s = LoadImageFile(path);
         if (!s) {
             std::print("Failed to load frame: {}\n{}\n", path, SDL_GetError());
             for (auto* f : frameSurfaces) SDL_DestroySurface(f);
@@ -129,6 +136,7 @@ SpriteSheet::SpriteSheet(const std::vector<std::string>& paths, int targetW, int
     }
     SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
 
+    LoadReport::Timer stitch(LoadReport::Convert);
     for (int i = 0; i < frameCount; ++i) {
         int col = i % cols;
         int row = i / cols;
@@ -146,7 +154,7 @@ SpriteSheet::SpriteSheet(const std::vector<std::string>& paths, int targetW, int
 }
 
 SpriteSheet::~SpriteSheet() {
-    if (texture) SDL_DestroyTexture(texture);
+    if (texture) TextureRegistry::Get().Destroy(texture);
     if (surface) SDL_DestroySurface(surface);
 }
 
@@ -1,4 +1,6 @@
 #include "Text.hpp"
+#include "TextureRegistry.hpp"
+#include "TraceRecorder.hpp"
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
 #include <optional>
@@ -28,7 +30,7 @@ Text::Text(std::string Content, SDL_Color ColorFg,
 }
 
 Text::~Text() {
-    if (mTexture)     SDL_DestroyTexture(mTexture);
+    if (mTexture)     TextureRegistry::Get().Destroy(mTexture);
     if (mTextSurface) SDL_DestroySurface(mTextSurface);
 }
 
@@ -37,8 +39,9 @@ void Text::Render(SDL_Renderer* renderer) {
 
     // Upload pending surface to texture on first render (or after text change)
     if (mDirty && mTextSurface) {
-        if (mTexture) SDL_DestroyTexture(mTexture);
-        mTexture = SDL_CreateTextureFromSurface(renderer, mTextSurface);
+        TRACE_SCOPE("gpu", "Text upload", mContent);
+        if (mTexture) TextureRegistry::Get().Destroy(mTexture);
+        mTexture = TextureRegistry::Get().CreateFromSurface(renderer, mTextSurface, "text");
         SDL_DestroySurface(mTextSurface);
         mTextSurface = nullptr;
         mDirty       = false;
@@ -47,11 +50,13 @@ void Text::Render(SDL_Renderer* renderer) {
     if (!mTexture) return;
 
     SDL_FRect dst = {(float)mPosX, (float)mPosY, (float)mTexW, (float)mTexH};
+    TextureRegistry::Get().Touch(mTexture);
     SDL_RenderTexture(renderer, mTexture, nullptr, &dst);
 }
 
 void Text::CreateSurface(std::string Content) {
     if (!mFont || Content.empty()) return;
+    TRACE_SCOPE("text", "Text rasterise", Content);
     mContent = Content;
 
     SDL_Surface* s = nullptr;
@@ -62,7 +67,7 @@ void Text::CreateSurface(std::string Content) {
 
     if (s) {
         if (mTextSurface) SDL_DestroySurface(mTextSurface);
-        if (mTexture)     { SDL_DestroyTexture(mTexture); mTexture = nullptr; }
+        if (mTexture)     { TextureRegistry::Get().Destroy(mTexture); mTexture = nullptr; }
         mTextSurface = s;
         mTexW        = s->w;
         mTexH        = s->h;
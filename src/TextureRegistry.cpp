@@ -0,0 +1,185 @@
+#include "TextureRegistry.hpp"
+#include "LoadReport.hpp"
+#include <algorithm>
+#include <cstring>
+#include <print>
+
+namespace {
+constexpr int CHAR_PX = SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE;
+constexpr int LINE_PX = CHAR_PX + 4;
+constexpr int PAD     = 8;
+constexpr int ROWS    = 16; // owners listed in the view
+
+double ToMB(Uint64 bytes) { return (double)bytes / (1024.0 * 1024.0); }
+} // namespace
+
+TextureRegistry& TextureRegistry::Get() {
+    static TextureRegistry instance;
+    return instance;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Creation / destruction
+// ─────────────────────────────────────────────────────────────────────────────
+SDL_Texture* TextureRegistry::Track(SDL_Texture* tex, const char* owner) {
+    if (!tex)
+        return nullptr;
+    Entry e;
+    e.owner    = owner;
+    e.w        = tex->w;
+    e.h        = tex->h;
+    e.bytes    = (Uint64)tex->w * (Uint64)tex->h * (Uint64)SDL_BYTESPERPIXEL(tex->format);
+    e.lastUsed = mFrame;
+    mBytes += e.bytes;
+    mEntries[tex] = e;
+    return tex;
+}
+
+SDL_Texture* TextureRegistry::CreateFromSurface(SDL_Renderer* ren, SDL_Surface* surf,
+                                                const char* owner) {
+    LoadReport::Timer upload(LoadReport::Upload);
+    SDL_Texture*      tex = Track(SDL_CreateTextureFromSurface(ren, surf), owner);
+    if (tex)
+        upload.Bytes(mEntries[tex].bytes);
+    return tex;
+}
+
+SDL_Texture* TextureRegistry::Create(SDL_Renderer* ren, SDL_PixelFormat format,
+                                     SDL_TextureAccess access, int w, int h,
+                                     const char* owner) {
+    return Track(SDL_CreateTexture(ren, format, access, w, h), owner);
+}
+
+void TextureRegistry::Destroy(SDL_Texture* tex) {
+    if (!tex)
+        return;
+    if (auto it = mEntries.find(tex); it != mEntries.end()) {
+        mBytes -= it->second.bytes;
+        mEntries.erase(it);
+    }
+    // SDL may hand the same address to the next texture created.
+    if (mLastTouched == tex)
+        mLastTouched = nullptr;
+    SDL_DestroyTexture(tex);
+}
+
+void TextureRegistry::TouchSlow(SDL_Texture* tex) {
+    auto it = mEntries.find(tex);
+    if (it == mEntries.end())
+        return;
+    it->second.lastUsed = mFrame;
+    mLastTouched        = tex;
+}
+
+void TextureRegistry::SetEvictor(SDL_Texture* tex, TextureEvictor* evictor) {
+    if (auto it = mEntries.find(tex); it != mEntries.end())
+        it->second.evictor = evictor;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Budget
+// ─────────────────────────────────────────────────────────────────────────────
+void TextureRegistry::EndFrame() {
+    if (mBudget > 0 && mBytes > mBudget)
+        EnforceBudget();
+    else
+        mWarnedOver = false;
+    ++mFrame;
+    mLastTouched = nullptr; // the next Touch() must stamp the new frame
+}
+
+void TextureRegistry::EnforceBudget() {
+    // Candidates: evictable and not drawn this frame, oldest first.
+    std::vector<std::pair<Uint64, SDL_Texture*>> lru;
+    for (const auto& [tex, e] : mEntries)
+        if (e.evictor && e.lastUsed < mFrame)
+            lru.emplace_back(e.lastUsed, tex);
+    std::sort(lru.begin(), lru.end());
+
+    const Uint64 before  = mBytes;
+    int          evicted = 0;
+    for (const auto& [lastUsed, tex] : lru) {
+        if (mBytes <= mBudget)
+            break;
+        mEntries[tex].evictor->OnEvict(tex);
+        Destroy(tex);
+        ++evicted;
+    }
+    mEvicted += evicted;
+
+    if (evicted > 0)
+        std::print("[Textures] over the {:.1f} MB budget: evicted {} textures, {:.1f} -> "
+                   "{:.1f} MB\n",
+                   ToMB(mBudget), evicted, ToMB(before), ToMB(mBytes));
+    if (mBytes > mBudget && !mWarnedOver) {
+        mWarnedOver = true;
+        std::print("[Textures] {:.1f} MB in use, over the {:.1f} MB budget with nothing "
+                   "left to evict\n",
+                   ToMB(mBytes), ToMB(mBudget));
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Stats / debug view
+// ─────────────────────────────────────────────────────────────────────────────
+std::vector<TextureRegistry::OwnerStats> TextureRegistry::ByOwner() const {
+    std::vector<OwnerStats> owners;
+    for (const auto& [tex, e] : mEntries) {
+        auto it = std::find_if(owners.begin(), owners.end(), [&](const OwnerStats& o) {
+            return std::strcmp(o.owner, e.owner) == 0;
+        });
+        if (it == owners.end())
+            it = owners.insert(owners.end(), OwnerStats{e.owner});
+        ++it->count;
+        it->bytes += e.bytes;
+        it->evictable += e.evictor ? 1 : 0;
+    }
+    std::sort(owners.begin(), owners.end(),
+              [](const OwnerStats& a, const OwnerStats& b) { return a.bytes > b.bytes; });
+    return owners;
+}
+
+void TextureRegistry::DrawView(SDL_Renderer* ren) const {
+    if (!ren)
+        return;
+    const std::vector<OwnerStats> owners = ByOwner();
+    const int                     rows   = std::min((int)owners.size(), ROWS);
+
+    constexpr int COLS   = 44;
+    const float   panelW = (float)(COLS * CHAR_PX + PAD * 2);
+    const float   panelH = (float)(PAD * 2 + LINE_PX * (rows + 2));
+    float         y      = (float)(PAD * 2);
+    char          buf[96];
+
+    SDL_SetRenderDrawBlendMode(ren, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(ren, 10, 12, 18, 210);
+    const SDL_FRect bg{(float)PAD, (float)PAD, panelW, panelH};
+    SDL_RenderFillRect(ren, &bg);
+
+    if (mBudget > 0)
+        SDL_snprintf(buf, sizeof(buf), "textures %5d %8.1f MB / %.0f MB  evicted %d",
+                     Count(), ToMB(mBytes), ToMB(mBudget), mEvicted);
+    else
+        SDL_snprintf(buf, sizeof(buf), "textures %5d %8.1f MB  (no budget)", Count(),
+                     ToMB(mBytes));
+    if (mBudget > 0 && mBytes > mBudget)
+        SDL_SetRenderDrawColor(ren, 255, 110, 110, 255);
+    else
+        SDL_SetRenderDrawColor(ren, 255, 255, 255, 255);
+    SDL_RenderDebugText(ren, PAD * 2, y, buf);
+    y += LINE_PX;
+
+    SDL_SetRenderDrawColor(ren, 140, 150, 170, 255);
+    SDL_snprintf(buf, sizeof(buf), "%-20s %6s %9s %6s", "owner", "count", "MB", "evict");
+    SDL_RenderDebugText(ren, PAD * 2, y, buf);
+    y += LINE_PX;
+
+    SDL_SetRenderDrawColor(ren, 220, 225, 235, 255);
+    for (int i = 0; i < rows; ++i) {
+        const OwnerStats& o = owners[i];
+        SDL_snprintf(buf, sizeof(buf), "%-20.20s %6d %9.2f %6d", o.owner, o.count,
+                     ToMB(o.bytes), o.evictable);
+        SDL_RenderDebugText(ren, PAD * 2, y, buf);
+        y += LINE_PX;
+    }
+}
@@ -1,4 +1,5 @@
 #include "TileAnimCreatorScene.hpp"
+#include "TextureRegistry.hpp"
 #include "TitleScene.hpp"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
@@ -505,11 +506,11 @@ void TileAnimCreatorScene::Render(Window& window, float /*alpha*/) {
     }
 
     // Upload the completed surface to GPU and present
-    SDL_Texture* tex = SDL_CreateTextureFromSurface(ren, s);
+    SDL_Texture* tex = TextureRegistry::Get().CreateFromSurface(ren, s, "tile-anim-creator");
     SDL_DestroySurface(s);
     if (tex) {
         SDL_RenderTexture(ren, tex, nullptr, nullptr);
-        SDL_DestroyTexture(tex);
+        TextureRegistry::Get().Destroy(tex);
     }
     window.Update();
 }
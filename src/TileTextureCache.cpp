@@ -0,0 +1,82 @@
+#include "TileTextureCache.hpp"
+#include "SurfaceUtils.hpp"
+#include "TraceRecorder.hpp"
+#include <print>
+
+std::string TileTextureCache::Key(const std::string& path, int rotation) {
+    return path + "|r" + std::to_string(rotation);
+}
+
+SDL_Texture* TileTextureCache::Upload(SDL_Renderer* ren, SDL_Surface* surf) {
+    SDL_Texture* tex = TextureRegistry::Get().CreateFromSurface(ren, surf, mOwner);
+    if (!tex)
+        return nullptr;
+    SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_PIXELART);
+    if (mEvictable)
+        TextureRegistry::Get().SetEvictor(tex, this);
+    return tex;
+}
+
+SDL_Texture* TileTextureCache::Get(SDL_Renderer* ren, const std::string& path, int rotation) {
+    std::string key = Key(path, rotation);
+    if (auto it = mEntries.find(key); it != mEntries.end()) {
+        TextureRegistry::Get().Touch(it->second);
+        return it->second;
+    }
+
+    // Decode + convert + rotate on the CPU (must happen before GPU upload).
+    // Upload at native resolution — the GPU scales at render time.
+    SDL_Texture* tex = nullptr;
+    if (SDL_Surface* surf = LoadTileSurface(path, rotation)) {
+        TRACE_SCOPE("gpu", "TileTextureCache upload", path);
+        tex = Upload(ren, surf);
+        SDL_DestroySurface(surf);
+    }
+    if (!tex)
+        std::print("[TileTextureCache] failed to load '{}'\n", path);
+    mEntries[key] = tex;
+    return tex;
+}
+
+SDL_Texture* TileTextureCache::FromSurface(SDL_Renderer* ren, SDL_Surface* src) {
+    if (!src)
+        return nullptr;
+    if (auto it = mSurfaces.find(src); it != mSurfaces.end()) {
+        TextureRegistry::Get().Touch(it->second);
+        return it->second;
+    }
+
+    SDL_Texture* tex = nullptr;
+    {
+        TRACE_SCOPE("gpu", "TileTextureCache upload", "surface");
+        tex = Upload(ren, src);
+    }
+    mSurfaces.emplace(src, tex);
+    return tex;
+}
+
+void TileTextureCache::Forget(const SDL_Surface* src) {
+    auto it = mSurfaces.find(src);
+    if (it == mSurfaces.end())
+        return;
+    TextureRegistry::Get().Destroy(it->second);
+    mSurfaces.erase(it);
+}
+
+void TileTextureCache::Clear() {
+    for (auto& [key, tex] : mEntries)
+        TextureRegistry::Get().Destroy(tex);
+    mEntries.clear();
+    for (auto& [src, tex] : mSurfaces)
+        TextureRegistry::Get().Destroy(tex);
+    mSurfaces.clear();
+}
+
+void TileTextureCache::OnEvict(SDL_Texture* tex) {
+    // Eviction is rare and the cache small; a scan beats a reverse index.
+    auto drop = [tex](auto& map) {
+        return std::erase_if(map, [tex](const auto& kv) { return kv.second == tex; }) > 0;
+    };
+    if (!drop(mEntries))
+        drop(mSurfaces);
+}
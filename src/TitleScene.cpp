@@ -3,6 +3,8 @@
 #include "GameScene.hpp"
 #include "LevelEditorScene.hpp"
 #include "PlayerCreatorScene.hpp"
+#include "ProfileCache.hpp"
+#include "TextureRegistry.hpp"
 #include "TileAnimCreatorScene.hpp"
 #include <SDL3_image/SDL_image.h>
 
@@ -38,7 +40,7 @@ std::unique_ptr<Scene> TitleScene::NextScene() {
 void TitleScene::openCharPicker() {
     // Destroy previous textures before rebuilding
     for (auto& c : mCharCards)
-        if (c.previewTex) { SDL_DestroyTexture(c.previewTex); c.previewTex = nullptr; }
+        if (c.previewTex) { TextureRegistry::Get().Destroy(c.previewTex); c.previewTex = nullptr; }
     mCharCards.clear();
     mCharPickerOpen      = true;
     mCharPickerScroll    = 0;
@@ -87,7 +89,7 @@ void TitleScene::openCharPicker() {
                 final = scaled;
             }
         }
-        c.previewTex = SDL_CreateTextureFromSurface(mRenderer, final);
+        c.previewTex = TextureRegistry::Get().CreateFromSurface(mRenderer, final, "title");
         if (c.previewTex)
             SDL_SetTextureScaleMode(c.previewTex, SDL_SCALEMODE_PIXELART);
         SDL_DestroySurface(final);
@@ -105,8 +107,9 @@ void TitleScene::openCharPicker() {
 
     // Remaining cards: saved player profiles
     for (const auto& profilePath : ScanPlayerProfiles()) {
-        PlayerProfile prof;
-        if (!LoadPlayerProfile(profilePath.string(), prof)) continue;
+        auto profPtr = GetPlayerProfile(profilePath.string());
+        if (!profPtr) continue;
+        const PlayerProfile& prof = *profPtr;
         CharCard c;
         c.name = prof.name; c.profilePath = profilePath.string();
         const std::string& idleDir = prof.Slot(PlayerAnimSlot::Idle).folderPath;
@@ -0,0 +1,191 @@
+#include "TraceRecorder.hpp"
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <print>
+
+namespace fs = std::filesystem;
+
+namespace {
+void WriteEscaped(std::FILE* f, std::string_view s) {
+    for (char c : s) {
+        switch (c) {
+            case '"':  std::fputs("\\\"", f); break;
+            case '\\': std::fputs("\\\\", f); break;
+            case '\n': std::fputs("\\n", f); break;
+            case '\t': std::fputs("\\t", f); break;
+            default:
+                if ((unsigned char)c < 0x20)
+                    std::fprintf(f, "\\u%04x", (unsigned)c);
+                else
+                    std::fputc(c, f);
+        }
+    }
+}
+} // namespace
+
+std::atomic<bool> TraceRecorder::sActive{false};
+
+TraceRecorder& TraceRecorder::Get() {
+    static TraceRecorder instance;
+    return instance;
+}
+
+void TraceRecorder::Start() {
+    std::lock_guard lock(mMutex);
+    mEvents.clear();
+    mEvents.reserve(CAPACITY); // one allocation up front, no growth hitches mid-capture
+    mNext       = 0;
+    mDropped    = 0;
+    mStart      = SDL_GetPerformanceCounter();
+    mMainThread = SDL_GetCurrentThreadID();
+    mStrings.clear();
+    mStringIds.clear();
+    sActive.store(true, std::memory_order_relaxed);
+    std::print("[Trace] recording (F4 to stop and save)\n");
+}
+
+std::string TraceRecorder::Stop() {
+    if (!sActive.exchange(false))
+        return "";
+
+    char        stamp[32] = "unknown";
+    std::time_t now       = std::time(nullptr);
+    if (std::tm* tm = std::localtime(&now))
+        std::strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", tm);
+    std::string path = std::string(TRACE_DIR) + "/forge2d-" + stamp + ".json";
+
+    std::lock_guard lock(mMutex);
+    std::error_code ec;
+    fs::create_directories(TRACE_DIR, ec);
+    const bool ok = Write(path);
+    if (ok)
+        std::print("[Trace] wrote {} events to {}{}\n", mEvents.size(), path,
+                   mDropped ? " (oldest " + std::to_string(mDropped) + " dropped)" : "");
+    else
+        std::print("[Trace] failed to write {}\n", path);
+
+    // Give the ring back; a capture can be ~CAPACITY * sizeof(Event).
+    std::vector<Event>().swap(mEvents);
+    std::vector<std::string>().swap(mStrings);
+    mStringIds.clear();
+    return ok ? path : "";
+}
+
+void TraceRecorder::Toggle() {
+    if (Active())
+        Stop();
+    else
+        Start();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Recording
+// ─────────────────────────────────────────────────────────────────────────────
+void TraceRecorder::Complete(const char* cat, const char* name, Uint64 start, Uint64 end,
+                             std::string_view detail) {
+    if (!Active())
+        return;
+    Event ev{cat, name, start, end > start ? end - start : 0, SDL_GetCurrentThreadID(), -1,
+             false};
+    std::lock_guard lock(mMutex);
+    if (!detail.empty())
+        ev.detail = Intern(detail);
+    Push(ev);
+}
+
+void TraceRecorder::Instant(const char* cat, const char* name, std::string_view detail) {
+    if (!Active())
+        return;
+    Event ev{cat, name, SDL_GetPerformanceCounter(), 0, SDL_GetCurrentThreadID(), -1, true};
+    std::lock_guard lock(mMutex);
+    if (!detail.empty())
+        ev.detail = Intern(detail);
+    Push(ev);
+}
+
+// mMutex held.
+void TraceRecorder::Push(const Event& ev) {
+    if (!Active())
+        return; // stopped while this thread waited for the lock
+    if (mEvents.size() < CAPACITY) {
+        mEvents.push_back(ev);
+        return;
+    }
+    mEvents[mNext] = ev;
+    mNext          = (mNext + 1) % CAPACITY;
+    ++mDropped;
+}
+
+Sint32 TraceRecorder::Intern(std::string_view s) {
+    std::string key(s);
+    if (auto it = mStringIds.find(key); it != mStringIds.end())
+        return it->second;
+    if (mStrings.size() >= MAX_STRINGS)
+        return -1;
+    const Sint32 id = (Sint32)mStrings.size();
+    mStrings.push_back(key);
+    mStringIds.emplace(std::move(key), id);
+    return id;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Chrome Trace Event JSON
+// ─────────────────────────────────────────────────────────────────────────────
+// One "X" (complete) event per span and one "i" per marker; timestamps are
+// microseconds since Start(). Threads are renumbered 1 = main, 2.. = workers
+// in order of first appearance, and named with "thread_name" metadata.
+bool TraceRecorder::Write(const std::string& path) const {
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f)
+        return false;
+
+    const double usPerTick = 1e6 / (double)SDL_GetPerformanceFrequency();
+    auto         toUs      = [&](Uint64 t) {
+        return t > mStart ? (t - mStart) * usPerTick : 0.0;
+    };
+
+    std::unordered_map<SDL_ThreadID, int> tids{{mMainThread, 1}};
+    auto tidOf = [&](SDL_ThreadID t) {
+        auto it = tids.find(t);
+        if (it == tids.end())
+            it = tids.emplace(t, (int)tids.size() + 1).first;
+        return it->second;
+    };
+
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", f);
+    const size_t n = mEvents.size();
+    for (size_t k = 0; k < n; ++k) {
+        // Oldest first: once the ring has wrapped, mNext is the oldest slot.
+        const Event& ev = mEvents[(mNext + k) % n];
+        std::fprintf(f, "{\"pid\":1,\"tid\":%d,\"cat\":\"%s\",\"name\":\"", tidOf(ev.thread),
+                     ev.cat);
+        WriteEscaped(f, ev.name);
+        if (ev.instant)
+            std::fprintf(f, "\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f", toUs(ev.start));
+        else
+            std::fprintf(f, "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f", toUs(ev.start),
+                         ev.dur * usPerTick);
+        if (ev.detail >= 0) {
+            std::fputs(",\"args\":{\"detail\":\"", f);
+            WriteEscaped(f, mStrings[ev.detail]);
+            std::fputs("\"}", f);
+        }
+        std::fputs("},\n", f);
+    }
+
+    for (const auto& [thread, tid] : tids)
+        std::fprintf(f,
+                     "{\"pid\":1,\"tid\":%d,\"ph\":\"M\",\"name\":\"thread_name\","
+                     "\"args\":{\"name\":\"%s%s\"}},\n",
+                     tid, tid == 1 ? "main" : "worker ",
+                     tid == 1 ? "" : std::to_string(tid - 1).c_str());
+    std::fprintf(f,
+                 "{\"pid\":1,\"tid\":1,\"ph\":\"M\",\"name\":\"process_name\","
+                 "\"args\":{\"name\":\"forge2d\"}}\n"
+                 "],\"otherData\":{\"droppedEvents\":%zu}}\n",
+                 mDropped);
+
+    const bool ok = std::ferror(f) == 0;
+    return std::fclose(f) == 0 && ok;
+}
@@ -1,17 +1,20 @@
 #include "Window.hpp"
 #include "ErrorHandling.hpp"
+#include "TextureRegistry.hpp"
 #include <SDL3_image/SDL_image.h>
 #include <algorithm>
 #include <stdexcept>
 
-Window::Window() {
+Window::Window() : Window(0, 0) {}
+
+Window::Window(int width, int height) {
     SDL_Rect usable{};
     SDL_DisplayID primary = SDL_GetPrimaryDisplay();
     if (primary == 0 || !SDL_GetDisplayUsableBounds(primary, &usable))
         usable = {0, 0, 1280, 800};
 
-    int winW = std::min(usable.w, 1600);
-    int winH = std::min(usable.h, 1050);
+    int winW = width > 0 ? width : std::min(usable.w, 1600);
+    int winH = height > 0 ? height : std::min(usable.h, 1050);
 
     SDL_Window* winPtr = SDL_CreateWindow("Forge2D", winW, winH,
                                           SDL_WINDOW_RESIZABLE | SDL_WINDOW_HIGH_PIXEL_DENSITY);
@@ -24,7 +27,7 @@ Window::Window() {
     // GPU-accelerated renderer with VSync enabled.
     // VSync syncs Present() to the display refresh rate, eliminating tearing
     // and giving the OS a natural yield point each frame. On WSL where VSync
-    // may not be honoured, the hybrid sleep+spin in main.cpp handles pacing.
+    // may not be honoured, FramePacer detects that and paces in software.
     SDL_PropertiesID renProps = SDL_CreateProperties();
     SDL_SetPointerProperty(renProps, SDL_PROP_RENDERER_CREATE_WINDOW_POINTER, winPtr);
     SDL_SetNumberProperty(renProps, SDL_PROP_RENDERER_CREATE_PRESENT_VSYNC_NUMBER, 1);
@@ -57,6 +60,9 @@ void Window::Render() {
 }
 
 void Window::Update() {
+    // F6 texture view sits on top of whatever the scene drew.
+    if (TextureRegistry::Get().ViewVisible())
+        TextureRegistry::Get().DrawView(SDLRenderer.get());
     SDL_RenderPresent(SDLRenderer.get());
     int prevW = mWidth, prevH = mHeight;
     SDL_GetWindowSize(SDLWindow.get(), &mWidth, &mHeight);
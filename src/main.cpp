@@ -1,7 +1,16 @@
 /*Copyright (c) 2025 Tanner Davison. All Rights Reserved.*/
+#include "ChunkedLevel.hpp"
+#include "FixedStep.hpp"
+#include "FramePacer.hpp"
+#include "FrameProfiler.hpp"
+#include "GameScene.hpp"
+#include "LevelSerializer.hpp"
+#include "Replay.hpp"
 #include "SceneManager.hpp"
 #include "Text.hpp"
+#include "TextureRegistry.hpp"
 #include "TitleScene.hpp"
+#include "TraceRecorder.hpp"
 #include "Window.hpp"
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
@@ -9,42 +18,215 @@
 #include <cstdlib>
 #include <ctime>
 #include <print>
+#include <string_view>
+#include <vector>
+
+namespace {
+// Refresh rate of the display `win` is on, 0 if SDL cannot tell.
+float DisplayHz(SDL_Window* win) {
+    const SDL_DisplayMode* mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(win));
+    return mode ? mode->refresh_rate : 0.0f;
+}
+
+// ── Headless replay ──────────────────────────────────────────────────────────
+// Re-simulates a recording through a real GameScene on SDL's offscreen video
+// driver: same load path and systems as the game, no rendering, no frame
+// limiter, ticks back to back. Returns 0 if every checkpoint matched.
+int RunHeadlessReplay(Replay replay, float dt) {
+    Window window(replay.viewW, replay.viewH);
+    if (window.GetWidth() != replay.viewW || window.GetHeight() != replay.viewH)
+        std::print("[Replay] window is {}x{}, recorded at {}x{}; expect divergence\n",
+                   window.GetWidth(), window.GetHeight(), replay.viewW, replay.viewH);
+
+    const size_t total = replay.frames.size();
+    const double msPerTick = 1000.0 / (double)SDL_GetPerformanceFrequency();
+    GameScene    scene(replay.levelPath, false, replay.profilePath);
+    scene.PlayReplay(std::move(replay));
+
+    const Uint64 loadStart = SDL_GetPerformanceCounter();
+    scene.Load(window);
+    const double loadMs = (SDL_GetPerformanceCounter() - loadStart) * msPerTick;
+
+    std::vector<float> tickMs;
+    tickMs.reserve(total);
+    for (;;) {
+        const ReplayPlayer* rp = scene.GetReplay();
+        if (!rp || rp->Finished())
+            break;
+        const size_t before = rp->Tick();
+        const Uint64 t0     = SDL_GetPerformanceCounter();
+        scene.Update(dt);
+        tickMs.push_back((float)((SDL_GetPerformanceCounter() - t0) * msPerTick));
+        if (rp->Tick() == before)
+            break; // game over / level complete before the recording ended
+    }
+
+    const ReplayPlayer* rp     = scene.GetReplay();
+    const bool          ok     = rp && rp->Finished() && rp->DivergedAt() < 0;
+    double              simMs  = 0.0;
+    for (float ms : tickMs)
+        simMs += ms;
+    std::vector<float> sorted = tickMs;
+    std::sort(sorted.begin(), sorted.end());
+    const float p99 = sorted.empty() ? 0.0f : sorted[(size_t)(sorted.size() * 0.99)];
+
+    if (rp && !rp->Finished())
+        std::print("[Replay] the scene stopped simulating at tick {} of {}\n", rp->Tick(),
+                   total);
+    std::print("[Replay] load {:.1f} ms, {} ticks in {:.1f} ms ({:.1f}x real time), "
+               "{:.3f} ms/tick avg, {:.3f} p99\n",
+               loadMs, tickMs.size(), simMs,
+               simMs > 0.0 ? tickMs.size() * dt * 1000.0 / simMs : 0.0,
+               tickMs.empty() ? 0.0 : simMs / tickMs.size(), p99);
+    scene.Unload();
+    return ok ? 0 : 2;
+}
+} // namespace
 
 int main(int argc, char** argv) {
-    // Hint SDL to use the best available GPU backend and enable low-latency
-    // presentation. On WSL this can force OpenGL instead of software rendering.
-    // Must be set before any SDL_Create* calls.
-    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "opengl");
-    SDL_SetHint(SDL_HINT_RENDER_VSYNC,  "1");
+    // ── Offline tool: split a level into streamed chunks ─────────────────────
+    //   forge2d --chunk-level <in.json> <out.json> [chunkSize]
+    // Writes <out.json> plus an <out>.chunks/ directory (see ChunkedLevel.hpp).
+    if (argc >= 4 && std::string_view(argv[1]) == "--chunk-level") {
+        Level level;
+        if (!LoadLevel(argv[2], level))
+            return 1;
+        int chunkSize = (argc >= 5) ? std::atoi(argv[4]) : 1024;
+        return SaveLevelChunked(level, argv[3], chunkSize) ? 0 : 1;
+    }
 
-    SDL_Init(SDL_INIT_VIDEO);
+    // ── Replays (see Replay.hpp) ─────────────────────────────────────────────
+    //   --record                   save every GameScene life to replays/
+    //   --replay FILE              play FILE back in the window
+    //   --replay FILE --headless   re-simulate FILE without a window, verify
+    //
+    // ── Frame pacing (see FramePacer.hpp) ────────────────────────────────────
+    //   --fps N                    render at most N frames/s (0 = uncapped)
+    //   --no-vsync                 don't ask the renderer for vsync
+    //
+    // ── Physics tick (see FixedStep.hpp) ─────────────────────────────────────
+    //   --tick-hz N                tick rate (default 120)
+    //   --fixed-tick               never drop the tick rate under load
+    //
+    // ── Textures (see TextureRegistry.hpp) ───────────────────────────────────
+    //   --tex-budget MB            evict unused cached textures above MB
+    std::string replayPath;
+    bool        headless  = false;
+    float       fps       = 60.0f;
+    bool        vsync     = true;
+    float       tickHz    = 120.0f;
+    bool        fixedTick = false;
+    float       texBudget = 0.0f;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view a = argv[i];
+        if (a == "--record")
+            SetRecordReplays(true);
+        else if (a == "--replay" && i + 1 < argc)
+            replayPath = argv[++i];
+        else if (a == "--headless")
+            headless = true;
+        else if (a == "--fps" && i + 1 < argc)
+            fps = (float)std::atof(argv[++i]);
+        else if (a == "--no-vsync")
+            vsync = false;
+        else if (a == "--tick-hz" && i + 1 < argc)
+            tickHz = std::max((float)std::atof(argv[++i]), 1.0f);
+        else if (a == "--fixed-tick")
+            fixedTick = true;
+        else if (a == "--tex-budget" && i + 1 < argc)
+            texBudget = std::max((float)std::atof(argv[++i]), 0.0f);
+    }
+    Replay replay;
+    if (!replayPath.empty() && !LoadReplay(replayPath, replay))
+        return 1;
+    if (headless && replayPath.empty()) {
+        std::print("--headless needs --replay FILE\n");
+        return 1;
+    }
+
+    if (headless) {
+        // Nothing is shown: SDL's offscreen driver with the software renderer.
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER,  "offscreen");
+        SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+    } else {
+        // Hint SDL to use the best available GPU backend and enable low-latency
+        // presentation. On WSL this can force OpenGL instead of software rendering.
+        // Must be set before any SDL_Create* calls.
+        SDL_SetHint(SDL_HINT_RENDER_DRIVER, "opengl");
+        SDL_SetHint(SDL_HINT_RENDER_VSYNC,  vsync ? "1" : "0");
+    }
+
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+        std::print("Error initializing SDL: {}\n", SDL_GetError());
+        return 1;
+    }
     if (!TTF_Init()) {
         std::print("Error initializing SDL_ttf: {}\n", SDL_GetError());
         return 1;
     }
     srand(static_cast<unsigned int>(time(nullptr)));
 
-    Window       GameWindow;
+#if FORGE2D_PROFILE
+    // --trace: record a Chrome trace from startup (F4 stops and saves it).
+    for (int i = 1; i < argc; ++i)
+        if (std::string_view(argv[i]) == "--trace")
+            TraceRecorder::Get().Start();
+#endif
+
+    // A replay re-simulates at the rate it was recorded at.
+    if (replay.tickDt > 0.0f)
+        tickHz = 1.0f / replay.tickDt;
+
+    if (headless) {
+        const float dt   = 1.0f / tickHz;
+        const int   code = RunHeadlessReplay(std::move(replay), dt);
+        FontCache::Clear();
+        TTF_Quit();
+        SDL_Quit();
+        return code;
+    }
+
+    // A replay needs the window size it was recorded at (0 x 0 = default).
+    Window       GameWindow(replay.viewW, replay.viewH);
     SceneManager manager;
 
-    manager.SetScene(std::make_unique<TitleScene>(), GameWindow);
+    // Window asks for vsync; the pacer measures whether it actually holds.
+    FramePacer& pacer = FramePacer::Get();
+    if (!vsync)
+        SDL_SetRenderVSync(GameWindow.GetRenderer(), 0);
+    pacer.SetVSyncRequested(vsync);
+    pacer.SetTargetHz(fps);
+    pacer.SetDisplayHz(DisplayHz(GameWindow.GetRaw()));
+
+    // Recording and replaying need every tick the same size.
+    FixedStep& step = FixedStep::Get();
+    step.SetRate(tickHz);
+    step.SetAdaptive(!fixedTick && !RecordReplays() && replayPath.empty());
+
+    TextureRegistry::Get().SetBudget((Uint64)(texBudget * 1024.0f * 1024.0f));
+
+    if (!replayPath.empty()) {
+        auto scene =
+            std::make_unique<GameScene>(replay.levelPath, false, replay.profilePath);
+        scene->PlayReplay(std::move(replay));
+        manager.SetScene(std::move(scene), GameWindow);
+    } else {
+        manager.SetScene(std::make_unique<TitleScene>(), GameWindow);
+    }
 
     SDL_Event E;
     Uint64 frequency = SDL_GetPerformanceFrequency();
     Uint64 lastTime  = SDL_GetPerformanceCounter();
 
     // ── Fixed timestep accumulator ─────────────────────────────────────────
-    // Physics always advances in fixed FIXED_DT steps regardless of how long
+    // Physics always advances in fixed step.Dt() steps regardless of how long
     // the previous frame took to render. This fully decouples simulation from
     // frame rate so gameplay feels identical on WSL (variable dt) and macOS
     // (stable VSync). Any leftover time carries into the next frame via the
-    // accumulator — nothing is ever lost or rounded.
+    // accumulator. FixedStep caps how much time one frame may simulate and,
+    // if that cap keeps being hit, lowers the tick rate (see FixedStep.hpp).
     //
     // Reference: https://gafferongames.com/post/fix_your_timestep/
-    constexpr float FIXED_DT    = 1.0f / 120.0f; // physics tick rate (120 Hz)
-    constexpr float MAX_FRAME   = 1.0f / 20.0f;  // max real dt before spiral-of-death clamp
-    constexpr float TARGET_DT   = 1.0f / 60.0f;  // render / sleep target
-    float           accumulator = 0.0f;
 
     while (true) {
         // ── Measure real elapsed time ────────────────────────────────────
@@ -53,28 +235,47 @@ int main(int argc, char** argv) {
                            / static_cast<float>(frequency);
         lastTime = currentTime;
 
-        // Clamp so a breakpoint / system pause doesn't send the sim flying
-        if (frameTime > MAX_FRAME) frameTime = MAX_FRAME;
-
         // ── Events ──────────────────────────────────────────────────────
-        while (SDL_PollEvent(&E)) {
-            if (!manager.HandleEvent(E)) {
-                manager.Shutdown();
-                FontCache::Clear();
-                TTF_Quit();
-                SDL_Quit();
-                return 0;
+        {
+            PROFILE_ZONE("Events");
+            while (SDL_PollEvent(&E)) {
+#if FORGE2D_PROFILE
+                // F4 works in every scene: start / stop-and-save a trace.
+                if (E.type == SDL_EVENT_KEY_DOWN && E.key.key == SDLK_F4 && !E.key.repeat) {
+                    TraceRecorder::Get().Toggle();
+                    continue;
+                }
+#endif
+                // F6 works in every scene: texture memory by owner.
+                if (E.type == SDL_EVENT_KEY_DOWN && E.key.key == SDLK_F6 && !E.key.repeat) {
+                    TextureRegistry::Get().ToggleView();
+                    continue;
+                }
+                // Moving to another monitor can change the refresh rate.
+                if (E.type == SDL_EVENT_WINDOW_DISPLAY_CHANGED)
+                    pacer.SetDisplayHz(DisplayHz(GameWindow.GetRaw()));
+                if (!manager.HandleEvent(E)) {
+                    TraceRecorder::Get().Stop(); // save a capture still running
+                    pacer.PrintSummary();
+                    manager.Shutdown();
+                    FontCache::Clear();
+                    TTF_Quit();
+                    SDL_Quit();
+                    return 0;
+                }
             }
         }
 
         // ── Fixed-step physics ───────────────────────────────────────────
-        // Drain the accumulator in FIXED_DT chunks. Each tick advances the
+        // Drain the accumulator in step.Dt() chunks. Each tick advances the
         // full simulation by exactly the same amount every time — gravity,
         // velocity integration, collision, animation, camera — all deterministic.
-        accumulator += frameTime;
-        while (accumulator >= FIXED_DT) {
-            manager.Update(FIXED_DT, GameWindow);
-            accumulator -= FIXED_DT;
+        step.BeginFrame(frameTime);
+        {
+            PROFILE_ZONE("Update");
+            while (step.Step())
+                manager.Update(step.Dt(), GameWindow);
+            step.EndUpdate();
         }
 
         // ── Render ──────────────────────────────────────────────────────
@@ -82,23 +283,28 @@ int main(int argc, char** argv) {
         // not yet been simulated. RenderSystem lerps each entity's draw
         // position between PrevTransform and Transform by this factor, so
         // motion appears perfectly smooth regardless of frame rate variance.
-        float alpha = accumulator / FIXED_DT;
-        manager.Render(GameWindow, alpha);
-
-        // ── Hybrid frame limiter ─────────────────────────────────────────
-        // Coarse sleep eats most of the idle time cheaply; busy-spin covers
-        // the last ~1ms where SDL_Delay's ~10ms granularity would overshoot.
-        Uint64 frameEnd     = SDL_GetPerformanceCounter();
-        float  frameCost    = static_cast<float>(frameEnd - lastTime)
-                            / static_cast<float>(frequency);
-        float  sleepSeconds = TARGET_DT - frameCost - 0.001f;
-        if (sleepSeconds > 0.0f)
-            SDL_Delay(static_cast<Uint32>(sleepSeconds * 1000.0f));
-
-        while (static_cast<float>(SDL_GetPerformanceCounter() - lastTime)
-               / static_cast<float>(frequency) < TARGET_DT) {
-            // busy-spin the last sub-millisecond for precise frame delivery
+        float alpha     = step.Alpha();
+        bool  presented = false;
+        {
+            PROFILE_ZONE("Render");
+            presented = manager.Render(GameWindow, alpha);
+        }
+
+        // ── Frame pacing ─────────────────────────────────────────────────
+        // Nothing to do when vsync already blocked in Present; otherwise a
+        // high-resolution sleep plus a short measured spin to the deadline.
+        // An idle iteration (nothing presented) just sleeps.
+        {
+            PROFILE_ZONE("FrameWait");
+            pacer.EndFrame(presented);
         }
+        // Textures drawn this frame are stamped; evict over-budget leftovers.
+        // An idle iteration drew nothing, so it must not age anything.
+        if (presented)
+            TextureRegistry::Get().EndFrame();
+
+        // Frame boundary for the profiler (F3 overlay in GameScene).
+        PROFILE_END_FRAME();
     }
 
     TTF_Quit();
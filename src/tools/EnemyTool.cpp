@@ -1,5 +1,6 @@
 #include "tools/PlacementTools.hpp"
 #include "EnemyProfile.hpp"
+#include "ProfileCache.hpp"
 #include "Text.hpp"
 #include <SDL3_image/SDL_image.h>
 #include <algorithm>
@@ -26,10 +27,10 @@ void EnemyTool::RefreshPicker() {
 
     // Scan enemies/ directory for profiles
     for (const auto& path : ScanEnemyProfiles()) {
-        EnemyProfile prof;
-        if (!LoadEnemyProfile(path.string(), prof)) continue;
-        std::string preview = EnemyPreviewImagePath(prof);
-        pickerEntries.push_back({prof.name, preview, {}});
+        auto prof = GetEnemyProfile(path.string());
+        if (!prof) continue;
+        std::string preview = EnemyPreviewImagePath(*prof);
+        pickerEntries.push_back({prof->name, preview, {}});
     }
 }
 
@@ -39,6 +40,7 @@ void EnemyTool::CommitSpeedEdit(EditorToolContext& ctx) {
     if (speedPopupIdx < (int)ctx.level.enemies.size()) {
         float val = speedStr.empty() ? 120.0f : std::stof(speedStr);
         if (val < 0.0f) val = 0.0f;
+        ctx.Touch(Kind::Enemy, speedPopupIdx);
         ctx.level.enemies[speedPopupIdx].speed = val;
         ctx.SetStatus("Enemy speed set to " + std::to_string((int)val));
     }
@@ -92,11 +94,9 @@ ToolResult EnemyTool::OnMouseDown(EditorToolContext& ctx, int mx, int my,
                                   std::to_string((int)placementSpeed));
                 } else {
                     selectedType = pickerEntries[i].name;
-                    // Load the profile to get its default speed
-                    EnemyProfile prof;
-                    std::string profPath = EnemyProfilePath(selectedType);
-                    if (LoadEnemyProfile(profPath, prof))
-                        placementSpeed = prof.speed;
+                    // Default speed from the profile
+                    if (const auto* info = ctx.enemyTypes.Find(selectedType))
+                        placementSpeed = info->speed;
                     ctx.SetStatus("Enemy: " + selectedType + "  spd=" +
                                   std::to_string((int)placementSpeed));
                 }
@@ -114,6 +114,7 @@ ToolResult EnemyTool::OnMouseDown(EditorToolContext& ctx, int mx, int my,
                 SDL_Keymod mods = SDL_GetModState();
                 if (mods & SDL_KMOD_SHIFT) {
                     // Toggle start direction
+                    ctx.Touch(Kind::Enemy, ei);
                     auto& en = ctx.level.enemies[ei];
                     en.startLeft = !en.startLeft;
                     ctx.SetStatus("Enemy #" + std::to_string(ei) + " starts " +
@@ -149,6 +150,7 @@ ToolResult EnemyTool::OnMouseDown(EditorToolContext& ctx, int mx, int my,
     es.startLeft = placementStartLeft;
     es.enemyType = selectedType;
     ctx.level.enemies.push_back(std::move(es));
+    ctx.Appended(Kind::Enemy);
 
     std::string typeName = selectedType.empty() ? "slime" : selectedType;
     ctx.SetStatus("Enemy: " + typeName + " at " + std::to_string(sx) + "," +